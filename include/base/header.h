@@ -18,11 +18,15 @@ extern "C" {
 #include <limits.h>
 #include <time.h>
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <ctype.h>
 #include <dirent.h>
 #include <sys/timeb.h>
 #include <signal.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
 
 #ifndef NO_GFX_MODE
 #include <gd.h>
@@ -125,6 +129,20 @@ extern "C" {
 
 #define STRIDE 16
 
+/* Random number generator types */
+
+#define RNG_TYPE_LCG     1
+#define RNG_TYPE_PHILOX  2
+
+/* Binary ACE cache and snapshot file identifiers */
+
+#define ACE_CACHE_MAGIC "SSSACE01"
+#define SNAPSHOT_MAGIC  "SSSSNP01"
+
+/* Number of data arrays in snapshot file */
+
+#define SNAPSHOT_ARRAYS 7
+
 /* Extrapolation length for boundary distances */
 
 #define EXTRAP_L 1E-6
@@ -150,6 +168,7 @@ extern "C" {
 #define MAX_EGRID_NE             100000000
 #define MAX_PRECURSOR_GROUPS     8
 #define MAX_GEOMETRY_LEVELS      10000
+#define MAX_TET_WALK_STEPS       1000
 #define MAX_EXT_K_GEN            5
 #define MAX_GENERATIONS          1000000000
 
@@ -165,6 +184,14 @@ extern "C" {
 
 #define MAX_OMP_THREADS 1000
 
+/* Maximum number of materials burned together with CRAM */
+
+#define MAX_CRAM_BATCH 64
+
+/* Block size for packed macroscopic cross section sum */
+
+#define PACKED_XS_BLOCK 64
+
 /* Limiting values for parameters (used for sanity checks only) */
 
 #define MAX_XS       1E+12  /* Maximum microscopic cross section  */
@@ -251,6 +278,17 @@ extern "C" {
 #define STL_RAY_TEST_FAIL_STUCK  -5000
 #define STL_FACET_OVERLAP        -6000
 
+/* STL bounding volume hierarchy (maximum depth, number of SAH bins and */
+/* maximum number of facets in leaf node) */
+
+#define STL_BVH_MAX_DEPTH   64
+#define STL_BVH_BINS        16
+#define STL_BVH_LEAF_SIZE    4
+
+/* Maximum depth of k-d tree for point-average interfaces */
+
+#define IFC_KD_MAX_DEPTH    64
+
 /* XS data types */
 
 #define XS_TYPE_SAB         3
@@ -459,7 +497,7 @@ extern "C" {
 
 /* Timers */
 
-#define TOT_TIMERS                19
+#define TOT_TIMERS                24
 
 #define TIMER_TRANSPORT            1
 #define TIMER_TRANSPORT_ACTIVE     2
@@ -480,6 +518,11 @@ extern "C" {
 #define TIMER_MPI_OVERHEAD_TOTAL  17
 #define TIMER_FINIX               18
 #define TIMER_MISC                19
+#define TIMER_XS_READ             20
+#define TIMER_XS_BROADEN          21
+#define TIMER_XS_UNIONIZE         22
+#define TIMER_XS_PROCESS          23
+#define TIMER_XS_TMP              24
 
 /* Geometry errors */
 
@@ -495,6 +538,28 @@ extern "C" {
 #define MPI_METH_BC  1
 #define MPI_METH_RED 2
 
+/* MPI collective modes for results and buffer */
+
+#define MPI_COLL_MODE_BARRIER  0
+#define MPI_COLL_MODE_NB       1
+#define MPI_COLL_MODE_OVERLAP  2
+
+/* Nonblocking MPI collectives */
+
+#define MPI_COLL_RES1     0
+#define MPI_COLL_RES2     1
+#define MPI_COLL_BUF      2
+#define MPI_COLL_N        3
+
+#define MPI_COLL_MAX_REQ  64
+
+/* Binary output file */
+
+#define BINOUT_VERSION       1
+#define BINOUT_NAME_LEN      64
+#define BINOUT_MAX_DIM       12
+#define BINOUT_TYPE_DOUBLE   1
+
 /* Mesh types */
 
 #define MESH_TYPE_CARTESIAN    1
@@ -580,6 +645,14 @@ extern "C" {
 #define MEM_ALLOW    4
 #define MEM_DENY     5
 
+/* Material loops distributed by task scheduler */
+
+#define MAT_TASK_BURN      1
+#define MAT_TASK_BURN_CI   2
+#define MAT_TASK_TOTALS    3
+#define MAT_TASK_MAJORANT  4
+#define MAT_TASK_TMS_UPDATE 5
+
 /* Multi-physics interface types */
 
 
@@ -592,6 +665,7 @@ extern "C" {
 #define IFC_TYPE_OPENFOAM   7
 #define IFC_TYPE_OF_MAT     8
 #define IFC_TYPE_OF_SOLID   9
+#define IFC_TYPE_MOOSE      10
 
 /* OpenFOAM file types */
 
@@ -781,6 +855,173 @@ struct ccsMatrix{
 
 };
 
+/* Cached symbolic LU decomposition of burnup matrix (one per thread) */
+
+struct LUCache {
+
+  long n;                /* matrix size */
+  long nnz;              /* number of non-zeros in original matrix */
+
+  long *colptr;          /* column pointers of original matrix */
+  long *rowind;          /* row indexes of original matrix */
+  long *map;             /* positions of original non-zeros in LU */
+
+  struct ccsMatrix *LU;  /* matrix with fill-in and row indexes */
+
+  long wsz;              /* size of work array */
+  complex *work;         /* work array for batched solver */
+};
+
+/* Task deque of one thread in material loops (see ScheduleMatTasks()) */
+
+struct MatTaskDeque {
+
+  long head;             /* position of next own task */
+  long tail;             /* position after last task */
+  long cur;              /* material being processed */
+  long ntask;            /* number of processed tasks */
+  long nsteal;           /* number of stolen tasks */
+
+  double t0;             /* start time of current task */
+  double busy;           /* total time spent in tasks */
+
+#ifdef OPEN_MP
+  omp_lock_t lock;       /* lock shared by owner and thieves */
+#endif
+};
+
+struct MatTasks {
+
+  long type;             /* loop type */
+  long n;                /* number of tasks */
+  long nt;               /* number of deques */
+  long *mat;             /* material pointers, one slice per thread */
+
+  struct MatTaskDeque dq[MAX_OMP_THREADS];
+};
+
+/* Pending nonblocking reduction (see MPIStartReduce()) */
+
+struct MPIColl {
+
+  long nreq;             /* number of pending requests */
+  long sz;               /* size of reduced array */
+  double t0;             /* start time */
+
+  long ncall;            /* number of completed reductions */
+  double bytes;          /* total bytes reduced */
+  double time;           /* total time from start to completion */
+
+#ifdef MPI
+  MPI_Request req[MPI_COLL_MAX_REQ];
+#endif
+};
+
+/* Tasks sharing node memory (see ShareACEData()) */
+
+struct MPINode {
+
+  long shared;           /* ACE array is in shared window */
+  long merge;            /* main data pages marked for merging */
+  int id;                /* task index within node */
+  int tasks;             /* number of tasks within node */
+
+#ifdef MPI
+  MPI_Comm comm;         /* tasks within node */
+  MPI_Win win;           /* shared window for ACE array */
+#endif
+};
+
+/* Hash table of scores summed by bin (see SparseEntry()) */
+
+struct SparseTab {
+
+  long n;                /* number of used entries */
+  long sz;               /* table size (power of two) */
+  long *key;             /* bin indexes (-1 = empty) */
+  double *dat;           /* value, weight and number of scores */
+};
+
+/* Detector tallies decomposed between MPI tasks (see NewDecompStat()) */
+
+struct DecompFwd {
+
+  long n;                /* number of tables (one per statistics) */
+  struct SparseTab *tab; /* scores summed by bin (see SparseEntry()) */
+};
+
+struct DecompTally {
+
+  long n;                /* number of decomposed statistics */
+  double **gat;          /* statistics gathered to task 0 for output */
+
+  long ncall;            /* number of exchanges */
+  double bytes;          /* total bytes sent */
+  double time;           /* total time in exchange */
+
+  struct DecompFwd fwd[MAX_OMP_THREADS];
+};
+
+/* Sparse scoring buffer (see NewSparseStat()) */
+
+struct SparseBuf {
+
+  long n;                /* number of sparse statistics */
+  long nt;               /* number of tables per statistics */
+  struct SparseTab *tab; /* tables, index is statistics*nt + thread */
+};
+
+/* Binary output file (see BinaryOutput()). Frames are appended to the */
+/* file, each frame is a set of data blocks followed by an index and a  */
+/* tail pointing to the index. All fields are 8 bytes aligned.          */
+
+struct BinOutHead {
+
+  char magic[8];         /* "SSSBIN\0\0" */
+  long ver;              /* format version */
+};
+
+struct BinOutFrame {
+
+  char magic[8];         /* "SSSIDX\0\0" */
+  long prev;             /* offset of previous index (-1 = first) */
+  long frame;            /* frame number */
+  long coef;             /* coefficient calculation index */
+  long step;             /* burnup step */
+  long cycle;            /* cycle index */
+  long nds;              /* number of datasets */
+};
+
+struct BinOutIdx {
+
+  char name[BINOUT_NAME_LEN];   /* dataset name */
+  long type;                    /* data type */
+  long ndim;                    /* number of dimensions */
+  long dim[BINOUT_MAX_DIM];     /* dimensions, first index runs fastest */
+  long off;                     /* offset of data */
+  long sz;                      /* size of data in bytes */
+};
+
+struct BinOutTail {
+
+  long idx;              /* offset of frame index */
+  char magic[8];         /* "SSSEND\0\0" */
+};
+
+struct BinOut {
+
+  long nf;               /* number of frames */
+  long pos;              /* file size after queued frames */
+  long idx;              /* offset of last frame index */
+  long off;              /* offset of frame being written */
+  long busy;             /* writer thread running */
+  long err;              /* write error */
+  long sz;               /* size of frame being written */
+  char *buf;             /* frame being written */
+  char fname[MAX_STR];   /* file name */
+  pthread_t thr;         /* writer thread */
+};
+
 /* Data structure to store nuclide data in depletion files */
 
 struct depnuc {
@@ -805,6 +1046,8 @@ void AddBuf(double, double, long, long, long, ...);
 
 void AddBuf1D(double, double, long, long, long);
 
+void AddBufCache(long, double, double, long);
+
 void AddChains(long, long, long);
 
 void AddItem(long, long);
@@ -827,6 +1070,8 @@ void AddSortItem(long, long, long, long, long);
 
 void AddStableNuclides();
 
+void AddSparseBuf(double, double, long, long, long);
+
 void AddStat(double, long, ...);
 
 long AddSTLPoint(long ***, long, long, long, double, double, double);
@@ -882,6 +1127,10 @@ void B1Solver();
 
 void BanksToStore();
 
+void BinaryOutput();
+
+void *BinaryOutputThread(void *);
+
 long BoundaryConditions(long *, double *, double *, double *, double *,
 			double *, double *, double *, long);
 
@@ -890,6 +1139,12 @@ void BroadCrossSection(long, long, long, double, double, double, double *,
 
 void BsfunN(long, double *, double *, complex **, complex **, complex **);
 
+void BuildIFCPtKDTree(long);
+
+void BuildIFCPtLattice(long);
+
+long BuildSTLBVH(long *, long);
+
 double BufMean(long, ...);
 
 double BufN(long, ...);
@@ -924,6 +1179,8 @@ complex c_exp(complex);
 
 void CacheXS();
 
+struct ccsMatrix *CachedSymbolicLU(struct ccsMatrix *, long);
+
 void CalcMicroGroupXS();
 
 void CalculateActivities();
@@ -988,6 +1245,8 @@ void ClearPrivateRes();
 
 void ClearRelTransmuXS();
 
+void ClearSparseBuf();
+
 void ClearStat(long);
 
 void ClearTransmuXS();
@@ -1024,6 +1283,8 @@ void CollectPrecDet();
 
 void CollectResults();
 
+void CollectSparseBuf();
+
 void CollectVRMeshData();
 
 long Collision(long, long, double, double, double, double *, double *,
@@ -1062,10 +1323,16 @@ void CSplineInterpolate0(double *, double *, long, double, double, double *,
 
 double CylDis(double, double, double, double, double);
 
+unsigned long DataHash(const void *, long, unsigned long);
+
 void DecayMeshPrecDet();
 
 void DecayPointPrecDet();
 
+long DecompIdx(long, long);
+
+double *DecompStat(long);
+
 double DensityFactor(long, double, double, double, double, long);
 
 void DepletionPolyFit(long, long);
@@ -1137,16 +1404,26 @@ void Error(long, ...);
 
 void EstimateRuntime();
 
+void ExchangeScores();
+
 void ExpandPrivateArrays();
 
 long EventFromBank(long);
 
 void EventToBank(long);
 
+unsigned long FileStampHash(char *, unsigned long);
+
 double FillSTLMesh(long, long, double, double, double);
 
 void FinalizeMPI();
 
+void FinishBinaryOutput();
+
+void FinishMatBatch(long, long *, long);
+
+void FinishMatTasks();
+
 long FindTetCell(long, double, double, double, long);
 
 void FindInterfaceRegions(long, long, long, long, double, double, double, long);
@@ -1188,10 +1465,20 @@ void FixPolyhedMesh(long);
 
 void FlushBank();
 
+void FlushBufCache(long);
+
 void FlushPrecSource();
 
 void FormTransmuPaths(long, long, double, double, long, long);
 
+void ForwardScore(double, double, long, long, long);
+
+void FreeACE();
+
+void FreeDecompStat();
+
+void FreeLUCache();
+
 void FreeMem();
 
 long FromBank(long);
@@ -1206,6 +1493,8 @@ long FromTrkBank(long, long);
 
 long FromQue(long);
 
+void GatherDecompStat();
+
 long GaussianSubst(struct ccsMatrix *, complex *, complex *, complex *);
 
 void GetBankedPrecursors();
@@ -1219,6 +1508,8 @@ long GetLatticeIndexes(double, double, double, double, double, double, long *,
 
 long GetLineNumber(char *, long);
 
+double *GetMooseIFCPower(long *);
+
 char **GetParams(char *, char *, long *, long *, long, long, char *);
 
 double GetTemp(long, long);
@@ -1256,6 +1547,10 @@ char *IdxStr(long, long);
 
 void IFCPoint(long, double *, double *, long);
 
+double IFCPtAvgValue(long, double, double, double, double *, double *);
+
+long IFCPtLattice(long, double, double, double, double *, double *);
+
 long InCell(long, double, double, double, long, long);
 
 void InelasticScattering(long, double *, double *, double *, double *, long);
@@ -1318,6 +1613,8 @@ void LinkReactions();
 
 void LinkSabData();
 
+complex *LUCacheWork(long, long);
+
 void LUdecomposition(long, complex **, complex *, complex *);
 
 double MacroUresCorr(long, double, double, long);
@@ -1346,6 +1643,8 @@ void MaterialBurnup(long, double *, double *, double, double, long, long);
 
 void MaterialTotals();
 
+void MaterialTotals0(long);
+
 void MaterialVolumes();
 
 void MatlabOutput();
@@ -1356,6 +1655,9 @@ long MatPtr(long, long);
 
 double *MatrixExponential(struct ccsMatrix *, double *, double);
 
+void MatrixExponentialBatch(struct ccsMatrix **, double **, double *, long,
+			    double **);
+
 void MaxSurfDimensions(long, double *, double *, double *, double *,
 			  double *, double *);
 
@@ -1394,6 +1696,8 @@ double MeshTot(long);
 
 double MeshVal(long, double, double, double);
 
+void MergeMainData();
+
 double MGXS(long, double, long, long);
 
 void MicroCalc();
@@ -1413,13 +1717,19 @@ void MoveItemFirst(long);
 
 void MoveItemRight(long);
 
+void MoveListTail(long, long);
+
 long MoveST(long, double, double, long *, double *, double *, double *,
 	    double *, double *, double, double, double, long);
 
 void MoveStore();
 
+void MPIStartReduce(double *, long, long);
+
 void MPITransfer(double *, double *, long, long, long);
 
+void MPIWaitReduce(long);
+
 long MyParallelMat(long, long);
 
 double NearestBoundary(long);
@@ -1438,14 +1748,20 @@ double NearestUMSHSurf(long, double, double, double, double, double, double,
 
 void NestVolumes();
 
+long NewDecompStat(char *, long, long);
+
 long NewItem(long, long);
 
 long NewLIFOItem(long, long);
 
 void NewReaList(long, long);
 
+long NewSparseStat(char *, long, long);
+
 long NewStat(char *, long, ...);
 
+long NextMatTask(long);
+
 long NextReaction(long, long *, double *, double *, double *, long);
 
 long NextWord(char *, char *);
@@ -1466,6 +1782,9 @@ double Nubar(long, double, long);
 
 long NumericGauss(struct ccsMatrix *, complex *, complex, complex *);
 
+long NumericGaussBatch(struct ccsMatrix *, complex *, complex *, long,
+		       complex *, complex *);
+
 void Nxn(long, long, double *, double, double, double, double *, double *,
 	 double *, double, double *, double, double *, long);
 
@@ -1479,6 +1798,10 @@ void OTFSabScattering(long, double *, double *, double *, double *, long);
 
 void OverrideIDs();
 
+double PackedMacroXS(long, long, double, long);
+
+void PackReactionList(long);
+
 void PairProduction(long, long, long, double, double, double, double, double,
 		    double, double, double, double, long);
 
@@ -1487,6 +1810,8 @@ void parlett(long, complex *, complex **, complex **, complex **);
 long ParseCommandLine(int, char **);
 
 
+double Philox(unsigned long);
+
 void Photoelectric(long, long, long, double, double, double, double, double,
 		   double, double, double, double, long);
 
@@ -1703,6 +2028,11 @@ void PutCompositions();
 
 void PutMeshIdx(long, double, long, long, long);
 
+long PutMooseIFCFields(long, const double *, const double *);
+
+long PutMooseIFCMesh(long, const double *, long, const long *, const long *,
+		     const long *, long, const long *, long, const long *);
+
 void PutPoisonConc();
 
 long PutText(char *);
@@ -1725,8 +2055,12 @@ long ReactionTargetZAI(long);
 
 char *ReactionMT(long);
 
+long ReadACECache(long);
+
 void ReadACEFile(long);
 
+double *ReadBinaryOutput(char *, char *, long *);
+
 void ReadBRAFile();
 
 void ReadDecayFile();
@@ -1777,6 +2111,8 @@ void ReadPlasmaSrc(long);
 
 void ReadRestartFile(long);
 
+long ReadSnapshot();
+
 void ReadSourceFile(long, double *, double *, double *, double *, double *,
 		    double *, double *, double *, double *);
 
@@ -1801,6 +2137,8 @@ void ReduceBuffer();
 
 void ReducePrivateRes();
 
+void ReduceSparseBuf();
+
 void RefreshInventory();
 
 unsigned long ReInitRNG(long);
@@ -1868,6 +2206,8 @@ long SampleReaction(long, long, double, double, long);
 
 long SampleSrcPoint(long, long, long);
 
+void ScheduleMatTasks(long);
+
 void schurFactorization(long, complex **, complex **, complex **);
 
 void Score(long, long, double, double, double, double, double, double, double,
@@ -1953,6 +2293,8 @@ void SetPrecursorGroups();
 
 void SetSTLMeshPointers(long);
 
+void ShareACEData(long);
+
 void ShareInputData();
 
 void ShuntingYard(long, long *, long);
@@ -1969,6 +2311,10 @@ void SortArray(double *, long);
 
 void SortList(long, long, long);
 
+double *SparseBufVal(long, long);
+
+double *SparseEntry(struct SparseTab *, long, long);
+
 double Speed(long, double);
 
 void SrcDet(long, long, double, double, double, double, double, double,
@@ -1987,6 +2333,11 @@ double StdDev(long, ...);
 double STLFacetDistance(long, double, double, double, double, double, double,
 			long);
 
+double STLBVHDistance(long, double, double, double, double, double, double);
+
+long STLBVHRayTest(long, double, double, double, double, double, double, 
+		   long);
+
 void STLMatFinder();
 
 long STLRayTest(long, long, double, double, double, double, double, double,
@@ -2101,6 +2452,8 @@ double TotXS(long, long, double, long);
 
 void Tracking(long);
 
+void TrackingEvent(long);
+
 void TrackingError(long, double, long, long, long);
 
 long TrackMode(long, long, double, double, double, long, long);
@@ -2131,6 +2484,10 @@ void UniverseBoundaries();
 
 void UpdateCIStop(long, double*, long);
 
+void UpdateMooseIFC();
+
+void UpdateTmpMajorants();
+
 double UresDiluMicroXS(long, double, long);
 
 double UresFactor(long, double, long);
@@ -2156,6 +2513,8 @@ long VrTester(long, double, double, double, double, double, double, double,
 
 void VolumesMC();
 
+long WalkTetCell(long, long, double, double, double, long);
+
 void Warn(char *, ...);
 
 long WeightWindow(long, long, double, double, double, double, double, double,
@@ -2165,6 +2524,8 @@ long WhereAmI(double, double, double, double, double, double, long);
 
 double *WorkArray(long, long, long, long);
 
+void WriteACECache(long, char *, double);
+
 void WriteCIMomFluxes();
 
 void WriteDynSrc();
@@ -2175,6 +2536,8 @@ void WriteDepFile();
 
 void WriteICMData();
 
+void WriteSnapshot();
+
 void WriteSourceFile(long, double, double, double, double, double, double,
 		     double, double, double, double, long);
 
@@ -2264,6 +2627,7 @@ void ScoreInternaPower();
 #ifdef OPEN_MP
 
 #define OMP_THREAD_NUM omp_get_thread_num()
+#define OMP_IN_PARALLEL omp_in_parallel()
 
 #ifdef DEBUG
 
@@ -2282,6 +2646,7 @@ void PutPrivateData(long, double, long);
 #else
 
 #define OMP_THREAD_NUM 0
+#define OMP_IN_PARALLEL 0
 
 #ifdef DEBUG
 
@@ -2432,6 +2797,62 @@ struct Timer {
 
 extern struct Timer timer[TOT_TIMERS + 1];
 
+/* In-memory MOOSE interface (IFC_TYPE_MOOSE). Filled by MOOSE through */
+/* PutMooseIFCMesh() and PutMooseIFCFields() before the interface is   */
+/* read, power is written back by PrintInterfaceOutput(). Cells with  */
+/* changed fields are listed in chg for UpdateMooseIFC(), LMK          */
+
+struct MooseIFC {
+  long np;
+  double *pts;
+  long nf;
+  long *fidx;
+  long *fpts;
+  long *own;
+  long nnbr;
+  long *nbr;
+  long nc;
+  long *map;
+  double *T;
+  double *rho;
+  double *pwr;
+  long nchg;
+  long *chg;
+  long *flag;
+  long *cptr;
+  long *cidx;
+};
+
+extern struct MooseIFC mooseifc;
+
+/* Symbolic LU decompositions for CRAM */
+
+extern struct LUCache lucache[MAX_OMP_THREADS];
+
+/* Task deques for material loops */
+
+extern struct MatTasks mattasks;
+
+/* Nonblocking MPI collectives */
+
+extern struct MPIColl mpicoll[MPI_COLL_N];
+
+/* Tasks sharing node memory */
+
+extern struct MPINode mpinode;
+
+/* Decomposed detector tallies */
+
+extern struct DecompTally dtally;
+
+/* Sparse scoring buffer */
+
+extern struct SparseBuf spbuf;
+
+/* Binary output file */
+
+extern struct BinOut binout;
+
 /*****************************************************************************/
 #ifdef __cplusplus
 } // closing curly bracket
@@ -113,6 +113,7 @@ extern "C" {
 #define DATA_PTR_SFYDATA_FNAME_LIST     136
 #define DATA_PTR_BRADATA_FNAME_LIST     137
 #define DATA_PTR_XSTEST_FNAME           138
+#define DATA_PTR_ACE_CACHE_PATH         142
 
 /* Stuff for burnup calculation */
 
@@ -205,6 +206,7 @@ extern "C" {
 #define DATA_ERG_IMPORTANT_PTS          222
 #define DATA_ERG_PTR_UNIONIZED_NGRID    223
 #define DATA_ERG_PTR_UNIONIZED_PGRID    224
+#define DATA_ERG_HASH_NB                225
 
 /* Minimum and maximum energy allowed in transport calculation */
 
@@ -368,6 +370,14 @@ extern "C" {
 #define DATA_SOURCE_PT_ANIM_F           440
 #define DATA_SOURCE_PT_ANIM_PALETTE     441
 
+#define DATA_OPTI_EVENT_TRANSPORT       442
+#define DATA_OPTI_EVENT_BANK_SIZE       443
+
+#define DATA_RNG_TYPE                   444
+
+#define DATA_OPTI_BUF_CACHE_SIZE        445
+#define DATA_PTR_PRIVA_BUF_CACHE        446
+
 /* Delta-tracking */
 
 #define DATA_OPT_USE_DT                 450
@@ -747,6 +757,11 @@ extern "C" {
 #define DATA_TRACK_PLOT_NHIS           1104
 #define DATA_TRACK_PLOT_ANIM           1105
 
+/* Warm-start snapshot of processed data */
+
+#define DATA_PTR_SNAPSHOT_FNAME        1106
+#define DATA_SNAPSHOT_KEY              1107
+
 /* Pointers to pre-allocated work arrays */
 
 #define DATA_PTR_WORK_GRID1            1110
@@ -755,6 +770,7 @@ extern "C" {
 
 #define DATA_PTR_WORK_PRIVA_GRID1      1113
 #define DATA_PTR_WORK_PRIVA_GRID2      1114
+#define DATA_PTR_WORK_PRIVA_EVENT      1115
 
 /* Reaction sampling */
 
@@ -874,6 +890,39 @@ extern "C" {
 #define DATA_STL_GEOM_TEST_MODE        1273
 #define DATA_STL_FACET_EXD             1274
 #define DATA_STL_ENFORCE_DT            1275
+#define DATA_STL_BVH                    226
+
+/* Interpolation lattice size for point-average interfaces */
+
+#define DATA_IFC_PT_LATTICE_N           227
+
+/* MPI collective mode for results and buffer */
+
+#define DATA_OPTI_MPI_COLL_MODE         228
+
+/* ACE data shared by MPI tasks within node during processing */
+
+#define DATA_OPTI_SHARED_ACE            229
+
+/* Minimum number of bins in detector tallies decomposed between MPI tasks */
+
+#define DATA_OPTI_DECOMP_TALLY_MIN      230
+
+/* Results and detectors written to binary output file */
+
+#define DATA_BINARY_OUTPUT              231
+
+/* Secondary ques of event-based transport bank slots */
+
+#define DATA_PART_PTR_EVB_QUE           232
+
+/* Number of materials burned together with CRAM */
+
+#define DATA_BURN_CRAM_BATCH            233
+
+/* Minimum number of bins in detector tallies scored in sparse tables */
+
+#define DATA_OPTI_SPARSE_TALLY_MIN      234
 
 /* Global solution relaxation stuff */
 
@@ -1166,7 +1215,7 @@ extern "C" {
 
 /* TODO: N�it� nimi� pit�� seriously j�rkev�itt�� !!! */
 
-#define MATERIAL_BLOCK_SIZE            (LIST_DATA_SIZE + PARAM_N_COMMON + 142)
+#define MATERIAL_BLOCK_SIZE            (LIST_DATA_SIZE + PARAM_N_COMMON + 144)
 
 #define MATERIAL_OPTIONS               (LIST_DATA_SIZE + PARAM_N_COMMON + 0)
 #define MATERIAL_PTR_NAME              (LIST_DATA_SIZE + PARAM_N_COMMON + 1)
@@ -1308,6 +1357,8 @@ extern "C" {
 #define MATERIAL_SAMPLED_PHOTON_SRC    (LIST_DATA_SIZE + PARAM_N_COMMON + 139)
 #define MATERIAL_MAX_ADENS             (LIST_DATA_SIZE + PARAM_N_COMMON + 140)
 #define MATERIAL_PTR_TTB               (LIST_DATA_SIZE + PARAM_N_COMMON + 141)
+#define MATERIAL_TASK_TIME             (LIST_DATA_SIZE + PARAM_N_COMMON + 142)
+#define MATERIAL_TMS_UPDATE            (LIST_DATA_SIZE + PARAM_N_COMMON + 143)
 
 /*****************************************************************************/
 
@@ -1470,6 +1521,15 @@ extern "C" {
 #define BUF_WGT                      1
 #define BUF_N                        2
 
+/* Thread-private cache for shared scoring buffer */
+
+#define BUFC_BLOCK_SIZE              4
+
+#define BUFC_LOC                     0
+#define BUFC_VAL                     1
+#define BUFC_WGT                     2
+#define BUFC_N                       3
+
 /*****************************************************************************/
 
 /***** ACE data array ********************************************************/
@@ -1509,7 +1569,7 @@ extern "C" {
 /* NOTE: T�m� on bin��ripuurakenne joka ei k�yt� linkitetyn listan */
 /*       pointtereita tai rutiineja. */
 
-#define ENERGY_GRID_BLOCK_SIZE    16
+#define ENERGY_GRID_BLOCK_SIZE    18
 
 #define ENERGY_GRID_NE             0
 #define ENERGY_GRID_I0             1
@@ -1527,6 +1587,8 @@ extern "C" {
 #define ENERGY_GRID_PTR_PREV_VAL  13
 #define ENERGY_GRID_INTERP_MODE   14
 #define ENERGY_GRID_ALLOC_NE      15
+#define ENERGY_GRID_NH            16
+#define ENERGY_GRID_PTR_HASH      17
 
 /*****************************************************************************/
 
@@ -1612,12 +1674,16 @@ extern "C" {
 #define SAMPLE_LIST_PTR_REA     (LIST_DATA_SIZE + 1)
 #define SAMPLE_LIST_PTR_COUNT   (LIST_DATA_SIZE + 2)
 
-#define RLS_BLOCK_SIZE          (LIST_DATA_SIZE + 4)
+#define RLS_BLOCK_SIZE          (LIST_DATA_SIZE + 8)
 
 #define RLS_PTR_MAT             (LIST_DATA_SIZE + 0)
 #define RLS_REA_MODE            (LIST_DATA_SIZE + 1)
 #define RLS_PTR_REA0            (LIST_DATA_SIZE + 2)
 #define RLS_PTR_NEXT            (LIST_DATA_SIZE + 3)
+#define RLS_PTR_PACK            (LIST_DATA_SIZE + 4)
+#define RLS_PACK_NMAX           (LIST_DATA_SIZE + 5)
+#define RLS_PACK_N              (LIST_DATA_SIZE + 6)
+#define RLS_PACK_OK             (LIST_DATA_SIZE + 7)
 
 #define RLS_DATA_BLOCK_SIZE     (LIST_DATA_SIZE + 8)
 
@@ -1630,6 +1696,18 @@ extern "C" {
 #define RLS_DATA_MAX_ADENS      (LIST_DATA_SIZE + 6)
 #define RLS_DATA_CUT            (LIST_DATA_SIZE + 7)
 
+/* Packed reaction list (arrays of RLS_PACK_NMAX values) */
+
+#define RLS_PACK_VARIABLES      7
+
+#define RLS_PACK_PTR_ADENS      0
+#define RLS_PACK_PTR_EGRID      1
+#define RLS_PACK_PTR_XS         2
+#define RLS_PACK_XS_I0          3
+#define RLS_PACK_XS_NE          4
+#define RLS_PACK_WGT_F          5
+#define RLS_PACK_EMIN           6
+
 /*****************************************************************************/
 
 /***** Nubar data ************************************************************/
@@ -2241,7 +2319,7 @@ extern "C" {
 
 /***** STL based geometry ****************************************************/
 
-#define STL_BLOCK_SIZE            (LIST_DATA_SIZE + PARAM_N_COMMON + 20)
+#define STL_BLOCK_SIZE            (LIST_DATA_SIZE + PARAM_N_COMMON + 21)
 
 #define STL_PTR_NAME              (LIST_DATA_SIZE + PARAM_N_COMMON +  0)
 #define STL_PTR_UNI               (LIST_DATA_SIZE + PARAM_N_COMMON +  1)
@@ -2263,6 +2341,7 @@ extern "C" {
 #define STL_MERGE_RAD             (LIST_DATA_SIZE + PARAM_N_COMMON + 17)
 #define STL_SEARCH_MESH_CELLS     (LIST_DATA_SIZE + PARAM_N_COMMON + 18)
 #define STL_SEARCH_MODE           (LIST_DATA_SIZE + PARAM_N_COMMON + 19)
+#define STL_PTR_BVH               (LIST_DATA_SIZE + PARAM_N_COMMON + 20)
 
 #define STL_FILE_BLOCK_SIZE       (LIST_DATA_SIZE + 6)
 
@@ -2284,7 +2363,7 @@ extern "C" {
 #define STL_BODY_N_POINTS         (LIST_DATA_SIZE + 6)
 #define STL_BODY_N_FACETS         (LIST_DATA_SIZE + 7)
 
-#define STL_SOLID_BLOCK_SIZE      (LIST_DATA_SIZE + 14)
+#define STL_SOLID_BLOCK_SIZE      (LIST_DATA_SIZE + 15)
 
 #define STL_SOLID_PTR_STL_NAME    (LIST_DATA_SIZE +  0)
 #define STL_SOLID_PTR_FNAME       (LIST_DATA_SIZE +  1)
@@ -2300,6 +2379,7 @@ extern "C" {
 #define STL_SOLID_ZMAX            (LIST_DATA_SIZE + 11)
 #define STL_SOLID_PTR_BODY        (LIST_DATA_SIZE + 12)
 #define STL_SOLID_REG_IDX         (LIST_DATA_SIZE + 13)
+#define STL_SOLID_PTR_BVH         (LIST_DATA_SIZE + 14)
 
 #define STL_POINT_BLOCK_SIZE       (LIST_DATA_SIZE + 3)
 
@@ -2330,6 +2410,39 @@ extern "C" {
 #define STL_SEARCH_MESH_CONTENT_PTR_FACETS  0
 #define STL_SEARCH_MESH_CONTENT_PTR_SOLIDS  1
 
+/* Bounding volume hierarchy over STL facets */
+
+#define STL_BVH_BLOCK_SIZE         4
+
+#define STL_BVH_N_NODES            0
+#define STL_BVH_PTR_NODES          1
+#define STL_BVH_N_TRI              2
+#define STL_BVH_PTR_TRI            3
+
+#define STL_BVH_NODE_BLOCK_SIZE    8
+
+#define STL_BVH_NODE_XMIN          0
+#define STL_BVH_NODE_XMAX          1
+#define STL_BVH_NODE_YMIN          2
+#define STL_BVH_NODE_YMAX          3
+#define STL_BVH_NODE_ZMIN          4
+#define STL_BVH_NODE_ZMAX          5
+#define STL_BVH_NODE_PTR           6
+#define STL_BVH_NODE_N             7
+
+#define STL_BVH_TRI_BLOCK_SIZE    10
+
+#define STL_BVH_TRI_X0             0
+#define STL_BVH_TRI_Y0             1
+#define STL_BVH_TRI_Z0             2
+#define STL_BVH_TRI_E1X            3
+#define STL_BVH_TRI_E1Y            4
+#define STL_BVH_TRI_E1Z            5
+#define STL_BVH_TRI_E2X            6
+#define STL_BVH_TRI_E2Y            7
+#define STL_BVH_TRI_E2Z            8
+#define STL_BVH_TRI_PTR_FACET      9
+
 /*****************************************************************************/
 
 /***** Search mesh ***********************************************************/
@@ -2345,7 +2458,7 @@ extern "C" {
 
 /***** Multi-physics interface ***********************************************/
 
-#define IFC_BLOCK_SIZE                (LIST_DATA_SIZE + PARAM_N_COMMON + 78)
+#define IFC_BLOCK_SIZE                (LIST_DATA_SIZE + PARAM_N_COMMON + 82)
 
 #define IFC_IDX                       (LIST_DATA_SIZE + PARAM_N_COMMON +  0)
 #define IFC_DIM                       (LIST_DATA_SIZE + PARAM_N_COMMON +  1)
@@ -2425,6 +2538,10 @@ extern "C" {
 #define IFC_NF_PRNTS                  (LIST_DATA_SIZE + PARAM_N_COMMON + 75)
 #define IFC_NC                        (LIST_DATA_SIZE + PARAM_N_COMMON + 76)
 #define IFC_NF                        (LIST_DATA_SIZE + PARAM_N_COMMON + 77)
+#define IFC_IN_MEMORY                 (LIST_DATA_SIZE + PARAM_N_COMMON + 78)
+#define IFC_PTR_KD_TREE               (LIST_DATA_SIZE + PARAM_N_COMMON + 79)
+#define IFC_PTR_LATTICE               (LIST_DATA_SIZE + PARAM_N_COMMON + 80)
+#define IFC_PTR_OF_MAPFILE            (LIST_DATA_SIZE + PARAM_N_COMMON + 81)
 
 /* Points */
 
@@ -2436,6 +2553,31 @@ extern "C" {
 #define IFC_PT_DF                     (LIST_DATA_SIZE + 3)
 #define IFC_PT_TMP                    (LIST_DATA_SIZE + 4)
 
+/* K-d tree over points (implicit balanced tree, median of each range */
+/* is the splitting node) */
+
+#define IFC_KD_BLOCK_SIZE             4
+
+#define IFC_KD_X                      0
+#define IFC_KD_Y                      1
+#define IFC_KD_Z                      2
+#define IFC_KD_PTR_PT                 3
+
+/* Interpolation lattice for point average */
+
+#define IFC_LAT_BLOCK_SIZE           10
+
+#define IFC_LAT_NX                    0
+#define IFC_LAT_NY                    1
+#define IFC_LAT_NZ                    2
+#define IFC_LAT_XMIN                  3
+#define IFC_LAT_XMAX                  4
+#define IFC_LAT_YMIN                  5
+#define IFC_LAT_YMAX                  6
+#define IFC_LAT_ZMIN                  7
+#define IFC_LAT_ZMAX                  8
+#define IFC_LAT_PTR_DATA              9
+
 /* Type 2: Regular mesh */
 
 #define IFC_REG_MSH_LIST_BLOCK_SIZE    (LIST_DATA_SIZE + 2)
@@ -2807,7 +2949,7 @@ extern "C" {
 
 /***** Detector array ********************************************************/
 
-#define DET_BLOCK_SIZE                (LIST_DATA_SIZE + PARAM_N_COMMON + 37)
+#define DET_BLOCK_SIZE                (LIST_DATA_SIZE + PARAM_N_COMMON + 38)
 
 #define DET_PTR_NAME                  (LIST_DATA_SIZE + PARAM_N_COMMON +  0)
 #define DET_TYPE                      (LIST_DATA_SIZE + PARAM_N_COMMON +  1)
@@ -2844,6 +2986,7 @@ extern "C" {
 #define DET_DIRVEC_V                  (LIST_DATA_SIZE + PARAM_N_COMMON + 34)
 #define DET_DIRVEC_W                  (LIST_DATA_SIZE + PARAM_N_COMMON + 35)
 #define DET_WRITE_BINARY              (LIST_DATA_SIZE + PARAM_N_COMMON + 36)
+#define DET_SPARSE                    (LIST_DATA_SIZE + PARAM_N_COMMON + 37)
 
 /* Detector reaction bin */
 
@@ -3035,7 +3178,7 @@ extern "C" {
 
 /***** Score block ***********************************************************/
 
-#define SCORE_BLOCK_SIZE  (LIST_DATA_SIZE + 7)
+#define SCORE_BLOCK_SIZE  (LIST_DATA_SIZE + 11)
 
 #define SCORE_PTR_NAME    (LIST_DATA_SIZE + 0)
 #define SCORE_DIM         (LIST_DATA_SIZE + 1)
@@ -3044,6 +3187,10 @@ extern "C" {
 #define SCORE_PTR_BUF     (LIST_DATA_SIZE + 4)
 #define SCORE_STAT_SIZE   (LIST_DATA_SIZE + 5)
 #define SCORE_PTR_HIS     (LIST_DATA_SIZE + 6)
+#define SCORE_DECOMP_SLAB (LIST_DATA_SIZE + 7)
+#define SCORE_DECOMP_IDX  (LIST_DATA_SIZE + 8)
+#define SCORE_SPARSE      (LIST_DATA_SIZE + 9)
+#define SCORE_SPARSE_IDX  (LIST_DATA_SIZE + 10)
 
 /*****************************************************************************/
 
@@ -3163,6 +3310,42 @@ extern "C" {
 #define PARTICLE_COL_IDX          (LIST_DATA_SIZE + 36)
 #define PARTICLE_MULTIPLICITY     (LIST_DATA_SIZE + 37)
 
+/* Particle bank in event-based transport (structure of arrays, each */
+/* variable is stored for all particles in bank, see TrackingEvent()) */
+
+#define EVB_VARIABLES  30
+
+#define EVB_PART        0
+#define EVB_TYPE        1
+#define EVB_CELL        2
+#define EVB_MAT         3
+#define EVB_TRK         4
+#define EVB_LOOP        5
+#define EVB_LMAX        6
+#define EVB_GMAX        7
+#define EVB_SEED        8
+#define EVB_X           9
+#define EVB_Y          10
+#define EVB_Z          11
+#define EVB_U          12
+#define EVB_V          13
+#define EVB_W          14
+#define EVB_E          15
+#define EVB_WGT        16
+#define EVB_T          17
+#define EVB_X0         18
+#define EVB_Y0         19
+#define EVB_Z0         20
+#define EVB_SPD        21
+#define EVB_MINXS      22
+#define EVB_TOTXS      23
+#define EVB_MAJ        24
+#define EVB_XS         25
+#define EVB_COL_QUE    26
+#define EVB_SURF_QUE   27
+#define EVB_NCOL       28
+#define EVB_DT_FORCE   29
+
 /* History data */
 
 #define HIST_BLOCK_SIZE           (LIST_DATA_SIZE + 14)
@@ -0,0 +1,68 @@
+#ifndef ELEMENTINDEX_H
+#define ELEMENTINDEX_H
+
+// This is a general user object, it does not loop over anything
+
+#include "GeneralUserObject.h"
+
+class ElementIndex;
+
+template<>
+InputParameters validParams<ElementIndex>();
+
+// This class maps libMesh element ids to Serpent output indices and back.
+// The output indices are the active elements sorted by id. The index is
+// built once and kept until the mesh changes.
+
+class ElementIndex : public GeneralUserObject
+{
+public:
+  // Constructor
+  ElementIndex(const InputParameters & parameters);
+
+  virtual void initialize();
+
+  virtual void execute();
+
+  virtual void finalize();
+
+  /**
+   * Called when the mesh has been adapted, the index is rebuilt on next use.
+   */
+  virtual void meshChanged();
+
+  /* Builds the index if it is not up to date. This is collective, */
+  /* call on all processors. */
+
+  void update() const;
+
+  /* Number of active elements / Serpent cells */
+
+  long nElems() const { return _elem_ids.size(); }
+
+  /* Element id of output index */
+
+  long elemId(long out_idx) const { return _elem_ids[out_idx]; }
+
+  /* Output index of element id, -1 for elements that are not active */
+
+  long outIdx(dof_id_type elem_id) const { return _out_idx[elem_id]; }
+
+  /* Output indices of the local active elements of all processors in */
+  /* the order they are gathered (processor by processor, each in the */
+  /* active_local_elements order) */
+
+  const std::vector<long> & gatherOrder() const { return _gather_order; }
+
+protected:
+
+  mutable bool _valid;
+
+  mutable std::vector<long> _elem_ids;
+
+  mutable std::vector<long> _out_idx;
+
+  mutable std::vector<long> _gather_order;
+};
+
+#endif
@@ -3,6 +3,7 @@
 
 // This is an elemental user object
 #include "ElementIntegralVariablePostprocessor.h"
+#include "ElementIndex.h"
 #include <iostream>
 #include <fstream>
 
@@ -25,6 +26,26 @@ public:
 
   void printNodes() const;
 
+  /* Writes the mesh to files or passes it to Serpent in memory */
+  /* depending on the in_memory parameter */
+
+  void transferNodes() const;
+
+  /* Passes mesh and fields to the in-memory interface (no mesh files) */
+
+  void sendNodes() const;
+
+  /* Writes or passes only temperatures and densities, the mesh */
+  /* topology is sent once with transferNodes() */
+
+  void transferFields() const;
+
+  void printFields() const;
+
+  void sendFields() const;
+
+  bool inMemory() const { return _in_memory; }
+
   /**
    * This is called before execute so you can reset any internal data.
    */
@@ -46,11 +67,40 @@ public:
 
 protected:
 
-  Real *_integral_value_array;
-  
-  Real *_volume_value_array;
+  /* Mesh and fields in the Serpent (OpenFOAM) ordering, cells are the */
+  /* active elements sorted by id and faces with a neighbor come first */
+
+  struct SerpentMesh
+  {
+    std::vector<long> node_ids;
+    std::vector<double> pts;
+    std::vector<long> fidx, fpts, own, nbr;
+    std::vector<double> T, rho;
+    std::vector<long> topo, topo_idx;
+  };
+
+  /* Packs the local active elements and collects them from all */
+  /* processors, to all processors or to processor 0 only */
+
+  void gatherMesh(SerpentMesh & msh, bool all) const;
+
+  /* Collects only the element averages in the same ordering */
+
+  void gatherFields(SerpentMesh & msh, bool all) const;
+
+  bool _in_memory;
+
+  /* Element id <-> output index map, shared with HeatToMoose */
+
+  const ElementIndex & _element_index;
+
+  /* Integrals, volumes and averages of local elements */
+
+  std::map<dof_id_type, Real> _integral_value_array;
+
+  std::map<dof_id_type, Real> _volume_value_array;
 
-  Real *_average_value_array;
+  std::map<dof_id_type, Real> _average_value_array;
 };
 
 #endif
@@ -4,6 +4,7 @@
 // This is a general user object, so that we can do anything
 
 #include "GeneralUserObject.h"
+#include "ElementIndex.h"
 
 class HeatToMoose;
 
@@ -34,11 +35,24 @@ public:
    */
   virtual void finalize();
 
-  Real heatValue(const int) const;
+  /* Power density in element, indexed by element id */
+
+  Real powerDensity(const dof_id_type elem_id) const { return _value_array[elem_id]; }
 
 private:
 
-  Real *_value_array;
+  bool _in_memory;
+
+  /* Binary output file and interface dataset (empty = not used) */
+
+  const FileName _binary_file;
+  const std::string _binary_dataset;
+
+  /* Element id <-> output index map, shared with ElementTransfer */
+
+  const ElementIndex & _element_index;
+
+  std::vector<Real> _value_array;
 };
 
 #endif
@@ -18,7 +18,7 @@ serpent_app_objects := $(patsubst %.c, %.$(obj-suffix), $(SERPENT_SRC_DIR)/main.
 serpent_INCLUDE := $(foreach i, $(SERPENT_INC_DIR), -I$(i))
 libmesh_INCLUDE := $(serpent_INCLUDE) $(libmesh_INCLUDE)
 
-serpent_FLAGS := -fopenmp -lgd -lm
+serpent_FLAGS := -fopenmp -lgd -lm -lpthread
 
 ifneq ($(wildcard $(CURDIR)/contrib/triangle/triangle.c),)
   TRIANGLE_DIR ?= $(CURDIR)/contrib/triangle
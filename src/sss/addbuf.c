@@ -113,6 +113,10 @@ void AddBuf(double val, double wgt, long ptr, long id, long idx, ...)
 #endif      
     }
 
+  /* Variable arguments are not needed after this (before any return) */
+
+  va_end(argp);
+
   /****************************************************************************/
 
   /***** Access data **********************************************************/
@@ -133,6 +137,31 @@ void AddBuf(double val, double wgt, long ptr, long id, long idx, ...)
 
 #endif
 
+  /* Check decomposed statistics */
+
+  if ((long)RDB[ptr + SCORE_DECOMP_SLAB] > 0)
+    {
+      /* Forward scores to bins owned by other tasks */
+
+      if ((i = DecompIdx(ptr, idx)) < 0)
+	{
+	  ForwardScore(val, wgt, ptr, id, idx);
+	  return;
+	}
+
+      /* Index within own slab */
+
+      idx = i;
+    }
+
+  /* Sparse buffer */
+
+  if ((long)RDB[ptr + SCORE_SPARSE] == YES)
+    {
+      AddSparseBuf(val, wgt, ptr, id, idx);
+      return;
+    }
+
   /* Get pointer to buffer */
 
   loc0 = (long)RDB[ptr + SCORE_PTR_BUF];
@@ -152,22 +181,30 @@ void AddBuf(double val, double wgt, long ptr, long id, long idx, ...)
 
   if ((long)RDB[DATA_OPTI_SHARED_BUF] == YES)
     {
-      /* Shared buffer, put data */
+      /* Shared buffer, use thread-private cache in parallel regions */
+
+      if (((long)RDB[DATA_PTR_PRIVA_BUF_CACHE] > VALID_PTR) && 
+	  (OMP_IN_PARALLEL))
+	AddBufCache(loc0, wgt*val, wgt, id);
+      else
+	{
+	  /* Put data */
 
 #ifdef OPEN_MP
 #pragma omp atomic
 #endif
-      BUF[loc0 + BUF_VAL] += wgt*val;
+	  BUF[loc0 + BUF_VAL] += wgt*val;
 
 #ifdef OPEN_MP
 #pragma omp atomic
 #endif
-      BUF[loc0 + BUF_WGT] += wgt;
+	  BUF[loc0 + BUF_WGT] += wgt;
 
 #ifdef OPEN_MP
 #pragma omp atomic
 #endif
-      BUF[loc0 + BUF_N] += 1.0;
+	  BUF[loc0 + BUF_N] += 1.0;
+	}
     }
   else
     {
@@ -0,0 +1,103 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : addbufcache.c                                  */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Adds value to thread-private cache of shared scoring buffer  */
+/*                                                                           */
+/* Comments: - Called from AddBuf() and AddBuf1D() inside parallel regions   */
+/*             when shared buffer is used. Repeated scores to the same bin   */
+/*             are summed without atomic operations, and the shared buffer   */
+/*             is updated only when the slot is taken by another bin.        */
+/*                                                                           */
+/*           - The cache is direct-mapped by bin index. Remaining data is    */
+/*             added to the buffer by FlushBufCache(), called from           */
+/*             ReduceBuffer() and ClearBuf().                                */
+/*                                                                           */
+/*           - Only used with the shared buffer. The per-thread buffer is    */
+/*             not affected. Large detectors can be scored in thread-        */
+/*             private sparse tables instead of BUF in both modes (see       */
+/*             NewSparseStat()).                                             */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "AddBufCache:"
+
+/*****************************************************************************/
+
+void AddBufCache(long loc0, double val, double wgt, long id)
+{
+  long ptr, nc, loc1;
+  double *dat;
+
+  /* Get pointer to cache and number of slots */
+
+  ptr = (long)RDB[DATA_PTR_PRIVA_BUF_CACHE];
+  CheckPointer(FUNCTION_NAME, "(ptr)", PRIVA_ARRAY, ptr);
+
+  nc = (long)RDB[DATA_OPTI_BUF_CACHE_SIZE];
+  CheckValue(FUNCTION_NAME, "nc", "", nc, 1, 1000000);
+
+  /* Pointer to slot */
+
+  dat = &PRIVA[ptr + id*(long)RDB[DATA_REAL_PRIVA_SIZE]
+	       + ((loc0/BUF_BLOCK_SIZE) % nc)*BUFC_BLOCK_SIZE];
+
+  /* Check if slot is used for the same bin */
+
+  if ((loc1 = (long)dat[BUFC_LOC]) == loc0)
+    {
+      /* Add to cached values */
+
+      dat[BUFC_VAL] += val;
+      dat[BUFC_WGT] += wgt;
+      dat[BUFC_N] += 1.0;
+
+      /* Exit subroutine */
+
+      return;
+    }
+
+  /* Move previous data to shared buffer */
+
+  if (loc1 > VALID_PTR)
+    {
+      CheckPointer(FUNCTION_NAME, "(loc1)", BUF_ARRAY, loc1);
+
+#ifdef OPEN_MP
+#pragma omp atomic
+#endif
+      BUF[loc1 + BUF_VAL] += dat[BUFC_VAL];
+
+#ifdef OPEN_MP
+#pragma omp atomic
+#endif
+      BUF[loc1 + BUF_WGT] += dat[BUFC_WGT];
+
+#ifdef OPEN_MP
+#pragma omp atomic
+#endif
+      BUF[loc1 + BUF_N] += dat[BUFC_N];
+    }
+
+  /* Put new bin in slot */
+
+  dat[BUFC_LOC] = (double)loc0;
+  dat[BUFC_VAL] = val;
+  dat[BUFC_WGT] = wgt;
+  dat[BUFC_N] = 1.0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,60 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : addsparsebuf.c                                 */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Adds score to sparse scoring buffer                          */
+/*                                                                           */
+/* Comments: - Called from AddBuf() and AddBuf1D() for statistics created    */
+/*             by NewSparseStat(). Each thread scores in its own table.      */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "AddSparseBuf:"
+
+/*****************************************************************************/
+
+void AddSparseBuf(double val, double wgt, long ptr, long id, long idx)
+{
+  long k;
+  double *dat;
+
+  /* Check pointer and id */
+
+  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+  CheckValue(FUNCTION_NAME, "id", "", id, 0, spbuf.nt - 1);
+
+  /* Check that buffer is not reduced */
+
+  if ((long)RDB[DATA_BUF_REDUCED] == YES)
+    Die(FUNCTION_NAME, "Trying to add to reduced buffer");
+
+  /* Get index to tables */
+
+  k = (long)RDB[ptr + SCORE_SPARSE_IDX];
+  CheckValue(FUNCTION_NAME, "k", "", k, 0, spbuf.n - 1);
+
+  /* Get entry in thread table */
+
+  dat = SparseEntry(&spbuf.tab[k*spbuf.nt + id], idx, YES);
+
+  /* Add data */
+
+  dat[BUF_VAL] += wgt*val;
+  dat[BUF_WGT] += wgt;
+  dat[BUF_N] += 1.0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -100,6 +100,12 @@ void AddStat(double val, long ptr, ...)
 
 #endif
 
+  /* Bins of decomposed statistics owned by other tasks are skipped */
+
+  if ((long)RDB[ptr + SCORE_DECOMP_SLAB] > 0)
+    if ((idx = DecompIdx(ptr, idx)) < 0)
+      return;
+
   /* Get pointer to statistics */
 
   stp = (long)RDB[ptr + SCORE_PTR_DATA] + idx*STAT_BLOCK_SIZE;
@@ -80,6 +80,11 @@ void AdjustEnergyGrid(long erg, long ne, const double *E)
   WDB[erg + ENERGY_GRID_PTR_HIGH] = NULLPTR;
   WDB[erg + ENERGY_GRID_PTR_BINS] = NULLPTR;
 
+  /* Hash table is no longer valid */
+
+  WDB[erg + ENERGY_GRID_NH] = 0.0;
+  WDB[erg + ENERGY_GRID_PTR_HASH] = NULLPTR;
+
   /* Reset mid-point energy and number of bins */
 
   WDB[erg + ENERGY_GRID_EMID] = -1.0;
@@ -0,0 +1,411 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : binaryoutput.c                                 */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Appends results and detectors to binary output file          */
+/*                                                                           */
+/* Comments: - Called after DetectorOutput(). Each call appends one frame    */
+/*             with the mean values and relative errors of all statistics    */
+/*             (same names as in the output files) and interface results     */
+/*             as datasets "IFC<idx>" (relaxed power in coupled              */
+/*             calculation, same as PrintInterfaceOutput()).                 */
+/*           - Frame is built in memory and written by a separate thread,    */
+/*             the previous frame is completed before starting a new one.    */
+/*           - Data is stored with the mean and relative error as the first  */
+/*             (fastest) index, followed by the bins of the statistics. The  */
+/*             index is at the end of the frame and it is linked to the      */
+/*             index of the previous frame, so that the file can be read     */
+/*             with mmap() without parsing (see ReadBinaryOutput()).         */
+/*           - Called in all tasks. Decomposed statistics are gathered to    */
+/*             task 0 for the frame and freed after it is built.             */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "BinaryOutput:"
+
+/*****************************************************************************/
+
+void BinaryOutput()
+{
+  long loc0, loc1, ptr, dim, nds, i, j, n, c, idx, ntot, sz, tot, m, *lst;
+  long *rel;
+  int ix[10];
+  double *dat;
+  char *buf;
+  struct BinOutHead *head;
+  struct BinOutFrame *frm;
+  struct BinOutIdx *ent;
+  struct BinOutTail *tail;
+
+  /* Check option */
+
+  if ((long)RDB[DATA_BINARY_OUTPUT] == NO)
+    return;
+
+  /* Check if in active cycles */
+
+  if (RDB[DATA_CYCLE_IDX] < RDB[DATA_CRIT_SKIP])
+    return;
+
+  /* Check corrector step */
+
+  if ((long)RDB[DATA_BURN_STEP_PC] == CORRECTOR_STEP)
+    return;
+
+  /* Gather decomposed statistics to task 0 */
+
+  GatherDecompStat();
+
+  /* Check mpi task */
+
+  if (mpiid > 0)
+    return;
+
+  /* Complete previous frame */
+
+  FinishBinaryOutput();
+
+  /***************************************************************************/
+
+  /***** Count datasets ******************************************************/
+
+  /* Reset number of datasets and size of data */
+
+  nds = 0;
+  sz = 0;
+
+  /* Loop over statistics (distributed arrays are not included) */
+
+  loc0 = (long)RDB[DATA_PTR_SCORE0];
+  while (loc0 > VALID_PTR)
+    {
+      if ((long)RDB[loc0 + SCORE_DIM] > 0)
+	{
+	  nds++;
+	  sz = sz + 2*(long)RDB[loc0 + SCORE_STAT_SIZE]*sizeof(double);
+	}
+
+      /* Next */
+
+      loc0 = NextItem(loc0);
+    }
+
+  /* Loop over interfaces */
+
+  loc0 = (long)RDB[DATA_PTR_IFC0];
+  while (loc0 > VALID_PTR)
+    {
+      if ((ptr = (long)RDB[loc0 + IFC_PTR_STAT]) > VALID_PTR)
+	if ((long)RDB[ptr + SCORE_DIM] > 0)
+	  {
+	    nds++;
+	    sz = sz + 2*(long)RDB[ptr + SCORE_STAT_SIZE]*sizeof(double);
+	  }
+
+      /* Next */
+
+      loc0 = NextItem(loc0);
+    }
+
+  /* Check */
+
+  if (nds == 0)
+    {
+      FreeDecompStat();
+      return;
+    }
+
+  /* Total size of frame (file header is written with first frame) */
+
+  tot = sz + sizeof(struct BinOutFrame) + nds*sizeof(struct BinOutIdx)
+    + sizeof(struct BinOutTail);
+
+  if (binout.nf == 0)
+    tot = tot + sizeof(struct BinOutHead);
+
+  /* Allocate memory for frame, statistics pointers and pointers to */
+  /* relaxed interface power */
+
+  buf = (char *)Mem(MEM_ALLOC, tot, sizeof(char));
+  lst = (long *)Mem(MEM_ALLOC, nds, sizeof(long));
+  rel = (long *)Mem(MEM_ALLOC, nds, sizeof(long));
+
+  /***************************************************************************/
+
+  /***** Set pointers ********************************************************/
+
+  /* File header */
+
+  m = 0;
+
+  if (binout.nf == 0)
+    {
+      /* Set file name */
+
+      sprintf(binout.fname, "%s_res.bin", GetText(DATA_PTR_INPUT_FNAME));
+
+      /* Put header */
+
+      head = (struct BinOutHead *)buf;
+      memcpy(head->magic, "SSSBIN\0\0", 8);
+      head->ver = BINOUT_VERSION;
+
+      m = sizeof(struct BinOutHead);
+    }
+
+  /* Index and tail are written after data */
+
+  frm = (struct BinOutFrame *)&buf[m + sz];
+  ent = (struct BinOutIdx *)&buf[m + sz + sizeof(struct BinOutFrame)];
+  tail = (struct BinOutTail *)&buf[tot - sizeof(struct BinOutTail)];
+
+  /***************************************************************************/
+
+  /***** Set names ***********************************************************/
+
+  /* Loop over statistics */
+
+  i = 0;
+
+  loc0 = (long)RDB[DATA_PTR_SCORE0];
+  while (loc0 > VALID_PTR)
+    {
+      if ((long)RDB[loc0 + SCORE_DIM] > 0)
+	{
+	  /* Count previous statistics with same name (interfaces */
+	  /* and some other variables are defined more than once) */
+
+	  c = 0;
+
+	  for (j = 0; j < i; j++)
+	    if (!strcmp(GetText(lst[j] + SCORE_PTR_NAME),
+			GetText(loc0 + SCORE_PTR_NAME)))
+	      c++;
+
+	  /* Put name */
+
+	  if (c == 0)
+	    snprintf(ent[i].name, BINOUT_NAME_LEN, "%s",
+		     GetText(loc0 + SCORE_PTR_NAME));
+	  else
+	    snprintf(ent[i].name, BINOUT_NAME_LEN, "%s_%ld",
+		     GetText(loc0 + SCORE_PTR_NAME), c + 1);
+
+	  /* Put pointers */
+
+	  rel[i] = -1;
+	  lst[i++] = loc0;
+	}
+
+      /* Next */
+
+      loc0 = NextItem(loc0);
+    }
+
+  /* Loop over interfaces (same variable name as in the m-file) */
+
+  loc0 = (long)RDB[DATA_PTR_IFC0];
+  while (loc0 > VALID_PTR)
+    {
+      if ((ptr = (long)RDB[loc0 + IFC_PTR_STAT]) > VALID_PTR)
+	if ((long)RDB[ptr + SCORE_DIM] > 0)
+	  {
+	    snprintf(ent[i].name, BINOUT_NAME_LEN, "IFC%ld",
+		     (long)RDB[loc0 + IFC_IDX]);
+
+	    /* Coupled calculation uses relaxed power (same as in */
+	    /* PrintInterfaceOutput()) */
+
+	    if ((long)RDB[DATA_RUN_CC] == YES)
+	      {
+		rel[i] = (long)RDB[loc0 + IFC_PTR_STAT_REL];
+		CheckPointer(FUNCTION_NAME, "(rel)", DATA_ARRAY, rel[i]);
+	      }
+	    else
+	      rel[i] = -1;
+
+	    lst[i++] = ptr;
+	  }
+
+      /* Next */
+
+      loc0 = NextItem(loc0);
+    }
+
+  /* Check count */
+
+  if (i != nds)
+    Die(FUNCTION_NAME, "Mismatch in number of datasets");
+
+  /***************************************************************************/
+
+  /***** Write data **********************************************************/
+
+  /* Loop over datasets */
+
+  for (i = 0; i < nds; i++)
+    {
+      /* Pointer to statistics */
+
+      ptr = lst[i];
+
+      /* Get dimension */
+
+      dim = (long)RDB[ptr + SCORE_DIM];
+      CheckValue(FUNCTION_NAME, "dim", "", dim, 1, 10);
+
+      /* Put type and dimensions */
+
+      ent[i].type = BINOUT_TYPE_DOUBLE;
+      ent[i].ndim = dim + 1;
+      ent[i].dim[0] = 2;
+
+      ntot = 1;
+
+      loc1 = (long)RDB[ptr + SCORE_PTR_NMAX];
+      CheckPointer(FUNCTION_NAME, "(loc1)", DATA_ARRAY, loc1);
+
+      for (n = 0; n < dim; n++)
+	{
+	  ent[i].dim[n + 1] = (long)RDB[loc1 + n];
+	  ntot = ntot*ent[i].dim[n + 1];
+	}
+
+      /* Check size */
+
+      if (ntot != (long)RDB[ptr + SCORE_STAT_SIZE])
+	Die(FUNCTION_NAME, "Invalid size of %s",
+	    GetText(ptr + SCORE_PTR_NAME));
+
+      /* Put offset and size */
+
+      ent[i].off = binout.pos + m;
+      ent[i].sz = 2*ntot*sizeof(double);
+
+      /* Reset bin indexes */
+
+      for (n = 0; n < 10; n++)
+	ix[n] = 0;
+
+      /* Loop over bins */
+
+      dat = (double *)&buf[m];
+
+      for (idx = 0; idx < ntot; idx++)
+	{
+	  /* Put mean and relative error (unused indexes are ignored). */
+	  /* Relaxed power is stored with the same index order and has */
+	  /* no statistical error. */
+
+	  if (rel[i] > VALID_PTR)
+	    {
+	      dat[2*idx] = RDB[rel[i] + idx];
+	      dat[2*idx + 1] = 0.0;
+	    }
+	  else
+	    {
+	      dat[2*idx] = Mean(ptr, ix[0], ix[1], ix[2], ix[3], ix[4],
+				ix[5], ix[6], ix[7], ix[8], ix[9]);
+	      dat[2*idx + 1] = RelErr(ptr, ix[0], ix[1], ix[2], ix[3], ix[4],
+				      ix[5], ix[6], ix[7], ix[8], ix[9]);
+	    }
+
+	  /* Next bin, first index runs fastest */
+
+	  for (n = 0; n < dim; n++)
+	    {
+	      if (++ix[n] < (int)ent[i].dim[n + 1])
+		break;
+
+	      ix[n] = 0;
+	    }
+	}
+
+      /* Update position */
+
+      m = m + ent[i].sz;
+    }
+
+  /* Free lists and gathered statistics */
+
+  Mem(MEM_FREE, lst);
+  Mem(MEM_FREE, rel);
+  FreeDecompStat();
+
+  /***************************************************************************/
+
+  /***** Write index and tail ************************************************/
+
+  /* Put frame index */
+
+  memcpy(frm->magic, "SSSIDX\0\0", 8);
+
+  if (binout.nf > 0)
+    frm->prev = binout.idx;
+  else
+    frm->prev = -1;
+
+  frm->frame = binout.nf;
+  frm->coef = (long)RDB[DATA_COEF_CALC_IDX];
+  frm->step = (long)RDB[DATA_BURN_STEP];
+  frm->cycle = (long)RDB[DATA_CYCLE_IDX];
+  frm->nds = nds;
+
+  /* Remember offset */
+
+  binout.idx = binout.pos + m;
+
+  /* Put tail */
+
+  tail->idx = binout.idx;
+  memcpy(tail->magic, "SSSEND\0\0", 8);
+
+  /***************************************************************************/
+
+  /***** Start writer ********************************************************/
+
+  /* Put frame */
+
+  binout.buf = buf;
+  binout.sz = tot;
+  binout.off = binout.pos;
+  binout.err = NO;
+
+  /* Update file size and number of frames */
+
+  binout.pos = binout.pos + tot;
+  binout.nf++;
+
+  /* Start thread */
+
+  binout.busy = YES;
+
+  if (pthread_create(&binout.thr, NULL, BinaryOutputThread, NULL) != 0)
+    {
+      /* Write without thread */
+
+      binout.busy = NO;
+      BinaryOutputThread(NULL);
+
+      /* Check result */
+
+      FinishBinaryOutput();
+    }
+
+  /***************************************************************************/
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,62 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : binaryoutputthread.c                           */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Writes frame of binary output file                           */
+/*                                                                           */
+/* Comments: - Started as a separate thread from BinaryOutput(). Errors      */
+/*             are not handled here, the flag is checked in                  */
+/*             FinishBinaryOutput(). First frame truncates the file.         */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "BinaryOutputThread:"
+
+/*****************************************************************************/
+
+void *BinaryOutputThread(void *arg)
+{
+  FILE *fp;
+
+  /* Open file */
+
+  if (binout.off == 0)
+    fp = fopen(binout.fname, "w");
+  else
+    fp = fopen(binout.fname, "a");
+
+  if (fp == NULL)
+    {
+      binout.err = YES;
+      return NULL;
+    }
+
+  /* Write frame */
+
+  if (fwrite(binout.buf, sizeof(char), binout.sz, fp) != (size_t)binout.sz)
+    binout.err = YES;
+
+  /* Close file (data is visible to readers after this) */
+
+  if (fclose(fp) != 0)
+    binout.err = YES;
+
+  /* Exit */
+
+  return NULL;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -27,7 +27,7 @@ extern "C" {
 double BufMean(long ptr, ...)
 {
   long i, idx, nmax, n, loc0, bins, dim;
-  double val, wgt;
+  double val, wgt, *dat;
   va_list argp;
   va_start (argp, ptr);
 
@@ -107,6 +107,23 @@ double BufMean(long ptr, ...)
 
   /***** Access data **********************************************************/
 
+  /* Bins of decomposed statistics owned by other tasks are not */
+  /* stored in this task */
+
+  if ((long)RDB[ptr + SCORE_DECOMP_SLAB] > 0)
+    if ((idx = DecompIdx(ptr, idx)) < 0)
+      return 0.0;
+
+  /* Sparse buffer (bins that were not scored are zero) */
+
+  if ((long)RDB[ptr + SCORE_SPARSE] == YES)
+    {
+      if (((dat = SparseBufVal(ptr, idx)) == NULL) || (dat[BUF_WGT] == 0.0))
+	return 0.0;
+      else
+	return dat[BUF_VAL]/dat[BUF_WGT];
+    }
+
   /* Get pointer to buffer */
 
   loc0 = (long)RDB[ptr + SCORE_PTR_BUF];
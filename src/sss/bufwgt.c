@@ -27,7 +27,7 @@ extern "C" {
 double BufWgt(long ptr, ...)
 {
   long i, idx, nmax, n, loc0, bins, dim;
-  double val;
+  double val, *dat;
   va_list argp;
   va_start (argp, ptr);
 
@@ -107,6 +107,23 @@ double BufWgt(long ptr, ...)
 
   /***** Access data **********************************************************/
 
+  /* Bins of decomposed statistics owned by other tasks are not */
+  /* stored in this task */
+
+  if ((long)RDB[ptr + SCORE_DECOMP_SLAB] > 0)
+    if ((idx = DecompIdx(ptr, idx)) < 0)
+      return 0.0;
+
+  /* Sparse buffer (bins that were not scored are zero) */
+
+  if ((long)RDB[ptr + SCORE_SPARSE] == YES)
+    {
+      if ((dat = SparseBufVal(ptr, idx)) == NULL)
+	return 0.0;
+      else
+	return dat[BUF_WGT];
+    }
+
   /* Get pointer to buffer */
 
   loc0 = (long)RDB[ptr + SCORE_PTR_BUF];
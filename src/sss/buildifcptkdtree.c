@@ -0,0 +1,188 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : buildifcptkdtree.c                             */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Builds k-d tree over points of point-average interface       */
+/*                                                                           */
+/* Comments: - The tree is implicit: nodes are the points themselves, sorted */
+/*             so that the median of each index range is the splitting node  */
+/*             of that range and the two halves are the subtrees. No child   */
+/*             pointers are needed.                                          */
+/*                                                                           */
+/*           - Splitting axes are cycled over the dimensions used by the     */
+/*             interface (z only in 1D, x and y in 2D).                      */
+/*                                                                           */
+/*           - Memory is allocated at the first call. Later calls (interface */
+/*             updates) re-sort the same array, since coordinates may change */
+/*             when the points are re-read.                                  */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "BuildIFCPtKDTree:"
+
+/* Local function for recursion */
+
+void IFCPtKDSplit(long, long, long, long, long);
+
+/*****************************************************************************/
+
+void BuildIFCPtKDTree(long loc0)
+{
+  long tree, loc1, np, n;
+
+  /* Check pointer */
+
+  CheckPointer(FUNCTION_NAME, "(loc0)", DATA_ARRAY, loc0);
+
+  /* Get number of points */
+
+  np = (long)RDB[loc0 + IFC_NP];
+  CheckValue(FUNCTION_NAME, "np", "", np, 1, INFTY);
+
+  /* Allocate memory for nodes */
+
+  if ((tree = (long)RDB[loc0 + IFC_PTR_KD_TREE]) < VALID_PTR)
+    {
+      tree = ReallocMem(DATA_ARRAY, np*IFC_KD_BLOCK_SIZE);
+      WDB[loc0 + IFC_PTR_KD_TREE] = (double)tree;
+    }
+
+  /* Copy coordinates and pointers */
+
+  n = 0;
+
+  loc1 = (long)RDB[loc0 + IFC_PTR_POINTS];
+  while (loc1 > VALID_PTR)
+    {
+      /* Check count */
+
+      if (n == np)
+	Die(FUNCTION_NAME, "Too many points");
+
+      /* Put data */
+
+      WDB[tree + n*IFC_KD_BLOCK_SIZE + IFC_KD_X] = RDB[loc1 + IFC_PT_X];
+      WDB[tree + n*IFC_KD_BLOCK_SIZE + IFC_KD_Y] = RDB[loc1 + IFC_PT_Y];
+      WDB[tree + n*IFC_KD_BLOCK_SIZE + IFC_KD_Z] = RDB[loc1 + IFC_PT_Z];
+      WDB[tree + n*IFC_KD_BLOCK_SIZE + IFC_KD_PTR_PT] = (double)loc1;
+
+      /* Update count */
+
+      n++;
+
+      /* Next point */
+
+      loc1 = NextItem(loc1);
+    }
+
+  /* Check count */
+
+  if (n != np)
+    Die(FUNCTION_NAME, "Mismatch in number of points");
+
+  /* Sort */
+
+  IFCPtKDSplit(tree, 0, np, 0, (long)RDB[loc0 + IFC_DIM]);
+}
+
+/*****************************************************************************/
+
+/***** Recursive median split ************************************************/
+
+void IFCPtKDSplit(long tree, long lo, long hi, long depth, long dim)
+{
+  long ax, m, l, r, i, j, k, n;
+  double piv, tmp;
+
+  /* Check if range is leaf */
+
+  if (hi - lo < 2)
+    return;
+
+  /* Check depth */
+
+  if (depth > IFC_KD_MAX_DEPTH)
+    Die(FUNCTION_NAME, "Maximum depth exceeded");
+
+  /* Get splitting axis (coordinate offsets are in order x, y, z) */
+
+  if (dim == 1)
+    ax = IFC_KD_Z;
+  else
+    ax = depth % dim;
+
+  /* Median index */
+
+  m = (lo + hi)/2;
+
+  /* Select median with quickselect (nodes on the left side of m are */
+  /* smaller than or equal to m and on the right side larger or equal) */
+
+  l = lo;
+  r = hi - 1;
+
+  while (l < r)
+    {
+      /* Pivot value */
+
+      piv = RDB[tree + ((l + r)/2)*IFC_KD_BLOCK_SIZE + ax];
+
+      /* Partition */
+
+      i = l;
+      j = r;
+
+      while (i <= j)
+	{
+	  while (RDB[tree + i*IFC_KD_BLOCK_SIZE + ax] < piv)
+	    i++;
+	  while (RDB[tree + j*IFC_KD_BLOCK_SIZE + ax] > piv)
+	    j--;
+
+	  /* Swap nodes */
+
+	  if (i <= j)
+	    {
+	      for (k = 0; k < IFC_KD_BLOCK_SIZE; k++)
+		{
+		  n = i*IFC_KD_BLOCK_SIZE + k;
+		  tmp = RDB[tree + n];
+		  WDB[tree + n] = RDB[tree + j*IFC_KD_BLOCK_SIZE + k];
+		  WDB[tree + j*IFC_KD_BLOCK_SIZE + k] = tmp;
+		}
+
+	      i++;
+	      j--;
+	    }
+	}
+
+      /* Continue in the part containing the median */
+
+      if (m <= j)
+	r = j;
+      else if (m >= i)
+	l = i;
+      else
+	break;
+    }
+
+  /* Split subranges */
+
+  IFCPtKDSplit(tree, lo, m, depth + 1, dim);
+  IFCPtKDSplit(tree, m + 1, hi, depth + 1, dim);
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
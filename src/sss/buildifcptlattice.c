@@ -0,0 +1,144 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : buildifcptlattice.c                            */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Tabulates point-average interface values on a regular        */
+/*              interpolation lattice                                        */
+/*                                                                           */
+/* Comments: - Optional, lattice size is set by "set ifclat". Values at      */
+/*             lattice points are calculated by IFCPtAvgValue() and          */
+/*             interpolated by IFCPtLattice() during transport.              */
+/*                                                                           */
+/*           - Called from ProcessIFCPtAvg(), i.e. only when the interface   */
+/*             is read or updated. Memory is allocated at the first call.    */
+/*                                                                           */
+/*           - Density factors must be converted before the call.            */
+/*                                                                           */
+/*           - Sum of weights is stored with the values, lattice points      */
+/*             with no interface points within the exclusion radius are not  */
+/*             used in interpolation.                                        */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "BuildIFCPtLattice:"
+
+/*****************************************************************************/
+
+void BuildIFCPtLattice(long loc0)
+{
+  long lat, ptr, n, nx, ny, nz, dim, i, j, k, idx;
+  double xmin, xmax, ymin, ymax, zmin, zmax, x, y, z, f, T, wgt;
+
+  /* Check pointer */
+
+  CheckPointer(FUNCTION_NAME, "(loc0)", DATA_ARRAY, loc0);
+
+  /* Check if lattice is used */
+
+  if ((n = (long)RDB[DATA_IFC_PT_LATTICE_N]) < 2)
+    return;
+
+  /* Get pointer to lattice */
+
+  if ((lat = (long)RDB[loc0 + IFC_PTR_LATTICE]) < VALID_PTR)
+    {
+      /* Get dimension */
+
+      dim = (long)RDB[loc0 + IFC_DIM];
+
+      /* Number of lattice points in each direction */
+
+      nx = (dim > 1) ? n : 1;
+      ny = (dim > 1) ? n : 1;
+      nz = (dim != 2) ? n : 1;
+
+      /* Allocate memory for header */
+
+      lat = ReallocMem(DATA_ARRAY, IFC_LAT_BLOCK_SIZE);
+      WDB[loc0 + IFC_PTR_LATTICE] = (double)lat;
+
+      /* Put sizes and limits (point limits include exclusion radius) */
+
+      WDB[lat + IFC_LAT_NX] = (double)nx;
+      WDB[lat + IFC_LAT_NY] = (double)ny;
+      WDB[lat + IFC_LAT_NZ] = (double)nz;
+
+      WDB[lat + IFC_LAT_XMIN] = RDB[loc0 + IFC_MESH_XMIN];
+      WDB[lat + IFC_LAT_XMAX] = RDB[loc0 + IFC_MESH_XMAX];
+      WDB[lat + IFC_LAT_YMIN] = RDB[loc0 + IFC_MESH_YMIN];
+      WDB[lat + IFC_LAT_YMAX] = RDB[loc0 + IFC_MESH_YMAX];
+      WDB[lat + IFC_LAT_ZMIN] = RDB[loc0 + IFC_MESH_ZMIN];
+      WDB[lat + IFC_LAT_ZMAX] = RDB[loc0 + IFC_MESH_ZMAX];
+
+      /* Allocate memory for density factors, temperatures and weights */
+
+      ptr = ReallocMem(DATA_ARRAY, 3*nx*ny*nz);
+      WDB[lat + IFC_LAT_PTR_DATA] = (double)ptr;
+    }
+
+  /* Get sizes */
+
+  nx = (long)RDB[lat + IFC_LAT_NX];
+  ny = (long)RDB[lat + IFC_LAT_NY];
+  nz = (long)RDB[lat + IFC_LAT_NZ];
+
+  /* Get limits */
+
+  xmin = RDB[lat + IFC_LAT_XMIN];
+  xmax = RDB[lat + IFC_LAT_XMAX];
+  ymin = RDB[lat + IFC_LAT_YMIN];
+  ymax = RDB[lat + IFC_LAT_YMAX];
+  zmin = RDB[lat + IFC_LAT_ZMIN];
+  zmax = RDB[lat + IFC_LAT_ZMAX];
+
+  /* Pointer to data */
+
+  ptr = (long)RDB[lat + IFC_LAT_PTR_DATA];
+  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+  /* Lattice points are independent, loop in parallel */
+
+#ifdef OPEN_MP
+#pragma omp parallel for private(i, j, k, x, y, z, f, T, wgt)
+#endif
+
+  for (idx = 0; idx < nx*ny*nz; idx++)
+    {
+      /* Get indexes */
+
+      i = idx % nx;
+      j = (idx/nx) % ny;
+      k = idx/(nx*ny);
+
+      /* Get coordinates (unused directions are at zero) */
+
+      x = (nx > 1) ? xmin + ((double)i)*(xmax - xmin)/((double)(nx - 1)) : 0.0;
+      y = (ny > 1) ? ymin + ((double)j)*(ymax - ymin)/((double)(ny - 1)) : 0.0;
+      z = (nz > 1) ? zmin + ((double)k)*(zmax - zmin)/((double)(nz - 1)) : 0.0;
+
+      /* Calculate values */
+
+      wgt = IFCPtAvgValue(loc0, x, y, z, &f, &T);
+
+      /* Store */
+
+      WDB[ptr + 3*idx] = f;
+      WDB[ptr + 3*idx + 1] = T;
+      WDB[ptr + 3*idx + 2] = wgt;
+    }
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
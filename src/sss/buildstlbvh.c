@@ -0,0 +1,478 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : buildstlbvh.c                                  */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Builds bounding volume hierarchy over a list of STL facets   */
+/*                                                                           */
+/* Comments: - Tree is split using the surface area heuristic evaluated in   */
+/*             STL_BVH_BINS bins along the axis of largest centroid extent.  */
+/*                                                                           */
+/*           - Nodes are stored in a single block, children of each node     */
+/*             next to each other (right = left + STL_BVH_NODE_BLOCK_SIZE).  */
+/*             Facets are copied to a packed triangle array (first vertex    */
+/*             and two edge vectors) in the order of the leaf nodes, so      */
+/*             that the ray tests in STLBVHRayTest() and STLBVHDistance()    */
+/*             run over contiguous data.                                     */
+/*                                                                           */
+/*           - Returns pointer to the header block.                          */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "BuildSTLBVH:"
+
+/* Local function for recursion */
+
+void STLBVHSplit(long, long, long *, long *, double *, double *, long, long,
+		 long);
+
+/*****************************************************************************/
+
+long BuildSTLBVH(long *fct, long nf)
+{
+  long bvh, ptr, pts, n, i, *idx;
+  double *box, *cen, p;
+
+  /* Check number of facets */
+
+  CheckValue(FUNCTION_NAME, "nf", "", nf, 1, INFTY);
+
+  /* Allocate memory for temporary arrays */
+
+  idx = (long *)Mem(MEM_ALLOC, nf, sizeof(long));
+  box = (double *)Mem(MEM_ALLOC, 6*nf, sizeof(double));
+  cen = (double *)Mem(MEM_ALLOC, 3*nf, sizeof(double));
+
+  /* Loop over facets and calculate bounding boxes and centroids */
+
+  for (n = 0; n < nf; n++)
+    {
+      /* Pointer to facet */
+
+      ptr = fct[n];
+      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+      /* Reset bounding box */
+
+      for (i = 0; i < 3; i++)
+	{
+	  box[6*n + 2*i] = INFTY;
+	  box[6*n + 2*i + 1] = -INFTY;
+	}
+
+      /* Loop over points */
+
+      for (i = 0; i < 9; i++)
+	{
+	  /* Get point */
+
+	  if (i < 3)
+	    pts = (long)RDB[ptr + STL_FACET_PTR_PT1];
+	  else if (i < 6)
+	    pts = (long)RDB[ptr + STL_FACET_PTR_PT2];
+	  else
+	    pts = (long)RDB[ptr + STL_FACET_PTR_PT3];
+
+	  CheckPointer(FUNCTION_NAME, "(pts)", DATA_ARRAY, pts);
+
+	  /* Get coordinate */
+
+	  p = RDB[pts + STL_POINT_X + (i % 3)];
+
+	  /* Compare to limits */
+
+	  if (p < box[6*n + 2*(i % 3)])
+	    box[6*n + 2*(i % 3)] = p;
+	  if (p > box[6*n + 2*(i % 3) + 1])
+	    box[6*n + 2*(i % 3) + 1] = p;
+	}
+
+      /* Centroid of bounding box */
+
+      for (i = 0; i < 3; i++)
+	cen[3*n + i] = 0.5*(box[6*n + 2*i] + box[6*n + 2*i + 1]);
+
+      /* Put index */
+
+      idx[n] = n;
+    }
+
+  /* Allocate memory for header, nodes and triangles (binary tree with */
+  /* at least one facet per leaf has no more than 2nf - 1 nodes) */
+
+  bvh = ReallocMem(DATA_ARRAY, STL_BVH_BLOCK_SIZE);
+
+  ptr = ReallocMem(DATA_ARRAY, (2*nf - 1)*STL_BVH_NODE_BLOCK_SIZE);
+  WDB[bvh + STL_BVH_PTR_NODES] = (double)ptr;
+
+  ptr = ReallocMem(DATA_ARRAY, nf*STL_BVH_TRI_BLOCK_SIZE);
+  WDB[bvh + STL_BVH_PTR_TRI] = (double)ptr;
+
+  /* Root node is first */
+
+  WDB[bvh + STL_BVH_N_NODES] = 1.0;
+  WDB[bvh + STL_BVH_N_TRI] = 0.0;
+
+  /* Build tree */
+
+  STLBVHSplit(bvh, (long)RDB[bvh + STL_BVH_PTR_NODES], fct, idx, box, cen,
+	      0, nf, 0);
+
+  /* Check that all facets were included */
+
+  if ((long)RDB[bvh + STL_BVH_N_TRI] != nf)
+    Die(FUNCTION_NAME, "Mismatch in number of facets");
+
+  /* Free temporary arrays */
+
+  Mem(MEM_FREE, idx);
+  Mem(MEM_FREE, box);
+  Mem(MEM_FREE, cen);
+
+  /* Return pointer */
+
+  return bvh;
+}
+
+/*****************************************************************************/
+
+/***** Split node recursively ************************************************/
+
+void STLBVHSplit(long bvh, long node, long *fct, long *idx, double *box,
+		 double *cen, long i0, long n, long depth)
+{
+  long i, j, k, m, ax, sp, tri, ptr, pts, leaf, cnt[STL_BVH_BINS];
+  double bmin[3], bmax[3], cmin[3], cmax[3], bb[STL_BVH_BINS][6];
+  double al[STL_BVH_BINS], ar[STL_BVH_BINS], lb[6], f, c, best, A;
+  long nl[STL_BVH_BINS], nr[STL_BVH_BINS];
+
+  /* Check node pointer and depth */
+
+  CheckPointer(FUNCTION_NAME, "(node)", DATA_ARRAY, node);
+  CheckValue(FUNCTION_NAME, "depth", "", depth, 0, STL_BVH_MAX_DEPTH - 1);
+
+  /***************************************************************************/
+
+  /***** Bounding box ********************************************************/
+
+  /* Reset limits */
+
+  for (i = 0; i < 3; i++)
+    {
+      bmin[i] = INFTY;
+      bmax[i] = -INFTY;
+      cmin[i] = INFTY;
+      cmax[i] = -INFTY;
+    }
+
+  /* Loop over facets */
+
+  for (j = i0; j < i0 + n; j++)
+    {
+      k = idx[j];
+
+      for (i = 0; i < 3; i++)
+	{
+	  if (box[6*k + 2*i] < bmin[i])
+	    bmin[i] = box[6*k + 2*i];
+	  if (box[6*k + 2*i + 1] > bmax[i])
+	    bmax[i] = box[6*k + 2*i + 1];
+
+	  if (cen[3*k + i] < cmin[i])
+	    cmin[i] = cen[3*k + i];
+	  if (cen[3*k + i] > cmax[i])
+	    cmax[i] = cen[3*k + i];
+	}
+    }
+
+  /* Put bounding box (padded to avoid missing axis-aligned facets */
+  /* due to round-off in the slab test) */
+
+  WDB[node + STL_BVH_NODE_XMIN] = bmin[0] - 1E-6;
+  WDB[node + STL_BVH_NODE_XMAX] = bmax[0] + 1E-6;
+  WDB[node + STL_BVH_NODE_YMIN] = bmin[1] - 1E-6;
+  WDB[node + STL_BVH_NODE_YMAX] = bmax[1] + 1E-6;
+  WDB[node + STL_BVH_NODE_ZMIN] = bmin[2] - 1E-6;
+  WDB[node + STL_BVH_NODE_ZMAX] = bmax[2] + 1E-6;
+
+  /* Half surface area */
+
+  A = (bmax[0] - bmin[0])*(bmax[1] - bmin[1])
+    + (bmax[1] - bmin[1])*(bmax[2] - bmin[2])
+    + (bmax[2] - bmin[2])*(bmax[0] - bmin[0]);
+
+  /* Select axis with largest centroid extent */
+
+  ax = 0;
+  for (i = 1; i < 3; i++)
+    if (cmax[i] - cmin[i] > cmax[ax] - cmin[ax])
+      ax = i;
+
+  /***************************************************************************/
+
+  /***** Find split **********************************************************/
+
+  /* Check if node can be split */
+
+  if ((n <= STL_BVH_LEAF_SIZE) || (depth == STL_BVH_MAX_DEPTH - 1) ||
+      (cmax[ax] - cmin[ax] <= 0.0))
+    {
+      leaf = YES;
+      sp = -1;
+    }
+  else
+    {
+      leaf = NO;
+
+      /* Reset bins */
+
+      for (i = 0; i < STL_BVH_BINS; i++)
+	{
+	  cnt[i] = 0;
+
+	  for (k = 0; k < 3; k++)
+	    {
+	      bb[i][2*k] = INFTY;
+	      bb[i][2*k + 1] = -INFTY;
+	    }
+	}
+
+      /* Put facets in bins by centroid */
+
+      f = ((double)STL_BVH_BINS)/(cmax[ax] - cmin[ax]);
+
+      for (j = i0; j < i0 + n; j++)
+	{
+	  m = idx[j];
+
+	  if ((i = (long)((cen[3*m + ax] - cmin[ax])*f)) > STL_BVH_BINS - 1)
+	    i = STL_BVH_BINS - 1;
+
+	  cnt[i]++;
+
+	  for (k = 0; k < 3; k++)
+	    {
+	      if (box[6*m + 2*k] < bb[i][2*k])
+		bb[i][2*k] = box[6*m + 2*k];
+	      if (box[6*m + 2*k + 1] > bb[i][2*k + 1])
+		bb[i][2*k + 1] = box[6*m + 2*k + 1];
+	    }
+	}
+
+      /* Sweep from left (split between bins i and i + 1) */
+
+      for (k = 0; k < 6; k++)
+	lb[k] = (k % 2) ? -INFTY : INFTY;
+
+      m = 0;
+
+      for (i = 0; i < STL_BVH_BINS - 1; i++)
+	{
+	  for (k = 0; k < 3; k++)
+	    {
+	      if (bb[i][2*k] < lb[2*k])
+		lb[2*k] = bb[i][2*k];
+	      if (bb[i][2*k + 1] > lb[2*k + 1])
+		lb[2*k + 1] = bb[i][2*k + 1];
+	    }
+
+	  m = m + cnt[i];
+	  nl[i] = m;
+
+	  if (m > 0)
+	    al[i] = (lb[1] - lb[0])*(lb[3] - lb[2])
+	      + (lb[3] - lb[2])*(lb[5] - lb[4])
+	      + (lb[5] - lb[4])*(lb[1] - lb[0]);
+	  else
+	    al[i] = 0.0;
+	}
+
+      /* Sweep from right */
+
+      for (k = 0; k < 6; k++)
+	lb[k] = (k % 2) ? -INFTY : INFTY;
+
+      m = 0;
+
+      for (i = STL_BVH_BINS - 1; i > 0; i--)
+	{
+	  for (k = 0; k < 3; k++)
+	    {
+	      if (bb[i][2*k] < lb[2*k])
+		lb[2*k] = bb[i][2*k];
+	      if (bb[i][2*k + 1] > lb[2*k + 1])
+		lb[2*k + 1] = bb[i][2*k + 1];
+	    }
+
+	  m = m + cnt[i];
+	  nr[i - 1] = m;
+
+	  if (m > 0)
+	    ar[i - 1] = (lb[1] - lb[0])*(lb[3] - lb[2])
+	      + (lb[3] - lb[2])*(lb[5] - lb[4])
+	      + (lb[5] - lb[4])*(lb[1] - lb[0]);
+	  else
+	    ar[i - 1] = 0.0;
+	}
+
+      /* Find split with minimum cost */
+
+      best = INFTY;
+      sp = -1;
+
+      for (i = 0; i < STL_BVH_BINS - 1; i++)
+	if ((nl[i] > 0) && (nr[i] > 0))
+	  {
+	    c = al[i]*((double)nl[i]) + ar[i]*((double)nr[i]);
+
+	    if (c < best)
+	      {
+		best = c;
+		sp = i;
+	      }
+	  }
+
+      /* Compare to cost of leaf (traversal cost is assumed equal to */
+      /* one ray-triangle test) */
+
+      if (sp < 0)
+	leaf = YES;
+      else if ((n <= 4*STL_BVH_LEAF_SIZE) && (A > 0.0) &&
+	       (1.0 + best/A >= (double)n))
+	leaf = YES;
+    }
+
+  /***************************************************************************/
+
+  /***** Create leaf *********************************************************/
+
+  if (leaf == YES)
+    {
+      /* Pointer to first triangle */
+
+      tri = (long)RDB[bvh + STL_BVH_PTR_TRI] +
+	((long)RDB[bvh + STL_BVH_N_TRI])*STL_BVH_TRI_BLOCK_SIZE;
+
+      /* Put pointer and number of triangles */
+
+      WDB[node + STL_BVH_NODE_PTR] = (double)tri;
+      WDB[node + STL_BVH_NODE_N] = (double)n;
+
+      /* Loop over facets */
+
+      for (j = i0; j < i0 + n; j++)
+	{
+	  /* Pointer to facet */
+
+	  ptr = fct[idx[j]];
+	  WDB[tri + STL_BVH_TRI_PTR_FACET] = (double)ptr;
+
+	  /* First vertex */
+
+	  pts = (long)RDB[ptr + STL_FACET_PTR_PT1];
+	  CheckPointer(FUNCTION_NAME, "(pts1)", DATA_ARRAY, pts);
+
+	  WDB[tri + STL_BVH_TRI_X0] = RDB[pts + STL_POINT_X];
+	  WDB[tri + STL_BVH_TRI_Y0] = RDB[pts + STL_POINT_Y];
+	  WDB[tri + STL_BVH_TRI_Z0] = RDB[pts + STL_POINT_Z];
+
+	  /* Edge vectors */
+
+	  pts = (long)RDB[ptr + STL_FACET_PTR_PT2];
+	  CheckPointer(FUNCTION_NAME, "(pts2)", DATA_ARRAY, pts);
+
+	  WDB[tri + STL_BVH_TRI_E1X] = RDB[pts + STL_POINT_X]
+	    - RDB[tri + STL_BVH_TRI_X0];
+	  WDB[tri + STL_BVH_TRI_E1Y] = RDB[pts + STL_POINT_Y]
+	    - RDB[tri + STL_BVH_TRI_Y0];
+	  WDB[tri + STL_BVH_TRI_E1Z] = RDB[pts + STL_POINT_Z]
+	    - RDB[tri + STL_BVH_TRI_Z0];
+
+	  pts = (long)RDB[ptr + STL_FACET_PTR_PT3];
+	  CheckPointer(FUNCTION_NAME, "(pts3)", DATA_ARRAY, pts);
+
+	  WDB[tri + STL_BVH_TRI_E2X] = RDB[pts + STL_POINT_X]
+	    - RDB[tri + STL_BVH_TRI_X0];
+	  WDB[tri + STL_BVH_TRI_E2Y] = RDB[pts + STL_POINT_Y]
+	    - RDB[tri + STL_BVH_TRI_Y0];
+	  WDB[tri + STL_BVH_TRI_E2Z] = RDB[pts + STL_POINT_Z]
+	    - RDB[tri + STL_BVH_TRI_Z0];
+
+	  /* Next */
+
+	  tri = tri + STL_BVH_TRI_BLOCK_SIZE;
+	}
+
+      /* Update counter */
+
+      WDB[bvh + STL_BVH_N_TRI] = RDB[bvh + STL_BVH_N_TRI] + (double)n;
+
+      /* Exit subroutine */
+
+      return;
+    }
+
+  /***************************************************************************/
+
+  /***** Split node **********************************************************/
+
+  /* Partition facets (bins 0...sp to the left) */
+
+  i = i0;
+  j = i0 + n - 1;
+
+  while (i <= j)
+    {
+      m = idx[i];
+
+      if ((k = (long)((cen[3*m + ax] - cmin[ax])*f)) > STL_BVH_BINS - 1)
+	k = STL_BVH_BINS - 1;
+
+      if (k <= sp)
+	i++;
+      else
+	{
+	  idx[i] = idx[j];
+	  idx[j--] = m;
+	}
+    }
+
+  /* Number of facets on the left */
+
+  m = i - i0;
+
+  if ((m < 1) || (m > n - 1))
+    Die(FUNCTION_NAME, "Empty child node");
+
+  /* Pointer to children */
+
+  ptr = (long)RDB[bvh + STL_BVH_PTR_NODES] +
+    ((long)RDB[bvh + STL_BVH_N_NODES])*STL_BVH_NODE_BLOCK_SIZE;
+
+  WDB[bvh + STL_BVH_N_NODES] = RDB[bvh + STL_BVH_N_NODES] + 2.0;
+
+  /* Put pointer (interior node has no triangles) */
+
+  WDB[node + STL_BVH_NODE_PTR] = (double)ptr;
+  WDB[node + STL_BVH_NODE_N] = 0.0;
+
+  /* Split children */
+
+  STLBVHSplit(bvh, ptr, fct, idx, box, cen, i0, m, depth + 1);
+  STLBVHSplit(bvh, ptr + STL_BVH_NODE_BLOCK_SIZE, fct, idx, box, cen,
+	      i0 + m, n - m, depth + 1);
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -6,14 +6,18 @@ extern "C" {
 /* serpent 2 (beta-version) : burnmaterials.c                                */
 /*                                                                           */
 /* Created:       2011/05/22 (JLe)                                           */
-/* Last modified: 2015/09/26 (JLe)                                           */
-/* Version:       2.1.25                                                     */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
 /*                                                                           */
 /* Description: Performs burnup calculation for materials                    */
 /*                                                                           */
 /* Comments: - OpenMP parallelization revised 4.6.2012 (2.1.6)               */
 /*           - Added separate subroutine to be used with corrector iteration */
 /*             for convergence criterion calculation 4.11.2014 (2.1.22)      */
+/*           - Materials without flows are burned in batches of up to        */
+/*             "set crambatch" materials per thread, CRAM solutions of       */
+/*             materials with the same nuclides are solved together in       */
+/*             MatrixExponentialBatch() 18.10.2026 (2.1.26 / LMK)            */
 /*                                                                           */
 /*****************************************************************************/
 
@@ -24,7 +28,7 @@ extern "C" {
 
 /* Use local function to simplify OpenMP implementation */
 
-void BurnMaterials0(long, long, long, long, long);
+void BurnMaterials0(long *, long, long, long, long, long);
 
 void BurnMaterialsMSR(long, long, long, long, long);
 
@@ -37,10 +41,7 @@ void PrintDepMatrixMSR(long, struct ccsMatrix *, double, double *,
 
 void BurnMaterials(long dep, long step)
 {
-  long mat, nss, type, mode;
-
-
-
+  long mat, nss, type, mode, nb, nbmax, i, lst[MAX_CRAM_BATCH];
 
   /***************************************************************************/
 
@@ -158,20 +159,6 @@ void BurnMaterials(long dep, long step)
 
       WDB[DATA_BURN_CI_FLAG] = (double)YES;
 
-      /* Reset thread numbers */
-
-      mat = (long)RDB[DATA_PTR_M0];
-      while (mat > VALID_PTR)
-	{
-	  /* Check thread number */
-      
-	  WDB[mat + MATERIAL_OMP_ID] = -1.0;
-
-	  /* Next material */
-      
-	  mat = NextItem(mat);
-	}	  
-
       if ((long)RDB[DATA_N_BURN_MATERIALS] > 1)
 	fprintf(out, "\nBurning %ld materials (CI):\n\n", 
 		(long)RDB[DATA_N_BURN_MATERIALS]);
@@ -186,6 +173,10 @@ void BurnMaterials(long dep, long step)
 
       PrintProgress(0, 0);
 
+      /* Distribute burnable materials to threads */
+
+      ScheduleMatTasks(MAT_TASK_BURN_CI);
+
       /* Start parallel timer */
 
       StartTimer(TIMER_OMP_PARA);
@@ -194,28 +185,17 @@ void BurnMaterials(long dep, long step)
 #pragma omp parallel private (mat)
 #endif
       {
-	/* Loop over materials */
+	/* Loop over tasks */
     
-	mat = (long)RDB[DATA_PTR_M0];
-	while (mat > VALID_PTR)
+	while ((mat = NextMatTask(OMP_THREAD_NUM)) > VALID_PTR)
 	  {
-	    /* Check burn flag and test parallel id's */
-
-	    if ((long)RDB[mat + MATERIAL_OPTIONS] & OPT_BURN_MAT)
-	      if (MyParallelMat(mat, YES) == YES)
-		{
-		  /* Burn */
+	    /* Burn */
 	      
-		  BurnMaterialsCI(mat, step, nss, type, mode);	
+	    BurnMaterialsCI(mat, step, nss, type, mode);	
 	      
-		  /* Print */
+	    /* Print */
 	      
-		  PrintProgress(mat, 2);
-		}
-	
-	    /* Next material */
-	
-	    mat = NextItem(mat);
+	    PrintProgress(mat, 2);
 	  }
       }
   
@@ -227,6 +207,10 @@ void BurnMaterials(long dep, long step)
   
       PrintProgress(0, 100);
 
+      /* Print load balance and free task list */
+
+      FinishMatTasks();
+
 
       WDB[DATA_BURN_CI_FLAG] = (double)NO;
     }
@@ -235,20 +219,6 @@ void BurnMaterials(long dep, long step)
 
   /***** Main loop ***********************************************************/
 
-  /* Reset thread numbers */
-
-  mat = (long)RDB[DATA_PTR_M0];
-  while (mat > VALID_PTR)
-    {
-      /* Check thread number */
-      
-      WDB[mat + MATERIAL_OMP_ID] = -1.0;
-
-      /* Next material */
-      
-      mat = NextItem(mat);
-    }	  
-
   if ((long)RDB[DATA_N_BURN_MATERIALS] > 1)
     fprintf(out, "\nBurning %ld materials:\n\n", 
 	    (long)RDB[DATA_N_BURN_MATERIALS]);
@@ -259,53 +229,87 @@ void BurnMaterials(long dep, long step)
 
   PrintProgress(0, 0);
 
+  /* Distribute burnable materials to threads (materials with inflow */
+  /* are burned with the first material in flow chain, no inflow in  */
+  /* conventional burnup calculation) */
+
+  ScheduleMatTasks(MAT_TASK_BURN);
+
   /* Start parallel timer */
 
   StartTimer(TIMER_OMP_PARA);
 
+  /* Number of materials burned together (CRAM solutions of materials */
+  /* with the same nuclides are batched in MatrixExponentialBatch()) */
+
+  if (mode == BUMODE_CRAM)
+    nbmax = (long)RDB[DATA_BURN_CRAM_BATCH];
+  else
+    nbmax = 1;
+
+  CheckValue(FUNCTION_NAME, "nbmax", "", nbmax, 1, MAX_CRAM_BATCH);
+
 #ifdef OPEN_MP
-#pragma omp parallel private (mat)
+#pragma omp parallel private (mat, nb, i, lst)
 #endif
   {
-    /* Loop over materials */
+    /* Reset batch */
+
+    nb = 0;
+
+    /* Loop over tasks */
     
-    mat = (long)RDB[DATA_PTR_M0];
-    while (mat > VALID_PTR)
+    while ((mat = NextMatTask(OMP_THREAD_NUM)) > VALID_PTR)
       {
-	/* Check burn flag and inflow, and test parallel id's */
-	/* NOTE: No inflo in conventional burnup calculation. */
+	/* Check flow index and burn */
 
-	if (((long)RDB[mat + MATERIAL_OPTIONS] & OPT_BURN_MAT) &&
-	    ((long)RDB[mat + MATERIAL_PTR_INFLOW] < VALID_PTR))
-	  if (MyParallelMat(mat, YES) == YES)
-	    {
-	      /* Check flow index and burn */
+	if ((long)RDB[mat + MATERIAL_FLOW_IDX] == 0)
+	  {
+	    /* Not involved in continuous reprocessing, add to batch */
 
-	      if ((long)RDB[mat + MATERIAL_FLOW_IDX] == 0)
-		{
-		  /* Not involved in continuous reprocessing */
+	    lst[nb++] = mat;
 
-		  BurnMaterials0(mat, step, nss, type, mode);	
-		  
-		  /* Print */
-		  
-		  PrintProgress(mat, 2);
-		}
-	      else if ((long)RDB[mat + MATERIAL_FLOW_IDX] == 1)
-		{
-		  /* First material in chain */
+	    /* Check if batch is full */
 
-		  BurnMaterialsMSR(mat, step, nss, type, mode);	
-		  
-		  /* Print */
+	    if (nb < nbmax)
+	      continue;
+
+	    /* Burn */
+
+	    BurnMaterials0(lst, nb, step, nss, type, mode);	
+
+	    /* Split time between materials and print */
+
+	    FinishMatBatch(OMP_THREAD_NUM, lst, nb);
+
+	    for (i = 0; i < nb; i++)
+	      PrintProgress(lst[i], 2);
+
+	    /* Reset batch */
+
+	    nb = 0;
+	  }
+	else
+	  {
+	    /* First material in chain */
+
+	    BurnMaterialsMSR(mat, step, nss, type, mode);	
+
+	    /* Print */
 		  
-		  PrintProgress(mat, 2);
-		}
-	    }
-	
-	/* Next material */
-	
-	mat = NextItem(mat);
+	    PrintProgress(mat, 2);
+	  }
+      }
+
+    /* Burn remaining batch */
+
+    if (nb > 0)
+      {
+	BurnMaterials0(lst, nb, step, nss, type, mode);	
+	FinishMatBatch(OMP_THREAD_NUM, lst, nb);
+
+	for (i = 0; i < nb; i++)
+	  PrintProgress(lst[i], 2);
       }
   }
   
@@ -316,6 +320,10 @@ void BurnMaterials(long dep, long step)
   /* Print */
   
   PrintProgress(0, 100);
+
+  /* Print load balance and free task list */
+
+  FinishMatTasks();
   
   /***************************************************************************/
 }
@@ -324,28 +332,22 @@ void BurnMaterials(long dep, long step)
 
 /*****************************************************************************/
 
-void BurnMaterials0(long mat, long step, long nss, long type, long mode)
+void BurnMaterials0(long *mat, long nb, long step, long nss, long type, 
+		    long mode)
 {
-  long iso, ptr, lst, i, sz, ss, id;
-  double t, t1, t2, tot, *N, *N0; 
-  struct ccsMatrix *A; 
+  long iso, lst, i, ss, id, q, p, ng, *sz, *md, *grp;
+  double t, t1, t2, tot, **N, **N0, **Ng, **N0g, *tg; 
 
   /* This is used to move EOS compositions to MaterialBurnup. 
      The approach is a bit hacky but not that messy. (AIs) */
 
-  double *Neos;
+  double **Neos;
 
-  /* Check divisor type */
-
-  if ((long)RDB[mat + MATERIAL_DIV_TYPE] == MAT_DIV_TYPE_PARENT)
-    Die(FUNCTION_NAME, "Divided parent material");
+  struct ccsMatrix **A, **Ag; 
 
-  /* Avoid compiler warning */
+  /* Check batch size */
 
-  A = NULL; 
-  N = NULL; 
-  N0 = NULL;
-  Neos = NULL;
+  CheckValue(FUNCTION_NAME, "nb", "", nb, 1, MAX_CRAM_BATCH);
 
   /* Get OpenMP id */
 
@@ -356,69 +358,98 @@ void BurnMaterials0(long mat, long step, long nss, long type, long mode)
   t = RDB[DATA_BURN_TIME_INTERVAL];
   CheckValue(FUNCTION_NAME, "t", "", t, ZERO, INFTY);
 
-  /* Check type  */
+  /* Allocate memory for pointers to matrices and composition vectors */
+  /* of materials in batch, and for lists of materials solved together */
+
+  A = (struct ccsMatrix **)Mem(MEM_ALLOC, nb, sizeof(struct ccsMatrix *));
+  Ag = (struct ccsMatrix **)Mem(MEM_ALLOC, nb, sizeof(struct ccsMatrix *));
+  N = (double **)Mem(MEM_ALLOC, nb, sizeof(double *));
+  N0 = (double **)Mem(MEM_ALLOC, nb, sizeof(double *));
+  Neos = (double **)Mem(MEM_ALLOC, nb, sizeof(double *));
+  Ng = (double **)Mem(MEM_ALLOC, nb, sizeof(double *));
+  N0g = (double **)Mem(MEM_ALLOC, nb, sizeof(double *));
+  tg = (double *)Mem(MEM_ALLOC, nb, sizeof(double));
+  sz = (long *)Mem(MEM_ALLOC, nb, sizeof(long));
+  md = (long *)Mem(MEM_ALLOC, nb, sizeof(long));
+  grp = (long *)Mem(MEM_ALLOC, nb, sizeof(long));
+
+  /***************************************************************************/
 
-  if ((type != DEP_STEP_DEC_STEP) && (type != DEP_STEP_DEC_TOT) &&
-      (type != DEP_STEP_ACT_STEP) && (type != DEP_STEP_ACT_TOT))
+  /***** Initial compositions ************************************************/
+
+  /* Loop over materials in batch */
+
+  for (q = 0; q < nb; q++)
     {
-      /* Calculate transmutation cross sections */
+      /* Check divisor type */
 
-      CalculateTransmuXS(mat, id);
+      if ((long)RDB[mat[q] + MATERIAL_DIV_TYPE] == MAT_DIV_TYPE_PARENT)
+	Die(FUNCTION_NAME, "Divided parent material");
+
+      /* Burnup mode (may be overridden for each material) */
+
+      md[q] = mode;
+
+      /* Check type  */
+
+      if ((type != DEP_STEP_DEC_STEP) && (type != DEP_STEP_DEC_TOT) &&
+	  (type != DEP_STEP_ACT_STEP) && (type != DEP_STEP_ACT_TOT))
+	{
+	  /* Calculate transmutation cross sections */
+
+	  CalculateTransmuXS(mat[q], id);
       
-      /* Store the xs from above */
+	  /* Store the xs from above */
       
-      StoreTransmuXS(mat, step, type, id);
-    }
+	  StoreTransmuXS(mat[q], step, type, id);
+	}
 
-  /* Size of composition vector */
-  
-  ptr = (long)RDB[mat + MATERIAL_PTR_COMP];
-  sz = ListSize(ptr);
-  
-  /* Allocate memory for composition vectors */
+      /* Size of composition vector */
 
-  N0 = (double *)Mem(MEM_ALLOC, sz, sizeof(double));
-  Neos = (double *)Mem(MEM_ALLOC, sz, sizeof(double));
-  /*
+      sz[q] = ListSize((long)RDB[mat[q] + MATERIAL_PTR_COMP]);
 
-  N0 = WorkArray(DATA_PTR_WORK_COMP1, PRIVA_ARRAY, sz, id);
-  */
-  /* Copy composition to N0. On predictor also store it for corrector */
+      /* Allocate memory for composition vectors */
+
+      N0[q] = (double *)Mem(MEM_ALLOC, sz[q], sizeof(double));
+      Neos[q] = (double *)Mem(MEM_ALLOC, sz[q], sizeof(double));
+
+      /* Copy composition to N0. On predictor also store it for corrector */
   
-  i = 0;
-  lst = (long)RDB[mat + MATERIAL_PTR_COMP];
+      i = 0;
+      lst = (long)RDB[mat[q] + MATERIAL_PTR_COMP];
   
-  if ((long)RDB[DATA_BURN_STEP_PC] == PREDICTOR_STEP)
-    {
-      /* Predictor step, copy composition to N0 and BOS for corrector */
-      
-      while ((iso = ListPtr(lst, i)) > VALID_PTR)
+      if ((long)RDB[DATA_BURN_STEP_PC] == PREDICTOR_STEP)
 	{
-	  WDB[iso + COMPOSITION_ADENS_BOS] = 
-	    RDB[iso + COMPOSITION_ADENS];
-	  N0[i++] = RDB[iso + COMPOSITION_ADENS_BOS];
+	  /* Predictor step, copy composition to N0 and BOS for corrector */
+      
+	  while ((iso = ListPtr(lst, i)) > VALID_PTR)
+	    {
+	      WDB[iso + COMPOSITION_ADENS_BOS] = 
+		RDB[iso + COMPOSITION_ADENS];
+	      N0[q][i++] = RDB[iso + COMPOSITION_ADENS_BOS];
+	    }
 	}
-    }
-  else
-    {
-      /* Corrector step */
+      else
+	{
+	  /* Corrector step */
       
-      while ((iso = ListPtr(lst, i)) > VALID_PTR)
-        {
-          /* this should get the predicted EOS atomic densities */
+	  while ((iso = ListPtr(lst, i)) > VALID_PTR)
+	    {
+	      /* this should get the predicted EOS atomic densities */
           
-          Neos[i] = RDB[iso + COMPOSITION_ADENS];
+	      Neos[q][i] = RDB[iso + COMPOSITION_ADENS];
 
-          /* copy composition from BOS to N0 */
+	      /* copy composition from BOS to N0 */
 
-          N0[i++] = RDB[iso + COMPOSITION_ADENS_BOS];
-        }
-    }
+	      N0[q][i++] = RDB[iso + COMPOSITION_ADENS_BOS];
+	    }
+	}
   
-  /* Check size */
+      /* Check size */
   
-  if (i != sz)
-    Die(FUNCTION_NAME, "Mismatch in size");
+      if (i != sz[q])
+	Die(FUNCTION_NAME, "Mismatch in size");
+    }
 
   /***************************************************************************/
 
@@ -431,36 +462,50 @@ void BurnMaterials0(long mat, long step, long nss, long type, long mode)
       t1 = t*ss/nss;
       t2 = t*(ss + 1)/nss;
 
-      /* calculate weighted xs and flux (if-lauseke lisätty */
-      /* 16.8.2013 / 2.1.16)*/
+      /* Loop over materials in batch */
 
-      if ((type != DEP_STEP_DEC_STEP) && (type != DEP_STEP_DEC_TOT))
-	AverageTransmuXS(mat, t1, t2, id);
+      for (q = 0; q < nb; q++)
+	{
+	  /* calculate weighted xs and flux (if-lauseke lisätty */
+	  /* 16.8.2013 / 2.1.16)*/
 
-      /* Create burnup matrix */
+	  if ((type != DEP_STEP_DEC_STEP) && (type != DEP_STEP_DEC_TOT))
+	    AverageTransmuXS(mat[q], t1, t2, id);
+
+	  /* Create burnup matrix */
       
-      A = MakeBurnMatrix(mat, id);
+	  A[q] = MakeBurnMatrix(mat[q], id);
 
-      /* Check size (sz == i tarkistettiin jo aikaisemmin) */
+	  /* Check size (sz == i tarkistettiin jo aikaisemmin) */
       
-      if (sz != A->n)
-	Die(FUNCTION_NAME, "Mismatch in size");
+	  if (sz[q] != A[q]->n)
+	    Die(FUNCTION_NAME, "Mismatch in size");
       
-      /* Print depletion matrix */
+	  /* Print depletion matrix */
 
-      PrintDepMatrix(mat, A, t2 - t1, N0, N0, id);
+	  PrintDepMatrix(mat[q], A[q], t2 - t1, N0[q], N0[q], id);
 
-      /* Calculate material-wise burnup (JLe 21.5.2015 / 2.1.24: Tonne  */
-      /* jää jotain vanhoja vuoarvoja aikaisemmilta askeleilta jotka    */
-      /* antaa nollasta poikkeavan tehon jos tätä kutsutaan decay-      */
-      /* stepistä. Predictor-corrector laskussa if-lauseke estää niiden */
-      /* lukemisen, mutta ilman pcc:tä ne aiheuttaa kummallisia arvoja  */
-      /* materiaalikohtaisiin palamiin. Pitäisi selvittää että miten    */
-      /* noi nollaamattomat arvot vaikuttaa muissa tilanteissa, esim.   */
-      /* jäähtymisajan jälkeen ajetaan taas teholla.) */
+	  /* Calculate material-wise burnup (JLe 21.5.2015 / 2.1.24: Tonne  */
+	  /* jää jotain vanhoja vuoarvoja aikaisemmilta askeleilta jotka    */
+	  /* antaa nollasta poikkeavan tehon jos tätä kutsutaan decay-      */
+	  /* stepistä. Predictor-corrector laskussa if-lauseke estää niiden */
+	  /* lukemisen, mutta ilman pcc:tä ne aiheuttaa kummallisia arvoja  */
+	  /* materiaalikohtaisiin palamiin. Pitäisi selvittää että miten    */
+	  /* noi nollaamattomat arvot vaikuttaa muissa tilanteissa, esim.   */
+	  /* jäähtymisajan jälkeen ajetaan taas teholla.) */
 
-      if ((type != DEP_STEP_DEC_STEP) && (type != DEP_STEP_DEC_TOT))
-        MaterialBurnup(mat, N0, Neos, t1, t2, ss, id);
+	  if ((type != DEP_STEP_DEC_STEP) && (type != DEP_STEP_DEC_TOT))
+	    MaterialBurnup(mat[q], N0[q], Neos[q], t1, t2, ss, id);
+
+	  /* Override burnup mode if flux is very low */
+
+	  if (RDB[mat[q] + MATERIAL_BURN_FLUX_SSA] < 1E-6)
+	    md[q] = BUMODE_TTA;
+
+	  /* Reset solved flag */
+
+	  grp[q] = NO;
+	}
 
       /* Start burnup equation timers */
       
@@ -468,96 +513,159 @@ void BurnMaterials0(long mat, long step, long nss, long type, long mode)
       StartTimer(TIMER_BATEMAN);
       StartTimer(TIMER_BATEMAN_TOTAL);
 
-      /* Override burnup mode if flux is very low */
+      /* Solve depletion equations */
 
-      if (RDB[mat + MATERIAL_BURN_FLUX_SSA] < 1E-6)
-	mode = BUMODE_TTA;
+      for (q = 0; q < nb; q++)
+	{
+	  /* Check if already solved with previous material */
 
-      /* Solve depletion equations */
+	  if (grp[q] == YES)
+	    continue;
 
-      if (mode == BUMODE_TTA)
-	N = TTA(A, N0, t2 - t1);
-      else if (mode == BUMODE_CRAM)
-	N = MatrixExponential(A, N0, t2 - t1); 
-      else
-	Die(FUNCTION_NAME, "Invalid burnup mode");
+	  if (md[q] == BUMODE_TTA)
+	    {
+	      /* Linear chains method, one material at a time */
+
+	      N[q] = TTA(A[q], N0[q], t2 - t1);
+	      grp[q] = YES;
+	    }
+	  else if (md[q] == BUMODE_CRAM)
+	    {
+	      /* Collect remaining materials with the same sparsity pattern */
+	      /* (same nuclides and reactions) to be solved in one batch */
+
+	      ng = 0;
+
+	      for (p = q; p < nb; p++)
+		if ((grp[p] == NO) && (md[p] == BUMODE_CRAM) &&
+		    (A[p]->n == A[q]->n) && (A[p]->nnz == A[q]->nnz) &&
+		    (!memcmp(A[p]->colptr, A[q]->colptr, 
+			     (A[q]->n + 1)*sizeof(long))) &&
+		    (!memcmp(A[p]->rowind, A[q]->rowind, 
+			     A[q]->nnz*sizeof(long))))
+		  {
+		    /* Allocate memory for solution */
+
+		    N[p] = (double *)Mem(MEM_ALLOC, sz[p], sizeof(double));
+
+		    /* Add to batch */
+
+		    Ag[ng] = A[p];
+		    N0g[ng] = N0[p];
+		    Ng[ng] = N[p];
+		    tg[ng++] = t2 - t1;
+
+		    grp[p] = YES;
+		  }
+
+	      /* Solve */
+
+	      MatrixExponentialBatch(Ag, N0g, tg, ng, Ng);
+	    }
+	  else
+	    Die(FUNCTION_NAME, "Invalid burnup mode");
+	}
 
       /* Stop timers */
       
       StopTimer(TIMER_BATEMAN);
       StopTimer(TIMER_BATEMAN_TOTAL);
+
+      /* Loop over materials in batch */
+
+      for (q = 0; q < nb; q++)
+	{
+	  /* Print depletion matrix with final composition */
       
-      /* Print depletion matrix with final composition */
-      
-      PrintDepMatrix(mat, A, t2 - t1, N0, N, id); 
+	  PrintDepMatrix(mat[q], A[q], t2 - t1, N0[q], N[q], id); 
 
-      /* Check negative */
+	  /* Check negative */
 
-      for (i = 0; i < sz; i++)
- 	if (N[i] < 0.0)
-	  {
-	    if (N[i] < -1E-12)
-	      Warn(FUNCTION_NAME, "N[%ld] = %E\n", i, N[i]);
-	    N[i] = 0.0; 
-	  }
+	  for (i = 0; i < sz[q]; i++)
+	    if (N[q][i] < 0.0)
+	      {
+		if (N[q][i] < -1E-12)
+		  Warn(FUNCTION_NAME, "N[%ld] = %E\n", i, N[q][i]);
+		N[q][i] = 0.0; 
+	      }
 
-      /* Free burnup matrix and N0 (which is no longer needed)*/
+	  /* Free burnup matrix and N0 (which is no longer needed)*/
       
-      ccsMatrixFree(A);
-      Mem(MEM_FREE, N0); 
+	  ccsMatrixFree(A[q]);
+	  Mem(MEM_FREE, N0[q]); 
 
-      /* the final composition becomes initial for the next substep */
+	  /* the final composition becomes initial for the next substep */
       
-      N0 = N;
+	  N0[q] = N[q];
+	}
     } 
 
-  /* free the EOS composition array */
-
-  Mem(MEM_FREE, Neos);
-  
   /***************************************************************************/
 
-  /***** Put final composition ***********************************************/
+  /***** Put final compositions **********************************************/
   
-  /* Reset index and total atomic density */
+  /* Loop over materials in batch */
+
+  for (q = 0; q < nb; q++)
+    {
+      /* free the EOS composition array */
+
+      Mem(MEM_FREE, Neos[q]);
+
+      /* Reset index and total atomic density */
       
-  i = 0;
-  tot = 0.0;
+      i = 0;
+      tot = 0.0;
   
-  /* Update composition */
+      /* Update composition */
   
-  iso = (long)RDB[mat + MATERIAL_PTR_COMP];
-  while (iso > VALID_PTR)
-    {
-      /* Put atomic density */
-      /* with SIE, only update atomic densities on corrector */
-      /* (or first predictor)                                */
-      if((RDB[DATA_BURN_SIE] == (double)NO) || 
-	 (!((RDB[DATA_BURN_STEP_PC] == PREDICTOR_STEP) && 
-	    (RDB[DATA_BURN_STEP] != 0.0))))
-	WDB[iso + COMPOSITION_ADENS] = N[i++];    
+      iso = (long)RDB[mat[q] + MATERIAL_PTR_COMP];
+      while (iso > VALID_PTR)
+	{
+	  /* Put atomic density */
+	  /* with SIE, only update atomic densities on corrector */
+	  /* (or first predictor)                                */
+	  if((RDB[DATA_BURN_SIE] == (double)NO) || 
+	     (!((RDB[DATA_BURN_STEP_PC] == PREDICTOR_STEP) && 
+		(RDB[DATA_BURN_STEP] != 0.0))))
+	    WDB[iso + COMPOSITION_ADENS] = N[q][i++];    
       
-      /* Add to total */
+	  /* Add to total */
       
-      tot = tot + RDB[iso + COMPOSITION_ADENS]; 
+	  tot = tot + RDB[iso + COMPOSITION_ADENS]; 
       
-      /* Next nuclide */
+	  /* Next nuclide */
       
-      iso = NextItem(iso);                       
-    }
+	  iso = NextItem(iso);                       
+	}
   
-  /* Put total atomic density */
-  /* with SIE, only update atomic densities on corrector (or first predictor) */
+      /* Put total atomic density */
+      /* with SIE, only update atomic densities on corrector (or first */
+      /* predictor) */
   
-  if((RDB[DATA_BURN_SIE] == (double)NO) || 
-     (!((RDB[DATA_BURN_STEP_PC] == PREDICTOR_STEP) && 
-	(RDB[DATA_BURN_STEP] != 0.0))))  
-    WDB[mat + MATERIAL_ADENS] = tot;
+      if((RDB[DATA_BURN_SIE] == (double)NO) || 
+	 (!((RDB[DATA_BURN_STEP_PC] == PREDICTOR_STEP) && 
+	    (RDB[DATA_BURN_STEP] != 0.0))))  
+	WDB[mat[q] + MATERIAL_ADENS] = tot;
   
-  /* Free composition vectors (at this point N = N0) */
+      /* Free composition vectors (at this point N = N0) */
   
-  Mem(MEM_FREE, N); 
+      Mem(MEM_FREE, N[q]); 
+    }
 
+  /* Free pointer arrays */
+
+  Mem(MEM_FREE, A);
+  Mem(MEM_FREE, Ag);
+  Mem(MEM_FREE, N);
+  Mem(MEM_FREE, N0);
+  Mem(MEM_FREE, Neos);
+  Mem(MEM_FREE, Ng);
+  Mem(MEM_FREE, N0g);
+  Mem(MEM_FREE, tg);
+  Mem(MEM_FREE, sz);
+  Mem(MEM_FREE, md);
+  Mem(MEM_FREE, grp);
 }
 
 /*****************************************************************************/
@@ -0,0 +1,138 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : cachedsymboliclu.c                             */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Returns symbolic LU decomposition of burnup matrix with      */
+/*              numerical values copied from the matrix                      */
+/*                                                                           */
+/* Comments: - SymbolicLU() and FindRowIndexes() depend only on the          */
+/*             sparsity pattern, which is the same for all depletion zones   */
+/*             with the same nuclide inventory. The result is stored per     */
+/*             thread and re-used as long as the pattern does not change.    */
+/*                                                                           */
+/*           - The returned matrix belongs to the cache and must not be      */
+/*             freed by the caller. Memory is freed in FreeLUCache().        */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "CachedSymbolicLU:"
+
+/*****************************************************************************/
+
+struct ccsMatrix *CachedSymbolicLU(struct ccsMatrix *A, long id)
+{
+  long n, nnz, i, j, k;
+  struct LUCache *c;
+  struct ccsMatrix *LU;
+
+  /* Check thread id */
+
+  CheckValue(FUNCTION_NAME, "id", "", id, 0, MAX_OMP_THREADS - 1);
+
+  /* Pointer to cache */
+
+  c = &lucache[id];
+
+  /* Get size */
+
+  n = A->n;
+  nnz = A->nnz;
+
+  /* Compare sparsity pattern to previous */
+
+  if ((c->LU == NULL) || (c->n != n) || (c->nnz != nnz) ||
+      (memcmp(c->colptr, A->colptr, (n + 1)*sizeof(long))) ||
+      (memcmp(c->rowind, A->rowind, nnz*sizeof(long))))
+    {
+      /***********************************************************************/
+
+      /***** New pattern *****************************************************/
+
+      /* Free previous */
+
+      if (c->LU != NULL)
+	{
+	  ccsMatrixFree(c->LU);
+	  Mem(MEM_FREE, c->colptr);
+	  Mem(MEM_FREE, c->rowind);
+	  Mem(MEM_FREE, c->map);
+	}
+
+      /* Symbolic decomposition and row indexes for NumericGauss() */
+
+      LU = SymbolicLU(A);
+      FindRowIndexes(LU);
+
+      /* Store pattern */
+
+      c->n = n;
+      c->nnz = nnz;
+
+      c->colptr = (long *)Mem(MEM_ALLOC, n + 1, sizeof(long));
+      memcpy(c->colptr, A->colptr, (n + 1)*sizeof(long));
+
+      c->rowind = (long *)Mem(MEM_ALLOC, nnz + 1, sizeof(long));
+      memcpy(c->rowind, A->rowind, nnz*sizeof(long));
+
+      /* Find positions of original non-zeros in LU (columns are sorted */
+      /* by row index in SymbolicLU()) */
+
+      c->map = (long *)Mem(MEM_ALLOC, nnz + 1, sizeof(long));
+
+      for (j = 0; j < n; j++)
+	for (i = A->colptr[j]; i < A->colptr[j + 1]; i++)
+	  {
+	    /* Loop over column in LU */
+
+	    for (k = LU->colptr[j]; k < LU->colptr[j + 1]; k++)
+	      if (LU->rowind[k] == A->rowind[i])
+		break;
+
+	    /* Check */
+
+	    if (k == LU->colptr[j + 1])
+	      Die(FUNCTION_NAME, "Non-zero (%ld, %ld) not found in LU",
+		  A->rowind[i], j);
+
+	    /* Put position */
+
+	    c->map[i] = k;
+	  }
+
+      /* Put pointer */
+
+      c->LU = LU;
+
+      /***********************************************************************/
+    }
+
+  /* Pointer to decomposition */
+
+  LU = c->LU;
+
+  /* Reset values and copy non-zeros from original matrix */
+
+  memset(LU->values, 0, LU->nnz*sizeof(complex));
+
+  for (i = 0; i < nnz; i++)
+    LU->values[c->map[i]] = A->values[i];
+
+  /* Return pointer */
+
+  return LU;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
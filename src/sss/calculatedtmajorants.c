@@ -130,20 +130,6 @@ void CalculateDTMajorants()
       return;      
     }
 
-  /* Continuous-energy mode, reset thread numbers for OpenMP parallelization */
-
-  mat = (long)RDB[DATA_PTR_M0];
-  while (mat > VALID_PTR)
-    {
-      /* Reset thread number */
-      
-      WDB[mat + MATERIAL_OMP_ID] = -1.0;
-      
-      /* Next material */
-      
-      mat = NextItem(mat);
-    }	  
-
   /***************************************************************************/
 
   /***** Neutron majorant ****************************************************/
@@ -178,6 +164,10 @@ void CalculateDTMajorants()
 	  maj[i] = (double *)Mem(MEM_ALLOC, ne, sizeof(double));
 	}
       
+      /* Distribute materials included in majorant to threads */
+
+      ScheduleMatTasks(MAT_TASK_MAJORANT);
+
       /* Start parallel timer */
 
       StartTimer(TIMER_OMP_PARA);
@@ -190,51 +180,17 @@ void CalculateDTMajorants()
 
 	PrintProgress(0, 0);
 
-	/* Loop over materials */
+	/* Loop over tasks */
 	
-	mat = (long)RDB[DATA_PTR_M0];
-	while (mat > VALID_PTR)
+	while ((mat = NextMatTask(OMP_THREAD_NUM)) > VALID_PTR)
 	  {
-
-	    /* Check if material is included in majorant */
-
-	    if (!((long)RDB[mat + MATERIAL_OPTIONS] & OPT_INCLUDE_MAJORANT))
-	      {
-		/* Next material */
-	    
-		mat = NextItem(mat);
-
-		/* Cycle loop */
-
-		continue;
-	      }
-
-#ifdef OPEN_MP
-#pragma omp critical
-#endif
-	    {
-	      /* Grab material */
-	      
-	      if ((long)RDB[mat + MATERIAL_OMP_ID] == -1)
-		WDB[mat + MATERIAL_OMP_ID] = OMP_THREAD_NUM;
-	    }
-
-	    /* Check thread number */
-	
-	    if ((long)RDB[mat + MATERIAL_OMP_ID] == OMP_THREAD_NUM)
-	      {
-		/* Process */
+	    /* Process */
 		
-		CalculateDTMajorants0(mat, maj[OMP_THREAD_NUM], erg);
+	    CalculateDTMajorants0(mat, maj[OMP_THREAD_NUM], erg);
 
-		/* Print */
+	    /* Print */
 
-		PrintProgress(mat, 1);
-	      }
-	
-	    /* Next material */
-	    
-	    mat = NextItem(mat);
+	    PrintProgress(mat, 1);
 	  }
       }
 
@@ -301,6 +257,10 @@ void CalculateDTMajorants()
       /* Print */
 
       PrintProgress(0, 100);
+
+      /* Print load balance and free task list */
+
+      FinishMatTasks();
     }
 
   /***************************************************************************/
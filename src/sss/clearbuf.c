@@ -24,7 +24,8 @@ extern "C" {
 
 void ClearBuf()
 {
-  long sz, max, i, nseg;
+  long sz, max, i, n, nseg;
+  struct SparseTab *tab;
 
   /* Check if access is allowed */
 
@@ -42,6 +43,11 @@ void ClearBuf()
     nseg = 1;
   else
     nseg = (long)RDB[DATA_OMP_MAX_THREADS];
+
+  /* Empty thread-private caches of shared buffer (data is reset below) */
+
+  for (i = 0; i < (long)RDB[DATA_OMP_MAX_THREADS]; i++)
+    FlushBufCache(i);
   
   /* Loop over segments and reset data */
 
@@ -58,6 +64,32 @@ void ClearBuf()
       memset(&BUF[i*sz], 0.0, max*sizeof(double));
   }
   
+  /* Clear sparse buffer */
+
+  ClearSparseBuf();
+
+  /* Reset tables of scores forwarded to other MPI tasks (memory is */
+  /* kept for the next cycle) */
+
+  for (i = 0; i < (long)RDB[DATA_OMP_MAX_THREADS]; i++)
+    for (n = 0; n < dtally.fwd[i].n; n++)
+      {
+	/* Pointer to table */
+
+	tab = &dtally.fwd[i].tab[n];
+
+	/* Check if used */
+
+	if (tab->n == 0)
+	  continue;
+
+	/* Reset data and number of entries */
+
+	memset(tab->key, -1, tab->sz*sizeof(long));
+	memset(tab->dat, 0, tab->sz*BUF_BLOCK_SIZE*sizeof(double));
+	tab->n = 0;
+      }
+
   /* Reset reduced flag */
       
   WDB[DATA_BUF_REDUCED] = (double)NO;
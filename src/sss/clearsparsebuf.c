@@ -0,0 +1,61 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : clearsparsebuf.c                               */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Clears sparse scoring buffer tables                          */
+/*                                                                           */
+/* Comments: - Called from ClearBuf(). Memory is kept for the next cycle.    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "ClearSparseBuf:"
+
+/*****************************************************************************/
+
+void ClearSparseBuf()
+{
+  long n;
+  struct SparseTab *tab;
+
+  /* Loop over tables */
+
+#ifdef OPEN_MP
+#pragma omp parallel for private(n, tab)
+#endif
+
+  for (n = 0; n < spbuf.n*spbuf.nt; n++)
+    {
+      /* Pointer to table */
+
+      tab = &spbuf.tab[n];
+
+      /* Check if used */
+
+      if (tab->n == 0)
+	continue;
+
+      /* Reset data */
+
+      memset(tab->key, -1, tab->sz*sizeof(long));
+      memset(tab->dat, 0, tab->sz*BUF_BLOCK_SIZE*sizeof(double));
+
+      /* Reset number of entries */
+
+      tab->n = 0;
+    }
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
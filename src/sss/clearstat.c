@@ -88,6 +88,11 @@ void ClearStat(long ptr)
       if ((long)RDB[ptr + SCORE_DIM] < 1)
 	Die(FUNCTION_NAME, "Tälle pitää tehdä jotain");
 
+      /* Decomposed statistics have one slab only */
+
+      if ((long)RDB[ptr + SCORE_DECOMP_SLAB] > 0)
+	nmax = (long)RDB[ptr + SCORE_DECOMP_SLAB];
+
       /* Loop over values */
       
       for (n = 0; n < nmax; n++)
@@ -24,7 +24,7 @@ extern "C" {
 
 int Cmain(int argc, char** argv)
 {
-  long ptr, idx[10000], ncoef, more;
+  long ptr, idx[10000], ncoef, more, snap;
   char str[MAX_STR];
   double t;
 
@@ -56,6 +56,10 @@ int Cmain(int argc, char** argv)
 
       InitSignal();
 
+      /* Reset snapshot flag */
+
+      snap = NO;
+
       /***********************************************************************/
 
       /***** Initial processing before MPI parallelization *******************/
@@ -124,481 +128,501 @@ int Cmain(int argc, char** argv)
 	  ReadInput(GetText(DATA_PTR_INPUT_FNAME));
 	  fprintf(out, "\n");
 
-	  /* Reconfigure complement cells */
+	  /* Restore processed data from snapshot */
 
-	  ProcessComplementCells();
+	  snap = ReadSnapshot();
+	}
 
-	  /* Check for re-deplete */
+      /* Check if processed data was restored from snapshot */
+
+      if (snap == NO)
+	{
+	  /* Check MPI id number */
 
-	  if ((long)RDB[DATA_PARTICLE_REDEPLETE_MODE] == YES)
+	  if (mpiid == 0)
 	    {
-	      /* Process inventory list */
+	      /* Reconfigure complement cells */
 
-	      ProcessInventory();
+	      ProcessComplementCells();
 
-	      /* Print depletion output */
+	      /* Check for re-deplete */
 
-	      PrintDepOutput();
+	      if ((long)RDB[DATA_PARTICLE_REDEPLETE_MODE] == YES)
+		{
+		  /* Process inventory list */
 
-	      /* Free memory */
+		  ProcessInventory();
 
-	      FreeMem();
+		  /* Print depletion output */
 
-	      /* Exit */
+		  PrintDepOutput();
 
-	      exit(-1);
-	    }
+		  /* Free memory */
+
+		  FreeMem();
+
+		  /* Exit */
 
-	  /* Check that the mode is right for group constant generation */
+		  exit(-1);
+		}
 
-	  if ((long)RDB[DATA_PTR_GCU0] > 0)
-	    if ((long)RDB[DATA_OPTI_MODE] != 4)
-	      Note(0, "Optimization mode 4 shoud be used for GC generation");
+	      /* Check that the mode is right for group constant generation */
 
-	  /* Coefficient calculations */
+	      if ((long)RDB[DATA_PTR_GCU0] > 0)
+		if ((long)RDB[DATA_OPTI_MODE] != 4)
+		  Note(0, "Optimization mode 4 shoud be used for GC generation");
 
-	  CheckCoefCalc();
+	      /* Coefficient calculations */
 
-	  ncoef = SetCoefCalc(ncoef);
+	      CheckCoefCalc();
 
-	  /* Reset burnup mode if no burnable materials are defined, or */
-	  /* set if restart file is read. (miks tää ei voi olla tuolla  */
-	  /* setoptimization.c:ssä?) */
+	      ncoef = SetCoefCalc(ncoef);
 
-	  if ((long)RDB[DATA_BURN_MATERIALS_FLAG] == NO)
-	    WDB[DATA_BURNUP_CALCULATION_MODE] = (double)NO;
-	  else if ((long)RDB[DATA_READ_RESTART_FILE] == YES)
-	    WDB[DATA_BURNUP_CALCULATION_MODE] = (double)YES;
+	      /* Reset burnup mode if no burnable materials are defined, or */
+	      /* set if restart file is read. (miks tää ei voi olla tuolla */
+	      /* setoptimization.c:ssä?) */
 
-	  /* Check for coefficient calculation */
+	      if ((long)RDB[DATA_BURN_MATERIALS_FLAG] == NO)
+		WDB[DATA_BURNUP_CALCULATION_MODE] = (double)NO;
+	      else if ((long)RDB[DATA_READ_RESTART_FILE] == YES)
+		WDB[DATA_BURNUP_CALCULATION_MODE] = (double)YES;
 
-	  if ((long)RDB[DATA_PTR_COEF0] > VALID_PTR)
-	    {
-	      /* Check run index */
+	      /* Check for coefficient calculation */
 
-	      if ((long)RDB[DATA_COEF_CALC_IDX] < 0)
+	      if ((long)RDB[DATA_PTR_COEF0] > VALID_PTR)
 		{
-		  /* Original run, set restart file writing */
+		  /* Check run index */
 
-		  WDB[DATA_WRITE_RESTART_FILE] = (double)YES;
-		  WDB[DATA_RESTART_WRITE_PTR_FNAME] = NULLPTR;
+		  if ((long)RDB[DATA_COEF_CALC_IDX] < 0)
+		    {
+		      /* Original run, set restart file writing */
 
-		  /* Switch group constant calculation off */
+		      WDB[DATA_WRITE_RESTART_FILE] = (double)YES;
+		      WDB[DATA_RESTART_WRITE_PTR_FNAME] = NULLPTR;
 
-		  WDB[DATA_PTR_GCU0] = NULLPTR;
-		  WDB[DATA_PTR_ADF0] = NULLPTR;
-		  WDB[DATA_PTR_PPW0] = NULLPTR;
-		  WDB[DATA_B1_CALC] = (double)NO;
-		  WDB[DATA_OPTI_POISON_CALC] = (double)NO;
-		}
-	      else
-		{
-		  /* Set or reset burnup mode (set on earlier when restart */
-		  /* file flag is checked, but should be off if branches   */
-		  /* are run without burnup). */
+		      /* Switch group constant calculation off */
 
-		  if ((long)RDB[DATA_BURN_PTR_DEP] > VALID_PTR)
-		    WDB[DATA_BURNUP_CALCULATION_MODE] = (double)YES;
+		      WDB[DATA_PTR_GCU0] = NULLPTR;
+		      WDB[DATA_PTR_ADF0] = NULLPTR;
+		      WDB[DATA_PTR_PPW0] = NULLPTR;
+		      WDB[DATA_B1_CALC] = (double)NO;
+		      WDB[DATA_OPTI_POISON_CALC] = (double)NO;
+		    }
 		  else
-		    WDB[DATA_BURNUP_CALCULATION_MODE] = (double)NO;
+		    {
+		      /* Set or reset burnup mode (set on earlier when restart */
+		      /* file flag is checked, but should be off if branches */
+		      /* are run without burnup). */
+
+		      if ((long)RDB[DATA_BURN_PTR_DEP] > VALID_PTR)
+			WDB[DATA_BURNUP_CALCULATION_MODE] = (double)YES;
+		      else
+			WDB[DATA_BURNUP_CALCULATION_MODE] = (double)NO;
 
-		  /* Reset restart file writing and depletion history */
+		      /* Reset restart file writing and depletion history */
 
-		  WDB[DATA_WRITE_RESTART_FILE] = (double)NO;
-		  WDB[DATA_RESTART_READ_PTR_FNAME] = NULLPTR;
+		      WDB[DATA_WRITE_RESTART_FILE] = (double)NO;
+		      WDB[DATA_RESTART_READ_PTR_FNAME] = NULLPTR;
 
-		  WDB[DATA_BURN_PTR_DEP] = NULLPTR;
-		  WDB[DATA_BURN_TOT_STEPS] = 0.0;
+		      WDB[DATA_BURN_PTR_DEP] = NULLPTR;
+		      WDB[DATA_BURN_TOT_STEPS] = 0.0;
+		    }
 		}
-	    }
 
-	  /* Check restart file (NOTE: Ei-palamamoodi toimii versioss 2.1.24 */
-	  /* pelkästään fotonilaskussa. Neutronidatamuotoiset ACE-nuklidit   */
-	  /* korvataan tässä ensin hajoamisdatalla, joka sitten myöhemmin    */
-	  /* muutetaan alkuainekohtaisiksi koostumuksiksi ja fotonidataksi.  */
+	      /* Check restart file (NOTE: Ei-palamamoodi toimii versioss 2.1.24 */
+	      /* pelkästään fotonilaskussa. Neutronidatamuotoiset ACE-nuklidit */
+	      /* korvataan tässä ensin hajoamisdatalla, joka sitten myöhemmin */
+	      /* muutetaan alkuainekohtaisiksi koostumuksiksi ja fotonidataksi. */
 
-	  if ((long)RDB[DATA_BURNUP_CALCULATION_MODE] == YES)
-	    ReadRestartFile(RESTART_CHECK);
-	  else
-	    ReadRestartFile(RESTART_REPLACE);
+	      if ((long)RDB[DATA_BURNUP_CALCULATION_MODE] == YES)
+		ReadRestartFile(RESTART_CHECK);
+	      else
+		ReadRestartFile(RESTART_REPLACE);
 
-	  /* Process time binnings */
+	      /* Process time binnings */
 
-	  ProcessTimeBins();
+	      ProcessTimeBins();
 
-	  /* Remove void cells */
+	      /* Remove void cells */
 
-	  RemoveVoidCells();
+	      RemoveVoidCells();
 
-	  /* Read STL geometries */
+	      /* Read STL geometries */
 
-	  ReadSTLGeometry();
+	      ReadSTLGeometry();
 
-	  /* Check duplicate input definitions */
+	      /* Check duplicate input definitions */
 
-	  CheckDuplicates();
+	      CheckDuplicates();
 
-	  /* Process FINIX definitions */
+	      /* Process FINIX definitions */
 
-	  ProcessFinix();
+	      ProcessFinix();
 
-	  /* Fill ifc time bins with FINIX pointers*/
+	      /* Fill ifc time bins with FINIX pointers*/
 
-	  DistributeFinix();
+	      DistributeFinix();
 
-	  /* Read pebble bed geometries */
+	      /* Read pebble bed geometries */
 
-	  ReadPBGeometry();
+	      ReadPBGeometry();
 
-	  /* Read unstructured mesh based geometry */
+	      /* Read unstructured mesh based geometry */
 
-	  ReadUMSHGeometry();
+	      ReadUMSHGeometry();
 
-	  /* Process depletion history (voidaan kutsua jo tässä) */
+	      /* Process depletion history (voidaan kutsua jo tässä) */
 
-	  ProcessDepHis();
+	      ProcessDepHis();
 
-	  /* Set optimization */
+	      /* Set optimization */
 
-	  SetOptimization();
+	      SetOptimization();
 
-	  /* Initialize secondary RNG */
+	      /* Initialize secondary RNG */
 
-	  srand48(parent_seed);
+	      srand48(parent_seed);
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
+	      WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
 
-	  /* Process burnup material divisors */
+	      /* Process burnup material divisors */
 
-	  ProcessDivisors();
+	      ProcessDivisors();
 
-	  /* Processing for MSR calculations */
+	      /* Processing for MSR calculations */
 
-	  ProcessMSR();
+	      ProcessMSR();
 
-	  /* Divide burnable zones */
+	      /* Divide burnable zones */
 
-	  DivideBurnMat();
+	      DivideBurnMat();
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_MAT_BYTES] = RDB[DATA_TOT_MAT_BYTES] + MemCount();
+	      WDB[DATA_TOT_MAT_BYTES] = RDB[DATA_TOT_MAT_BYTES] + MemCount();
 
-	  /* Process stochastic geometries */
+	      /* Process stochastic geometries */
 
-	  ProcessPBGeometry();
+	      ProcessPBGeometry();
 
-	  /* Process unstructured mesh based geometries */
+	      /* Process unstructured mesh based geometries */
 
-	  ProcessUMSHGeometry();
+	      ProcessUMSHGeometry();
 
-	  /* This is used for testing and debugging only (terminates run) */
+	      /* This is used for testing and debugging only (terminates run) */
 
-	  if (1 == 2)
-	    WriteUMSHtoSTL();
+	      if (1 == 2)
+		WriteUMSHtoSTL();
 
-	  /* Create universes in geometry */
+	      /* Create universes in geometry */
 
-	  CreateGeometry();
+	      CreateGeometry();
 
-	  /* Process reprocessors */
+	      /* Process reprocessors */
 
-	  ProcessReprocessors();
+	      ProcessReprocessors();
 
-	  /* Count number of zones */
+	      /* Count number of zones */
 
-	  ZoneCount(-1, -1, 0);
+	      ZoneCount(-1, -1, 0);
 
-	  /* Create super-imposed search meshes */
+	      /* Create super-imposed search meshes */
 
-	  ProcessCellMesh();
+	      ProcessCellMesh();
 
-	  /* Process universe transformations */
+	      /* Process universe transformations */
 
-	  ProcessTransformations();
+	      ProcessTransformations();
 
-	  /* Process universe symmetries */
+	      /* Process universe symmetries */
 
-	  ProcessSymmetries();
+	      ProcessSymmetries();
 
-	  /* Check and remove unused stuff */
+	      /* Check and remove unused stuff */
 
-	  CheckUnused();
+	      CheckUnused();
 
-	  /* Process cells */
+	      /* Process cells */
 
-	  ProcessCells();
+	      ProcessCells();
 
-	  /* Process nests */
+	      /* Process nests */
 
-	  ProcessNests();
+	      ProcessNests();
 
-	  /* Process STL geometries */
+	      /* Process STL geometries */
 
-	  ProcessSTLGeometry();
+	      ProcessSTLGeometry();
 
-	  /* Set material pointers */
+	      /* Set material pointers */
 
-	  FindMaterialPointers();
+	      FindMaterialPointers();
 
-	  /* Process boundary conditions (must be called after symmetries */
-	  /* and transformations are processed) */
+	      /* Process boundary conditions (must be called after symmetries */
+	      /* and transformations are processed) */
 
-	  ProcessBC();
+	      ProcessBC();
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
+	      WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
 
-	  /* Make depletion zones */
+	      /* Make depletion zones */
 
-	  MakeDepletionZones(-1, -1, 0, 0, 0, idx);
+	      MakeDepletionZones(-1, -1, 0, 0, 0, idx);
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_MAT_BYTES] = RDB[DATA_TOT_MAT_BYTES] + MemCount();
+	      WDB[DATA_TOT_MAT_BYTES] = RDB[DATA_TOT_MAT_BYTES] + MemCount();
 
-	  /* Process sources, energy grids and detectors (must be done before */
-	  /* unused cells and materials are removed) */
+	      /* Process sources, energy grids and detectors (must be done before */
+	      /* unused cells and materials are removed) */
 
-	  InitPrecDetSource();
-	  ProcessSources();
-	  ProcessUserEGrids();
+	      InitPrecDetSource();
+	      ProcessSources();
+	      ProcessUserEGrids();
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
+	      WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
 
-	  /* Add live and file detectors for precursors */
+	      /* Add live and file detectors for precursors */
 
-	  AllocPrecDet();
+	      AllocPrecDet();
 
-	  /* Process detectors */
+	      /* Process detectors */
 
-	  ProcessDetectors();
+	      ProcessDetectors();
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_RES_BYTES] = RDB[DATA_TOT_RES_BYTES] + MemCount();
+	      WDB[DATA_TOT_RES_BYTES] = RDB[DATA_TOT_RES_BYTES] + MemCount();
 
-	  /* Remove unused materials */
+	      /* Remove unused materials */
 
-	  ptr = (long)RDB[DATA_PTR_M0];
-	  RemoveFlaggedItems(ptr, MATERIAL_OPTIONS, OPT_USED, NO);
+	      ptr = (long)RDB[DATA_PTR_M0];
+	      RemoveFlaggedItems(ptr, MATERIAL_OPTIONS, OPT_USED, NO);
 
-	  /* Process lattices */
+	      /* Process lattices */
 
-	  ProcessLattices();
+	      ProcessLattices();
 
-	  /* Find universe boundaries */
+	      /* Find universe boundaries */
 
-	  UniverseBoundaries();
+	      UniverseBoundaries();
 
-	  /* Calculate nest volumes */
+	      /* Calculate nest volumes */
 
-	  NestVolumes();
+	      NestVolumes();
 
-	  /* Calculate cell volumes */
+	      /* Calculate cell volumes */
 
-	  CellVolumes();
+	      CellVolumes();
 
-	  /* Count number of cells */
+	      /* Count number of cells */
 
-	  CellCount(-1, -1, 0, 1);
+	      CellCount(-1, -1, 0, 1);
 
-	  /* Calculate material volumes */
+	      /* Calculate material volumes */
 
-	  MaterialVolumes();
+	      MaterialVolumes();
 
-	  /* Print geometry data to output file */
+	      /* Print geometry data to output file */
 
-	  PrintGeometryData();
+	      PrintGeometryData();
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
+	      WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
 
-	  /* Process core power distributions */
+	      /* Process core power distributions */
 
-	  ProcessCPD();
+	      ProcessCPD();
 
-	  /* Process statistics */
+	      /* Process statistics */
 
-	  ProcessStats();
+	      ProcessStats();
 
-	  /* Process entropy stuff */
+	      /* Process entropy stuff */
 
-	  ProcessEntropy();
+	      ProcessEntropy();
 
-	  /* Process GC stuff */
+	      /* Process GC stuff */
 
-	  ProcessGC();
+	      ProcessGC();
 
-	  /* Process ICM stuff */
+	      /* Process ICM stuff */
 
-	  ProcessICM();
+	      ProcessICM();
 
-	  /* Remove unused surfaces (poistaa nyt kaikki) */
+	      /* Remove unused surfaces (poistaa nyt kaikki) */
 
-	  ptr = (long)RDB[DATA_PTR_S0];
-	  RemoveFlaggedItems(ptr, SURFACE_OPTIONS, OPT_USED, NO);
+	      ptr = (long)RDB[DATA_PTR_S0];
+	      RemoveFlaggedItems(ptr, SURFACE_OPTIONS, OPT_USED, NO);
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_RES_BYTES] = RDB[DATA_TOT_RES_BYTES] + MemCount();
+	      WDB[DATA_TOT_RES_BYTES] = RDB[DATA_TOT_RES_BYTES] + MemCount();
 
-	  /* Process multi-physics interfaces */
+	      /* Process multi-physics interfaces */
 
-	  ProcessInterface((long)NO); 
+	      ProcessInterface((long)NO); 
 
-	  /* Initialize internally coupled codes */
+	      /* Initialize internally coupled codes */
 
-	  InitInternal();
+	      InitInternal();
 
-	  /* Monte Carlo volume calculator */
+	      /* Monte Carlo volume calculator */
 
-	  VolumesMC();
+	      VolumesMC();
 
-	  /* Experimental version of the disperser routine */
+	      /* Experimental version of the disperser routine */
 
-	  Disperse2();
+	      Disperse2();
 
-	  /* Test STL geometries */
+	      /* Test STL geometries */
 
-	  TestSTLGeometry();
+	      TestSTLGeometry();
 
-	  /* Break if command-line volume MC mode */
+	      /* Break if command-line volume MC mode */
 
-	  if ((long)RDB[DATA_VOLUME_CALCULATION_MODE] == YES)
-	    return -1;
+	      if ((long)RDB[DATA_VOLUME_CALCULATION_MODE] == YES)
+		return -1;
 
-	  /* Expand PRIVA, BUF and RES2 arrays for OpenMP parallel */
-	  /* calculation */
+	      /* Expand PRIVA, BUF and RES2 arrays for OpenMP parallel */
+	      /* calculation */
 
-	  ExpandPrivateArrays();
+	      ExpandPrivateArrays();
 
-	  /* Used for reverse-engineering STL geometries */
+	      /* Used for reverse-engineering STL geometries */
 
-	  if (1 == 2)
-	    STLMatFinder();
+	      if (1 == 2)
+		STLMatFinder();
 
-	  /* Process variance reduction stuff (siirretty 8.10.2015, oli */
-	  /* ennen ProcessMaterials():ia) */
+	      /* Process variance reduction stuff (siirretty 8.10.2015, oli */
+	      /* ennen ProcessMaterials():ia) */
 
-	  ProcessVR();
+	      ProcessVR();
 
-	  /* Plot geometry */
+	      /* Plot geometry */
 
-	  GeometryPlotter(YES);
+	      GeometryPlotter(YES);
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
+	      WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
 
-	  /* Process nuclides */
+	      /* Process nuclides */
 
-	  ProcessNuclides();
+	      ProcessNuclides();
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_XS_BYTES] = RDB[DATA_TOT_XS_BYTES] + MemCount();
+	      WDB[DATA_TOT_XS_BYTES] = RDB[DATA_TOT_XS_BYTES] + MemCount();
 
-	  /* Process inventory list */
+	      /* Process inventory list */
 
-	  ProcessInventory();
+	      ProcessInventory();
 
-	  /* Update memory size */
+	      /* Update memory size */
 
-	  WDB[DATA_TOT_RES_BYTES] = RDB[DATA_TOT_RES_BYTES] + MemCount();
-	}
+	      WDB[DATA_TOT_RES_BYTES] = RDB[DATA_TOT_RES_BYTES] + MemCount();
+	    }
 
-      /***********************************************************************/
+	  /*******************************************************************/
+
+	  /**** MPI parallel part ********************************************/
 
-      /**** MPI parallel part ************************************************/
+	  /* Distribute data to parallel MPI tasks */
 
-      /* Distribute data to parallel MPI tasks */
+	  ShareInputData();
 
-      ShareInputData();
+	  /* Update memory size */
 
-      /* Update memory size */
+	  WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
 
-      WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
+	  /* Process energy grids */
 
-      /* Process energy grids */
+	  StartTimer(TIMER_XS_UNIONIZE);
+	  UnionizeGrid();
+	  StopTimer(TIMER_XS_UNIONIZE);
 
-      UnionizeGrid();
+	  /* Process XS data */
 
-      /* Process XS data */
+	  ProcessXSData();
 
-      ProcessXSData();
+	  /* Generate cache-optimized block */
 
-      /* Generate cache-optimized block */
+	  CacheXS();
 
-      CacheXS();
+	  /* Update memory size */
 
-      /* Update memory size */
+	  WDB[DATA_TOT_XS_BYTES] = RDB[DATA_TOT_XS_BYTES] + MemCount();
 
-      WDB[DATA_TOT_XS_BYTES] = RDB[DATA_TOT_XS_BYTES] + MemCount();
+	  /* Allocate memory for precursor statistics. Loops over nuclide list */
+	  /* Needs precursor group lists to be set (set at ProcessXSData) */
 
-      /* Allocate memory for precursor statistics. Loops over nuclide list */
-      /* Needs precursor group lists to be set (set at ProcessXSData) */
+	  ProcessPrecDet();
 
-      ProcessPrecDet();
+	  /* Process mesh plots */
 
-      /* Process mesh plots */
+	  ProcessMeshPlots();
 
-      ProcessMeshPlots();
+	  /* Update memory size */
 
-      /* Update memory size */
+	  WDB[DATA_TOT_RES_BYTES] = RDB[DATA_TOT_RES_BYTES] + MemCount();
 
-      WDB[DATA_TOT_RES_BYTES] = RDB[DATA_TOT_RES_BYTES] + MemCount();
+	  /* Update memory size */
 
-      /* Update memory size */
+	  WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
 
-      WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
+	  /* Process materials */
 
-      /* Process materials */
+	  ProcessMaterials();
 
-      ProcessMaterials();
+	  /* Update memory size */
 
-      /* Update memory size */
+	  WDB[DATA_TOT_MAT_BYTES] = RDB[DATA_TOT_MAT_BYTES] + MemCount();
 
-      WDB[DATA_TOT_MAT_BYTES] = RDB[DATA_TOT_MAT_BYTES] + MemCount();
+	  /* This is used for testing and debugging only (terminates run) */
 
-      /* This is used for testing and debugging only (terminates run) */
+	  if (1 == 2)
+	    WriteTetMeshtoGeo();
 
-      if (1 == 2)
-	WriteTetMeshtoGeo();
+	  /* Link reactions to sources and detectors */
 
-      /* Link reactions to sources and detectors */
+	  LinkReactions();
 
-      LinkReactions();
+	  /* Allocate memory for interface statistics */
 
-      /* Allocate memory for interface statistics */
+	  AllocInterfaceStat();
 
-      AllocInterfaceStat();
+	  /* Update memory size */
 
-      /* Update memory size */
+	  WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
 
-      WDB[DATA_TOT_MISC_BYTES] = RDB[DATA_TOT_MISC_BYTES] + MemCount();
+	  /* Process fission matrixes */
 
-      /* Process fission matrixes */
+	  ProcessFissMtx();
 
-      ProcessFissMtx();
+	  /* Update memory size */
 
-      /* Update memory size */
+	  WDB[DATA_TOT_RES_BYTES] = RDB[DATA_TOT_RES_BYTES] + MemCount();
+
+	  /* Init particle structures */
 
-      WDB[DATA_TOT_RES_BYTES] = RDB[DATA_TOT_RES_BYTES] + MemCount();
+	  InitHistories();
 
-      /* Init particle structures */
+	  /* Expand PRIVA, BUF and RES2 arrays for OpenMP parallel calculation */
 
-      InitHistories();
+	  ExpandPrivateArrays();
 
-      /* Expand PRIVA, BUF and RES2 arrays for OpenMP parallel calculation */
+	  /* Write snapshot of processed data */
 
-      ExpandPrivateArrays();
+	  WriteSnapshot();
+	}
 
       /* Disallow memory allocation from here on*/
 
@@ -246,16 +246,20 @@ void CoefOutput()
   if ((loc0 = (long)RDB[DATA_PTR_COEF0]) < VALID_PTR)
     return;
 
-  /* Check mpi task */
-
-  if (mpiid > 0)
-    return;
-
   /* Check pointer to gc universes */
   
   if ((gcu = (long)RDB[DATA_PTR_GCU0]) < VALID_PTR)
     return;
 
+  /* Gather decomposed statistics to task 0 */
+
+  GatherDecompStat();
+
+  /* Check mpi task */
+
+  if (mpiid > 0)
+    return;
+
   /* Open file for writing */
   
   sprintf(tmpstr, "%s.coe", GetText(DATA_PTR_INPUT_FNAME));
@@ -533,6 +537,10 @@ void CoefOutput()
   /* Close file */
 
   fclose(fp);
+
+  /* Free gathered statistics */
+
+  FreeDecompStat();
 }
 
 /*****************************************************************************/
@@ -11,7 +11,10 @@ extern "C" {
 /*                                                                           */
 /* Description: Collects scoring buffer in reproducible MPI mode             */
 /*                                                                           */
-/* Comments:                                                                 */
+/* Comments: - Scores to decomposed statistics are sent to the owner tasks  */
+/*             and the slabs are left out of the reduction.                  */
+/*                                                                           */
+/*           - Sparse buffer is collected separately.                        */
 /*                                                                           */
 /*****************************************************************************/
 
@@ -27,7 +30,7 @@ void CollectBuf()
 #ifdef MPI
 
   double *buff;
-  long sz;
+  long sz, ptr, loc0, loc1, n;
 
   /* Check if access is allowed */
 
@@ -53,45 +56,107 @@ void CollectBuf()
 
   sz = (long)RDB[DATA_ALLOC_BUF_SIZE];
 
-  /* Allocate memory for results */
+  /* Send scores to decomposed statistics to owner tasks */
+
+  ExchangeScores();
+
+  /* Collect sparse buffer */
+
+  CollectSparseBuf();
+
+  /* Loop over segments between decomposed slabs (whole buffer if */
+  /* nothing is decomposed) */
+
+  loc0 = 0;
+  ptr = (long)RDB[DATA_PTR_SCORE0];
+
+  while (loc0 < sz)
+    {
+      /* Find next decomposed statistics */
+
+      while ((ptr > VALID_PTR) && ((long)RDB[ptr + SCORE_DECOMP_SLAB] < 1))
+	ptr = NextItem(ptr);
+
+      /* Get end of segment */
+
+      if (ptr > VALID_PTR)
+	loc1 = (long)RDB[ptr + SCORE_PTR_BUF];
+      else
+	loc1 = sz;
+
+      /* Check order */
 
-  if (mpiid == 0)
-    buff = (double *)Mem(MEM_ALLOC, sz, sizeof(double));
-  else
-    buff = NULL;
+      if (loc1 < loc0)
+	Die(FUNCTION_NAME, "Decomposed buffer blocks not in order");
 
-  /* Synchronise */
+      /* Segment size */
 
-  MPI_Barrier(MPI_COMM_WORLD);
+      n = loc1 - loc0;
 
-  /* Reduce data */
+      /* Check size and mode */
 
-  MPITransfer(BUF, buff, sz, 0, MPI_METH_RED);
+      if ((n > 0) &&
+	  ((long)RDB[DATA_OPTI_MPI_COLL_MODE] == MPI_COLL_MODE_BARRIER))
+	{
+	  /* Allocate memory for results */
 
-  /* Move data to original block */
+	  if (mpiid == 0)
+	    buff = (double *)Mem(MEM_ALLOC, n, sizeof(double));
+	  else
+	    buff = NULL;
 
-  if (mpiid == 0)
-    {  
-      /* Copy data */
+	  /* Synchronise */
+
+	  MPI_Barrier(MPI_COMM_WORLD);
+
+	  /* Reduce data */
+
+	  MPITransfer(&BUF[loc0], buff, n, 0, MPI_METH_RED);
+
+	  /* Move data to original block */
+
+	  if (mpiid == 0)
+	    {  
+	      /* Copy data */
       
-      memcpy(BUF, buff, sz*sizeof(double));
+	      memcpy(&BUF[loc0], buff, n*sizeof(double));
   
-      /* Free buffer */
+	      /* Free buffer */
 
-      Mem(MEM_FREE, buff);     
-    }
+	      Mem(MEM_FREE, buff);     
+	    }
+
+	  /* Synchronise */
+
+	  MPI_Barrier(MPI_COMM_WORLD);
 
-  /* Synchronise */
+	  /* Broadcast data to other tasks */
 
-  MPI_Barrier(MPI_COMM_WORLD);
+	  MPITransfer(&BUF[loc0], NULL, n, 0, MPI_METH_BC);
 
-  /* Broadcast data to other tasks */
+	  /* Synchronise */
 
-  MPITransfer(BUF, NULL, sz, 0, MPI_METH_BC);
+	  MPI_Barrier(MPI_COMM_WORLD);
+	}
+      else if (n > 0)
+	{
+	  /* Reduce with nonblocking collective (nothing to overlap here, */
+	  /* since buffer is needed for next cycle) */
 
-  /* Synchronise */
+	  MPIStartReduce(&BUF[loc0], n, MPI_COLL_BUF);
+	  MPIWaitReduce(MPI_COLL_BUF);
+	}
 
-  MPI_Barrier(MPI_COMM_WORLD);
+      /* Skip slab owned by this task */
+
+      if (ptr > VALID_PTR)
+	{
+	  loc0 = loc1 + (long)RDB[ptr + SCORE_DECOMP_SLAB]*BUF_BLOCK_SIZE;
+	  ptr = NextItem(ptr);
+	}
+      else
+	loc0 = sz;
+    }
 
   /* Stop timers */
 
@@ -11,7 +11,9 @@ extern "C" {
 /*                                                                           */
 /* Description: Collects results from parallel MPI tasks                     */
 /*                                                                           */
-/* Comments:                                                                 */
+/* Comments: - Nonblocking collectives without barriers are used unless      */
+/*             "set mpicoll 0" is given. In mode 2 the reduction of RES1 is  */
+/*             overlapped with the reduction of OpenMP private results.      */
 /*                                                                           */
 /*****************************************************************************/
 
@@ -59,41 +61,58 @@ void CollectParallelData()
 
       sz = (long)RDB[DATA_ALLOC_RES1_SIZE];
       
-      /* Allocate memory for results */
+      /* Check mode */
+
+      if ((long)RDB[DATA_OPTI_MPI_COLL_MODE] == MPI_COLL_MODE_BARRIER)
+	{
+	  /* Allocate memory for results */
       
-      if (mpiid == 0)
-	buff = (double *)Mem(MEM_ALLOC, sz, sizeof(double));
-      else
-	buff = NULL;
+	  if (mpiid == 0)
+	    buff = (double *)Mem(MEM_ALLOC, sz, sizeof(double));
+	  else
+	    buff = NULL;
       
-      /* Synchronise */
+	  /* Synchronise */
       
-      MPI_Barrier(MPI_COMM_WORLD);
+	  MPI_Barrier(MPI_COMM_WORLD);
       
-      /* Reduce data */
+	  /* Reduce data */
       
-      MPITransfer(RES1, buff, sz, 0, MPI_METH_RED);
+	  MPITransfer(RES1, buff, sz, 0, MPI_METH_RED);
       
-      /* Move data to original block */
+	  /* Move data to original block */
       
-      if (mpiid == 0)
-	{  
-	  /* Copy data */
+	  if (mpiid == 0)
+	    {  
+	      /* Copy data */
 	  
-	  memcpy(RES1, buff, sz*sizeof(double));
+	      memcpy(RES1, buff, sz*sizeof(double));
 	  
-	  /* Free buffer */
+	      /* Free buffer */
 	  
-	  Mem(MEM_FREE, buff);     
-	}
+	      Mem(MEM_FREE, buff);     
+	    }
       
-      /* Synchronise */
+	  /* Synchronise */
       
-      MPI_Barrier(MPI_COMM_WORLD);
+	  MPI_Barrier(MPI_COMM_WORLD);
       
-      /* Broadcast data to other tasks */
+	  /* Broadcast data to other tasks */
       
-      MPITransfer(RES1, NULL, sz, 0, MPI_METH_BC);
+	  MPITransfer(RES1, NULL, sz, 0, MPI_METH_BC);
+	}
+      else
+	{
+	  /* Start nonblocking reduction */
+
+	  MPIStartReduce(RES1, sz, MPI_COLL_RES1);
+
+	  /* Wait for completion, unless overlapped with reduction of */
+	  /* private results */
+
+	  if ((long)RDB[DATA_OPTI_MPI_COLL_MODE] != MPI_COLL_MODE_OVERLAP)
+	    MPIWaitReduce(MPI_COLL_RES1);
+	}
     }
 
   /***************************************************************************/
@@ -108,45 +127,61 @@ void CollectParallelData()
 
   sz = (long)RDB[DATA_ALLOC_RES2_SIZE];
 
-  /* Allocate memory for results */
+  /* Check mode */
 
-  if (mpiid == 0)
-    buff = (double *)Mem(MEM_ALLOC, sz, sizeof(double));
-  else
-    buff = NULL;
+  if ((long)RDB[DATA_OPTI_MPI_COLL_MODE] == MPI_COLL_MODE_BARRIER)
+    {
+      /* Allocate memory for results */
 
-  /* Synchronise */
+      if (mpiid == 0)
+	buff = (double *)Mem(MEM_ALLOC, sz, sizeof(double));
+      else
+	buff = NULL;
 
-  MPI_Barrier(MPI_COMM_WORLD);
+      /* Synchronise */
+
+      MPI_Barrier(MPI_COMM_WORLD);
 
-  /* Reduce data */
+      /* Reduce data */
 
-  MPITransfer(RES2, buff, sz, 0, MPI_METH_RED);
+      MPITransfer(RES2, buff, sz, 0, MPI_METH_RED);
 
-  /* Move data to original block */
+      /* Move data to original block */
 
-  if (mpiid == 0)
-    {  
-      /* Copy data */
+      if (mpiid == 0)
+	{  
+	  /* Copy data */
       
-      memcpy(RES2, buff, sz*sizeof(double));
+	  memcpy(RES2, buff, sz*sizeof(double));
   
-      /* Free buffer */
+	  /* Free buffer */
 
-      Mem(MEM_FREE, buff);     
-    }
+	  Mem(MEM_FREE, buff);     
+	}
+
+      /* Synchronise */
+
+      MPI_Barrier(MPI_COMM_WORLD);
+
+      /* Broadcast data to other tasks */
 
-  /* Synchronise */
+      MPITransfer(RES2, NULL, sz, 0, MPI_METH_BC);
 
-  MPI_Barrier(MPI_COMM_WORLD);
+      /* Synchronise */
 
-  /* Broadcast data to other tasks */
+      MPI_Barrier(MPI_COMM_WORLD);
+    }
+  else
+    {
+      /* Start nonblocking reduction */
 
-  MPITransfer(RES2, NULL, sz, 0, MPI_METH_BC);
+      MPIStartReduce(RES2, sz, MPI_COLL_RES2);
 
-  /* Synchronise */
+      /* Wait for completion (RES1 may still be pending) */
 
-  MPI_Barrier(MPI_COMM_WORLD);
+      MPIWaitReduce(MPI_COLL_RES1);
+      MPIWaitReduce(MPI_COLL_RES2);
+    }
 
   /***************************************************************************/
 
@@ -0,0 +1,176 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : collectsparsebuf.c                             */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Collects sparse scoring buffer in reproducible MPI mode      */
+/*                                                                           */
+/* Comments: - Called from CollectBuf() after ReduceSparseBuf(). Used        */
+/*             entries of all tasks are gathered to all tasks, and the       */
+/*             tables are rebuilt by adding the entries in task order, so    */
+/*             the sums are identical in all tasks.                          */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "CollectSparseBuf:"
+
+/*****************************************************************************/
+
+void CollectSparseBuf()
+{
+#ifdef MPI
+
+  long k, n, m, tot, nr;
+  int *rcnt, *rdsp, task, cnt;
+  double *snd, *rcv, *dat;
+  struct SparseTab *tab;
+
+  /* Check sparse statistics */
+
+  if (spbuf.n == 0)
+    return;
+
+  /***************************************************************************/
+
+  /***** Pack entries ********************************************************/
+
+  /* Count used entries */
+
+  tot = 0;
+
+  for (k = 0; k < spbuf.n; k++)
+    tot = tot + spbuf.tab[k*spbuf.nt].n;
+
+  /* Check message size */
+
+  if (5*tot > (long)INT_MAX)
+    Die(FUNCTION_NAME, "Too many entries in sparse buffer (%ld)", tot);
+
+  /* Allocate memory (at least one value) */
+
+  snd = (double *)Mem(MEM_ALLOC, 5*tot + 1, sizeof(double));
+
+  /* Pack statistics index, bin index, value, weight and number */
+
+  m = 0;
+
+  for (k = 0; k < spbuf.n; k++)
+    {
+      tab = &spbuf.tab[k*spbuf.nt];
+
+      for (n = 0; n < tab->sz; n++)
+	if (tab->key[n] > -1)
+	  {
+	    snd[m++] = (double)k;
+	    snd[m++] = (double)tab->key[n];
+	    snd[m++] = tab->dat[n*BUF_BLOCK_SIZE + BUF_VAL];
+	    snd[m++] = tab->dat[n*BUF_BLOCK_SIZE + BUF_WGT];
+	    snd[m++] = tab->dat[n*BUF_BLOCK_SIZE + BUF_N];
+	  }
+    }
+
+  /***************************************************************************/
+
+  /***** Gather entries ******************************************************/
+
+  /* Allocate memory for counts and displacements */
+
+  rcnt = (int *)Mem(MEM_ALLOC, mpitasks, sizeof(int));
+  rdsp = (int *)Mem(MEM_ALLOC, mpitasks, sizeof(int));
+
+  /* Gather counts */
+
+  cnt = (int)m;
+
+  if (MPI_Allgather(&cnt, 1, MPI_INT, rcnt, 1, MPI_INT, MPI_COMM_WORLD)
+      != MPI_SUCCESS)
+    Die(FUNCTION_NAME, "MPI Error");
+
+  /* Calculate displacements */
+
+  nr = 0;
+
+  for (task = 0; task < mpitasks; task++)
+    {
+      /* Check size */
+
+      if (nr > (long)INT_MAX)
+	Die(FUNCTION_NAME, "Too many entries in sparse buffer (%ld)", nr);
+
+      rdsp[task] = (int)nr;
+      nr = nr + rcnt[task];
+    }
+
+  /* Allocate memory */
+
+  rcv = (double *)Mem(MEM_ALLOC, nr + 1, sizeof(double));
+
+  /* Gather entries */
+
+  if (MPI_Allgatherv(snd, cnt, MPI_DOUBLE, rcv, rcnt, rdsp, MPI_DOUBLE,
+		     MPI_COMM_WORLD) != MPI_SUCCESS)
+    Die(FUNCTION_NAME, "MPI Error");
+
+  /***************************************************************************/
+
+  /***** Rebuild tables ******************************************************/
+
+  /* Clear first tables */
+
+  for (k = 0; k < spbuf.n; k++)
+    {
+      tab = &spbuf.tab[k*spbuf.nt];
+
+      if (tab->n > 0)
+	{
+	  memset(tab->key, -1, tab->sz*sizeof(long));
+	  memset(tab->dat, 0, tab->sz*BUF_BLOCK_SIZE*sizeof(double));
+	  tab->n = 0;
+	}
+    }
+
+  /* Add entries in task order */
+
+  for (n = 0; n < nr; n = n + 5)
+    {
+      /* Get statistics index */
+
+      k = (long)rcv[n];
+      CheckValue(FUNCTION_NAME, "k", "", k, 0, spbuf.n - 1);
+
+      /* Get entry */
+
+      dat = SparseEntry(&spbuf.tab[k*spbuf.nt], (long)rcv[n + 1], YES);
+
+      /* Add data */
+
+      dat[BUF_VAL] += rcv[n + 2];
+      dat[BUF_WGT] += rcv[n + 3];
+      dat[BUF_N] += rcv[n + 4];
+    }
+
+  /* Free memory */
+
+  Mem(MEM_FREE, snd);
+  Mem(MEM_FREE, rcv);
+  Mem(MEM_FREE, rcnt);
+  Mem(MEM_FREE, rdsp);
+
+  /***************************************************************************/
+
+#endif
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,77 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : datahash.c                                     */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Calculates 64-bit FNV-1a hash of data block                  */
+/*                                                                           */
+/* Comments: - Previous value is given as the last argument to combine       */
+/*             several blocks, zero starts a new hash.                       */
+/*                                                                           */
+/*           - Full 8-byte words are hashed at once to keep the routine      */
+/*             fast enough for checksums of large data arrays.               */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "DataHash:"
+
+/* FNV-1a offset basis and prime */
+
+#define FNV_BASIS 0xCBF29CE484222325UL
+#define FNV_PRIME 0x00000100000001B3UL
+
+/*****************************************************************************/
+
+unsigned long DataHash(const void *ptr, long sz, unsigned long h)
+{
+  long n, nw;
+  unsigned long w;
+  const unsigned char *dat;
+
+  /* Check size */
+
+  if (sz < 1)
+    return h;
+
+  /* Start new hash */
+
+  if (h == 0)
+    h = FNV_BASIS;
+
+  /* Pointer to data */
+
+  dat = (const unsigned char *)ptr;
+
+  /* Hash full words */
+
+  nw = sz/sizeof(unsigned long);
+
+  for (n = 0; n < nw; n++)
+    {
+      memcpy(&w, &dat[n*sizeof(unsigned long)], sizeof(unsigned long));
+      h = (h^w)*FNV_PRIME;
+    }
+
+  /* Hash remaining bytes */
+
+  for (n = nw*sizeof(unsigned long); n < sz; n++)
+    h = (h^(unsigned long)dat[n])*FNV_PRIME;
+
+  /* Return value */
+
+  return h;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,53 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : decompidx.c                                    */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Converts bin index of statistical variable to index within   */
+/*              slab owned by this MPI task                                  */
+/*                                                                           */
+/* Comments: - Returns -1 if bin is owned by another task. Index is returned */
+/*             as such if statistics are not decomposed.                     */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "DecompIdx:"
+
+/*****************************************************************************/
+
+long DecompIdx(long ptr, long idx)
+{
+  long slab;
+
+  /* Check pointer */
+
+  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+  /* Get slab size */
+
+  if ((slab = (long)RDB[ptr + SCORE_DECOMP_SLAB]) < 1)
+    return idx;
+
+  /* Check owner */
+
+  if (idx/slab != mpiid)
+    return -1;
+
+  /* Return local index */
+
+  return idx - mpiid*slab;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,53 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : decompstat.c                                   */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Returns pointer to full statistics of decomposed variable    */
+/*              gathered to MPI task 0                                       */
+/*                                                                           */
+/* Comments: - Returns NULL if the variable is not decomposed or nothing is  */
+/*             gathered, in which case the slab in RES1 is used.             */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "DecompStat:"
+
+/*****************************************************************************/
+
+double *DecompStat(long ptr)
+{
+  long idx;
+
+  /* Check pointer */
+
+  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+  /* Check decomposition and gathered data */
+
+  if (((long)RDB[ptr + SCORE_DECOMP_SLAB] < 1) || (dtally.gat == NULL))
+    return NULL;
+
+  /* Get index */
+
+  idx = (long)RDB[ptr + SCORE_DECOMP_IDX];
+  CheckValue(FUNCTION_NAME, "idx", "", idx, 0, dtally.n - 1);
+
+  /* Return pointer */
+
+  return dtally.gat[idx];
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
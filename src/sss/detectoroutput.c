@@ -38,11 +38,6 @@ void DetectorOutput()
   if ((long)RDB[DATA_PTR_DET0] < VALID_PTR)
     return;
 
-  /* Check mpi task */
-
-  if (mpiid > 0)
-    return;
-
   /* Check if in active cycles */
 
   if (RDB[DATA_CYCLE_IDX] < RDB[DATA_CRIT_SKIP])
@@ -77,6 +72,15 @@ void DetectorOutput()
 	    (long)RDB[DATA_COEF_CALC_IDX]);
 
 #endif
+
+  /* Gather decomposed statistics to task 0 */
+
+  GatherDecompStat();
+
+  /* Check mpi task */
+
+  if (mpiid > 0)
+    return;
   
   if ((fp = fopen(tmpstr, "w")) == NULL) 
     Die(FUNCTION_NAME, "Unable to open file for writing");
@@ -803,6 +807,10 @@ void DetectorOutput()
   /* Close file */
 
   fclose(fp);
+
+  /* Free gathered statistics */
+
+  FreeDecompStat();
 }
 
 /*****************************************************************************/
@@ -35,7 +35,7 @@ long *find_limits(long, long, double, double, double, double *, long *, long);
 
 void DopplerBroad()
 {
-  long nuc, ace, ptr, loc0, n, nr, mt, uplimit, i;
+  long nuc, ace, ptr, loc0, n, nr, mt, uplimit, i, nn, idx, sz, *list;
   long NXS[16], JXS[32], NTR, NES, L0, L1, L, *limits, UNRES;
   double *XSS, T, Td, awr;
 
@@ -45,12 +45,31 @@ void DopplerBroad()
     return;    
 
   fprintf(out, "Running Doppler-broadening preprocessor:\n\n");
- 
-  limits = NULL;
 
-  /* Tm pelkstn kntjn varoituksen vlttmiseksi */
+  /* Start timer */
+
+  StartTimer(TIMER_XS_BROADEN);
+
+  /* Count nuclides and allocate memory for list */
+
+  nn = 0;
+
+  nuc = (long)RDB[DATA_PTR_NUC0];
+  while (nuc > VALID_PTR)
+    {
+      nn++;
+      nuc = NextItem(nuc);
+    }
+
+  list = (long *)Mem(MEM_ALLOC, nn + 1, sizeof(long));
+
+  /* Reset count */
+
+  nn = 0;
 
-  UNRES = 0;
+  /***************************************************************************/
+
+  /***** Make copies of data (serial, memory is allocated) *******************/
 
   /* Loop over nuclides */
 
@@ -94,45 +113,19 @@ void DopplerBroad()
 	  fprintf(out, 
 		  "Adjusting nuclide %10s temperature from %1.0fK to %1.0fK...\n",
 		  GetText(nuc + NUCLIDE_PTR_NAME), T, Td);
-	  
-	  /* Get atomic weight ratio */
-	  
-	  awr = RDB[nuc + NUCLIDE_AWR];
-	  
-	  /*******************************************************************/
-
-	  /***** Get NXS and JXS arrays **************************************/
-
-	  /* Pointer to ace block */
-
-	  ace = (long)RDB[nuc + NUCLIDE_PTR_ACE];
-	  CheckPointer(FUNCTION_NAME, "(ace)", ACE_ARRAY, ace);
-
-	  /* Read data to NXS array */
-	  
-	  ptr = (long)ACE[ace + ACE_PTR_NXS];
-	  CheckPointer(FUNCTION_NAME, "(nxs)", ACE_ARRAY, ptr);
-	  
-	  for (n = 0; n < 16; n++)
-	    NXS[n] = (long)ACE[ptr++];
-	  
-	  /* Read data to JXS array */
-	  
-	  ptr = (long)ACE[ace + ACE_PTR_JXS];
-	  CheckPointer(FUNCTION_NAME, "(jxs)", ACE_ARRAY, ptr);
-	  
-	  for (n = 0; n < 32; n++)
-	    JXS[n] = (long)ACE[ptr++];      
-      
-	  /********************************************************************/
-
-	  /***** Make copies of ACE and XSS ***********************************/
 
 	  /* Pointer to original ace block */
 
 	  ptr = (long)RDB[nuc + NUCLIDE_PTR_ACE];
 	  CheckPointer(FUNCTION_NAME, "(ace)", ACE_ARRAY, ptr);
 
+	  /* Get data size */
+
+	  loc0 = (long)ACE[ptr + ACE_PTR_NXS];
+	  CheckPointer(FUNCTION_NAME, "(nxs)", ACE_ARRAY, loc0);
+
+	  sz = (long)ACE[loc0];
+
 	  /* Make a copy */
 
 	  ace = ReallocMem(ACE_ARRAY, ACE_BLOCK_SIZE);
@@ -149,190 +142,259 @@ void DopplerBroad()
 
 	  /* Make a copy */
 
-	  loc0 = ReallocMem(ACE_ARRAY, NXS[0]);
-	  memcpy(&ACE[loc0], &ACE[ptr], NXS[0]*sizeof(double));
+	  loc0 = ReallocMem(ACE_ARRAY, sz);
+	  memcpy(&ACE[loc0], &ACE[ptr], sz*sizeof(double));
 
 	  /* Set pointer */
 
 	  ACE[ace + ACE_PTR_XSS] = (double)loc0;
 
-	  /* Pointer to data */
+	  /* Add to list */
+
+	  list[nn++] = nuc;
+	}
+      
+      /* Next nuclide */
+
+      nuc = NextItem(nuc);
+    }
+
+  /***************************************************************************/
+
+  /***** Broaden nuclides in parallel ****************************************/
+
+  /* Nuclides are independent and each writes only in its own copy of the */
+  /* XSS array. The nuclide loop is run in parallel only if there are     */
+  /* enough nuclides, otherwise the parallel loop in BroadCrossSection()  */
+  /* is used. */
+
+#ifdef OPEN_MP
+#pragma omp parallel for schedule(dynamic) private(nuc, ace, ptr, n, nr, mt, uplimit, i, NXS, JXS, NTR, NES, L0, L1, L, limits, UNRES, XSS, T, Td, awr) if (nn >= (long)RDB[DATA_OMP_MAX_THREADS])
+#endif
+
+  for (idx = 0; idx < nn; idx++)
+    {
+      /* Get pointer to nuclide */
+
+      nuc = list[idx];
+
+      /* Get temperatures and atomic weight ratio */
+
+      Td = RDB[nuc + NUCLIDE_TEMP];
+      T = RDB[nuc + NUCLIDE_XS_TEMP];
+      awr = RDB[nuc + NUCLIDE_AWR];
+
+      /* Reset limits */
+
+      limits = NULL;
+
+      /* Tm pelkstn kntjn varoituksen vlttmiseksi */
+
+      UNRES = 0;
+
+      /***********************************************************************/
 
-	  XSS = &ACE[loc0];
+      /***** Get NXS and JXS arrays ******************************************/
 
-	  /********************************************************************/
+      /* Pointer to ace block */
+
+      ace = (long)RDB[nuc + NUCLIDE_PTR_ACE];
+      CheckPointer(FUNCTION_NAME, "(ace)", ACE_ARRAY, ace);
+
+      /* Read data to NXS array */
+	  
+      ptr = (long)ACE[ace + ACE_PTR_NXS];
+      CheckPointer(FUNCTION_NAME, "(nxs)", ACE_ARRAY, ptr);
+	  
+      for (n = 0; n < 16; n++)
+	NXS[n] = (long)ACE[ptr++];
 	  
-	  /***** Tst alkaa datan varsinainen ksittely *********************/
+      /* Read data to JXS array */
+	  
+      ptr = (long)ACE[ace + ACE_PTR_JXS];
+      CheckPointer(FUNCTION_NAME, "(jxs)", ACE_ARRAY, ptr);
+	  
+      for (n = 0; n < 32; n++)
+	JXS[n] = (long)ACE[ptr++];      
+
+      /* Pointer to data */
+
+      ptr = (long)ACE[ace + ACE_PTR_XSS];
+      CheckPointer(FUNCTION_NAME, "(xss)", ACE_ARRAY, ptr);
+
+      XSS = &ACE[ptr];
+
+      /***********************************************************************/
+	  
+      /***** Tst alkaa datan varsinainen ksittely ************************/
 	      
-	  /* Get number of reactions */
+      /* Get number of reactions */
 	  
-	  NTR = NXS[3] + 3; 
-	  CheckValue(FUNCTION_NAME, "NTR", "", NTR, 3, 1000);      
+      NTR = NXS[3] + 3; 
+      CheckValue(FUNCTION_NAME, "NTR", "", NTR, 3, 1000);      
 	  
-	  /* Loop over reaction channels */
+      /* Loop over reaction channels */
 	  
-	  for (nr = 0; nr < NTR; nr++)
-	    {
-	      /* Get pointers to energy and cross section arrays */
+      for (nr = 0; nr < NTR; nr++)
+	{
+	  /* Get pointers to energy and cross section arrays */
 	      
-	      if (nr < 3)
-		{
-		  /***** Total, absorption and elastic xs ********************/
+	  if (nr < 3)
+	    {
+	      /***** Total, absorption and elastic xs ************************/
 		  
-		  /* Number of energy points */
+	      /* Number of energy points */
 		  
-		  NES = NXS[2];
+	      NES = NXS[2];
 		  
-		  /* Pointer to data (table F-4, page F-13) */
+	      /* Pointer to data (table F-4, page F-13) */
 		  
-		  L0 = JXS[0] - 1;
+	      L0 = JXS[0] - 1;
 		  
-		  /* Set reaction mt and type */
+	      /* Set reaction mt and type */
 		  
-		  L1 = L0 + (nr + 1)*NES;
+	      L1 = L0 + (nr + 1)*NES;
 		  
-		  if (nr == 0)
-		    {
-		      /* Total */
-		      
-		      mt = 1;
-		    }
-		  else if (nr == 1)
-		    {
-		      /* Absorption (sum of mt 100...199) */
+	      if (nr == 0)
+		{
+		  /* Total */
 		      
-		      mt = -2;
-		    }
-		  else
-		    {
-		      /* Elastic */
+		  mt = 1;
+		}
+	      else if (nr == 1)
+		{
+		  /* Absorption (sum of mt 100...199) */
 		      
-		      mt = 2;
-		    }
-		  
-		  /***********************************************************/
+		  mt = -2;
 		}
 	      else
 		{
-		  /***** Reaction cross sections *****************************/
+		  /* Elastic */
+		      
+		  mt = 2;
+		}
+		  
+	      /***************************************************************/
+	    }
+	  else
+	    {
+	      /***** Reaction cross sections *********************************/
 			  
-		  /* Get reaction MT (Table F-6, page F-15). */
+	      /* Get reaction MT (Table F-6, page F-15). */
 		  
-		  mt = (long)XSS[JXS[2] - 1 + nr - 3];
+	      mt = (long)XSS[JXS[2] - 1 + nr - 3];
 		  
-		  /* Get pointer to SIG-block (Table F-10,page F-17) */
+	      /* Get pointer to SIG-block (Table F-10,page F-17) */
 		  
-		  L = (long)XSS[JXS[5] - 1 + nr - 3] + JXS[6] - 1;
+	      L = (long)XSS[JXS[5] - 1 + nr - 3] + JXS[6] - 1;
 		  
-		  /* Get number of energy points */
+	      /* Get number of energy points */
 		  
-		  NES = (long)XSS[L];
+	      NES = (long)XSS[L];
 		  
-		  /* Pointer to energy array */
+	      /* Pointer to energy array */
 		  
-		  L0 = JXS[0] - 1 + NXS[2] - NES;
+	      L0 = JXS[0] - 1 + NXS[2] - NES;
 		  
-		  /* Pointer to XS data */
+	      /* Pointer to XS data */
 		  
-		  L1 = L + 1;
+	      L1 = L + 1;
 		  
-		  /***********************************************************/
-		}
+	      /***************************************************************/
+	    }
 	      
-	      /* Check values */
+	  /* Check values */
 	      
-	      CheckValue(FUNCTION_NAME, "NES", "", NES, 1, 1E+6);      
+	  CheckValue(FUNCTION_NAME, "NES", "", NES, 1, 1E+6);      
 	      
-	      /*Ensimmisell reaktiokanavalla etsitn unresolved-raja
-		mikli todnktaulut lytyvt sek 
-		lasketaan integrointirajat */
+	  /*Ensimmisell reaktiokanavalla etsitn unresolved-raja
+	    mikli todnktaulut lytyvt sek 
+	    lasketaan integrointirajat */
 	      
-	      if(mt==1){
+	  if(mt==1){
 		
-		/* Ton ures-datan olemassaolo kannattaa testata, */
-		/* vaikka toi ei todennkisesti mitn ongelmia */
-		/* aiheutakaan (9.6.2011 / 1.1.15 JLe): */
+	    /* Ton ures-datan olemassaolo kannattaa testata, */
+	    /* vaikka toi ei todennkisesti mitn ongelmia */
+	    /* aiheutakaan (9.6.2011 / 1.1.15 JLe): */
 		
-		if((JXS[22] > 0) && (XSS[JXS[22]+6-1] > 1E-8)){
-		  UNRES=1;
-		  uplimit=NES-1;	      
-		  /* Haarukoidaan alue ensin 1/1024 -osaan alkuperisest */
-		  for(i=0; i<10; i++){
-		    if(XSS[L0+UNRES+(long)floor((uplimit-UNRES)/2.0)]<XSS[JXS[22]+6-1]){
-		      UNRES=(long)floor((uplimit-UNRES)/2.0)+UNRES;
-		    }
-		    else {
-		      uplimit=(long)floor((uplimit-UNRES)/2.0)+UNRES;
-		    }
-		  }
-		  /* Ja sitten etsitn tarkka oikea kohta */
-		  while(XSS[L0+UNRES]<XSS[JXS[22]+6-1]){
-		    UNRES++;
-		  }
+	    if((JXS[22] > 0) && (XSS[JXS[22]+6-1] > 1E-8)){
+	      UNRES=1;
+	      uplimit=NES-1;	      
+	      /* Haarukoidaan alue ensin 1/1024 -osaan alkuperisest */
+	      for(i=0; i<10; i++){
+		if(XSS[L0+UNRES+(long)floor((uplimit-UNRES)/2.0)]<XSS[JXS[22]+6-1]){
+		  UNRES=(long)floor((uplimit-UNRES)/2.0)+UNRES;
 		}
-		/* Jos prob. tableja ei ole, tyydytn integroimaan koko 
-		   energia-alueen yli. Tm aiheuttaa lhes 
-		   merkityksettmn lisn laskenta-aikaan ja
-		   virheen vaikutusalaan unresolved-rajalle. */
-		else{
-		  /* Changed row below NXS[2]-1 -> NXS[2] (TVi 1.9.2011) */
-		  UNRES=NXS[2];		       
+		else {
+		  uplimit=(long)floor((uplimit-UNRES)/2.0)+UNRES;
 		}
+	      }
+	      /* Ja sitten etsitn tarkka oikea kohta */
+	      while(XSS[L0+UNRES]<XSS[JXS[22]+6-1]){
+		UNRES++;
+	      }
+	    }
+	    /* Jos prob. tableja ei ole, tyydytn integroimaan koko 
+	       energia-alueen yli. Tm aiheuttaa lhes 
+	       merkityksettmn lisn laskenta-aikaan ja
+	       virheen vaikutusalaan unresolved-rajalle. */
+	    else{
+	      /* Changed row below NXS[2]-1 -> NXS[2] (TVi 1.9.2011) */
+	      UNRES=NXS[2];		       
+	    }
 		
-		/* Integrointirajat limits-vektoriin. */
+	    /* Integrointirajat limits-vektoriin. */
 		
-		limits=find_limits(L0, NXS[2], T, Td, awr, XSS, limits, UNRES);
+	    limits=find_limits(L0, NXS[2], T, Td, awr, XSS, limits, UNRES);
 		
-	      }
+	  }
 	      
-	      /* Tehdn Doppler-levennys. Levennetn ainoastaan 
-		 kynnysenergialtaan alle 10 keV reaktiot, joiden 
-		 mt on joko 2 (elastinen sironta) tai vlill 16-117 */
+	  /* Tehdn Doppler-levennys. Levennetn ainoastaan 
+	     kynnysenergialtaan alle 10 keV reaktiot, joiden 
+	     mt on joko 2 (elastinen sironta) tai vlill 16-117 */
 	      
-	      if (((mt == 2) || ((mt >= 16) && (mt <= 117))) &&
-		  (NXS[2] - NES < UNRES) && (UNRES - NXS[2] + NES - 1 > 0) &&
-                  (XSS[L0] < 0.01)) {
+	  if (((mt == 2) || ((mt >= 16) && (mt <= 117))) &&
+	      (NXS[2] - NES < UNRES) && (UNRES - NXS[2] + NES - 1 > 0) &&
+	      (XSS[L0] < 0.01)) {
 		
-		/*
-
-
-	      if( (mt==2 || (mt >=16 && mt <= 117)) && NXS[2]-NES<UNRES && XSS[L0] < 0.01 ){
-		*/
- 
-		
-		/* Limits-vektorista ainoastaan soveltuvat osat
-		   BCS-funktiolle (NXS[2]-NES lhtien)
-		   NXS[2] sislt energiapisteiden mrn energiagridiss,
-		   kun taas NES sislt reaktion energiapisteiden mrn.
-		   Viimeinen piste jtetn aina leventmtt (3. argumentissa -1) */
+	    /* Limits-vektorista ainoastaan soveltuvat osat
+	       BCS-funktiolle (NXS[2]-NES lhtien)
+	       NXS[2] sislt energiapisteiden mrn energiagridiss,
+	       kun taas NES sislt reaktion energiapisteiden mrn.
+	       Viimeinen piste jtetn aina leventmtt (3. argumentissa -1) */
 		
-		BroadCrossSection(L0, L1, UNRES-(NXS[2]-NES)-1, T, Td, 
-				  awr, XSS, &limits[(NXS[2]-NES)*3], NXS[2]-NES, NXS[2]);
+	    BroadCrossSection(L0, L1, UNRES-(NXS[2]-NES)-1, T, Td, 
+			      awr, XSS, &limits[(NXS[2]-NES)*3], NXS[2]-NES, NXS[2]);
 		
-	      }
-	      
-	    }
+	  }
+	}
 	  
-	  /*******************************************************************/
+      /***********************************************************************/
 
-	  /* Set XS temperature */
-		  
-	  WDB[nuc + NUCLIDE_XS_TEMP] = Td;
-	}
-      
-      /* Next nuclide */
+      /* Free limits */
 
-      nuc = NextItem(nuc);
+      if (limits != NULL)
+	Mem(MEM_FREE, limits);
+
+      /* Set XS temperature */
+		  
+      WDB[nuc + NUCLIDE_XS_TEMP] = Td;
     }
+
+  /***************************************************************************/
   
   /* Free memory and print newline */
 
-  if (limits != NULL)
-    Mem(MEM_FREE, limits);
+  Mem(MEM_FREE, list);
 
   fprintf(out, "\n");
+
+  /* Stop timer */
+
+  StopTimer(TIMER_XS_BROADEN);
 }
 
+
 /*****************************************************************************/
 
 /*find_limits laskee limits-vektoriin integrointirajat ja huolehtii 
@@ -0,0 +1,252 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : exchangescores.c                               */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Sends scores to decomposed statistics to the MPI tasks that  */
+/*              own the bins                                                 */
+/*                                                                           */
+/* Comments: - Called from CollectBuf() after ReduceBuffer(), so the scores  */
+/*             are added to the first buffer segment. The decomposed slabs   */
+/*             are then excluded from the buffer reduction.                  */
+/*                                                                           */
+/*           - Forward tables of all threads are packed in one message per   */
+/*             task and exchanged with a single all-to-all call. Each entry  */
+/*             is the sum of the scores to one bin in one thread (pointer,   */
+/*             bin index, value, weight and number of scores). The tables    */
+/*             are reset after packing.                                      */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "ExchangeScores:"
+
+/*****************************************************************************/
+
+void ExchangeScores()
+{
+#ifdef MPI
+
+  long i, k, n, ptr, idx, slab, loc0, tot, nr, *lst;
+  int *scnt, *sdsp, *rcnt, *rdsp, task;
+  double *snd, *rcv, *dat, t0;
+  struct SparseTab *tab;
+
+  /* Check decomposed statistics */
+
+  if (dtally.n == 0)
+    return;
+
+  /* Get start time */
+
+  t0 = MPI_Wtime();
+
+  /* Allocate memory for counts, displacements and pointers to */
+  /* statistics */
+
+  scnt = (int *)Mem(MEM_ALLOC, mpitasks, sizeof(int));
+  sdsp = (int *)Mem(MEM_ALLOC, mpitasks, sizeof(int));
+  rcnt = (int *)Mem(MEM_ALLOC, mpitasks, sizeof(int));
+  rdsp = (int *)Mem(MEM_ALLOC, mpitasks, sizeof(int));
+  lst = (long *)Mem(MEM_ALLOC, dtally.n, sizeof(long));
+
+  /* Get pointers to decomposed statistics by table index */
+
+  loc0 = (long)RDB[DATA_PTR_SCORE0];
+  while (loc0 > VALID_PTR)
+    {
+      if ((long)RDB[loc0 + SCORE_DECOMP_SLAB] > 0)
+	{
+	  k = (long)RDB[loc0 + SCORE_DECOMP_IDX];
+	  CheckValue(FUNCTION_NAME, "k", "", k, 0, dtally.n - 1);
+
+	  lst[k] = loc0;
+	}
+
+      /* Next */
+
+      loc0 = NextItem(loc0);
+    }
+
+  /***************************************************************************/
+
+  /***** Pack scores *********************************************************/
+
+  /* Count entries sent to each task */
+
+  tot = 0;
+
+  for (i = 0; i < (long)RDB[DATA_OMP_MAX_THREADS]; i++)
+    for (k = 0; k < dtally.fwd[i].n; k++)
+      {
+	/* Pointer to table and slab size */
+
+	tab = &dtally.fwd[i].tab[k];
+	slab = (long)RDB[lst[k] + SCORE_DECOMP_SLAB];
+
+	/* Loop over entries */
+
+	if (tab->n > 0)
+	  for (n = 0; n < tab->sz; n++)
+	    if ((idx = tab->key[n]) > -1)
+	      {
+		/* Add to count of owner task */
+
+		scnt[idx/slab] += 5;
+		tot++;
+	      }
+      }
+
+  /* Check message size */
+
+  if (5*tot > (long)INT_MAX)
+    Die(FUNCTION_NAME, "Too many forwarded scores (%ld)", tot);
+
+  /* Calculate displacements */
+
+  for (task = 0; task < mpitasks; task++)
+    {
+      if (task == 0)
+	sdsp[task] = 0;
+      else
+	sdsp[task] = sdsp[task - 1] + scnt[task - 1];
+    }
+
+  /* Exchange counts */
+
+  if (MPI_Alltoall(scnt, 1, MPI_INT, rcnt, 1, MPI_INT, MPI_COMM_WORLD)
+      != MPI_SUCCESS)
+    Die(FUNCTION_NAME, "MPI Error");
+
+  /* Receive displacements and total size */
+
+  nr = 0;
+
+  for (task = 0; task < mpitasks; task++)
+    {
+      rdsp[task] = nr;
+      nr = nr + rcnt[task];
+    }
+
+  /* Allocate memory for messages (at least one value) */
+
+  snd = (double *)Mem(MEM_ALLOC, 5*tot + 1, sizeof(double));
+  rcv = (double *)Mem(MEM_ALLOC, nr + 1, sizeof(double));
+
+  /* Reset counts */
+
+  memset(scnt, 0, mpitasks*sizeof(int));
+
+  /* Pack scores */
+
+  for (i = 0; i < (long)RDB[DATA_OMP_MAX_THREADS]; i++)
+    for (k = 0; k < dtally.fwd[i].n; k++)
+      {
+	/* Pointer to table and slab size */
+
+	tab = &dtally.fwd[i].tab[k];
+	slab = (long)RDB[lst[k] + SCORE_DECOMP_SLAB];
+
+	/* Check if used */
+
+	if (tab->n == 0)
+	  continue;
+
+	/* Loop over entries */
+
+	for (n = 0; n < tab->sz; n++)
+	  if ((idx = tab->key[n]) > -1)
+	    {
+	      /* Get owner task and pointer to data */
+
+	      task = (int)(idx/slab);
+	      dat = &snd[sdsp[task] + scnt[task]];
+
+	      /* Put pointer, bin index, value, weight and number of scores */
+
+	      dat[0] = (double)lst[k];
+	      dat[1] = (double)idx;
+	      dat[2] = tab->dat[n*BUF_BLOCK_SIZE + BUF_VAL];
+	      dat[3] = tab->dat[n*BUF_BLOCK_SIZE + BUF_WGT];
+	      dat[4] = tab->dat[n*BUF_BLOCK_SIZE + BUF_N];
+
+	      /* Update count */
+
+	      scnt[task] += 5;
+	    }
+
+	/* Reset table */
+
+	memset(tab->key, -1, tab->sz*sizeof(long));
+	memset(tab->dat, 0, tab->sz*BUF_BLOCK_SIZE*sizeof(double));
+	tab->n = 0;
+      }
+
+  /***************************************************************************/
+
+  /***** Exchange and add to buffer ******************************************/
+
+  /* Exchange scores */
+
+  if (MPI_Alltoallv(snd, scnt, sdsp, MPI_DOUBLE, rcv, rcnt, rdsp, MPI_DOUBLE,
+		    MPI_COMM_WORLD) != MPI_SUCCESS)
+    Die(FUNCTION_NAME, "MPI Error");
+
+  /* Loop over received entries */
+
+  for (n = 0; n < nr/5; n++)
+    {
+      /* Get pointer and local index */
+
+      ptr = (long)rcv[5*n];
+      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+      if ((idx = DecompIdx(ptr, (long)rcv[5*n + 1])) < 0)
+	Die(FUNCTION_NAME, "Score to bin %ld of %s sent to wrong task %d",
+	    (long)rcv[5*n + 1], GetText(ptr + SCORE_PTR_NAME), mpiid);
+
+      /* Pointer to buffer */
+
+      loc0 = (long)RDB[ptr + SCORE_PTR_BUF] + idx*BUF_BLOCK_SIZE;
+      CheckPointer(FUNCTION_NAME, "(loc0)", BUF_ARRAY, loc0);
+
+      /* Add data */
+
+      BUF[loc0 + BUF_VAL] += rcv[5*n + 2];
+      BUF[loc0 + BUF_WGT] += rcv[5*n + 3];
+      BUF[loc0 + BUF_N] += rcv[5*n + 4];
+    }
+
+  /* Free memory */
+
+  Mem(MEM_FREE, snd);
+  Mem(MEM_FREE, rcv);
+  Mem(MEM_FREE, scnt);
+  Mem(MEM_FREE, sdsp);
+  Mem(MEM_FREE, rcnt);
+  Mem(MEM_FREE, rdsp);
+  Mem(MEM_FREE, lst);
+
+  /* Add to statistics */
+
+  dtally.ncall++;
+  dtally.bytes = dtally.bytes + ((double)(5*tot))*sizeof(double);
+  dtally.time = dtally.time + MPI_Wtime() - t0;
+
+  /***************************************************************************/
+
+#endif
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,58 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : filestamphash.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Adds size and modification time of file to hash              */
+/*                                                                           */
+/* Comments: - Used for the snapshot key. Missing file is hashed as a        */
+/*             negative size, so that creating or removing the file          */
+/*             also changes the key.                                         */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "FileStampHash:"
+
+/*****************************************************************************/
+
+unsigned long FileStampHash(char *fname, unsigned long h)
+{
+  long fsz, ftime;
+  struct stat sb;
+
+  /* Get size and modification time */
+
+  if (stat(fname, &sb) == 0)
+    {
+      fsz = (long)sb.st_size;
+      ftime = (long)sb.st_mtime;
+    }
+  else
+    {
+      fsz = -1;
+      ftime = 0;
+    }
+
+  /* Add to hash */
+
+  h = DataHash(&fsz, sizeof(long), h);
+  h = DataHash(&ftime, sizeof(long), h);
+
+  /* Return value */
+
+  return h;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
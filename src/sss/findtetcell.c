@@ -30,10 +30,6 @@ extern "C" {
 long FindTetCell(long ifc, double x, double y, double z, long id)
 {
   long msh, lst, loc0, ptr;
-  /*
-  long nc, cell, loc1;
-  double dx, dy, dz, r2, min;
-  */
 
   /* Check pointer */
   
@@ -43,7 +39,7 @@ long FindTetCell(long ifc, double x, double y, double z, long id)
 
   /***************************************************************************/
 
-  /***** Try previous cell ***************************************************/
+  /***** Try previous cell and neighbour walk ********************************/
 
   /* Check previous cell */
 
@@ -52,128 +48,20 @@ long FindTetCell(long ifc, double x, double y, double z, long id)
 
   if ((loc0 = GetPrivateData(ptr, id)) > VALID_PTR)
     {
+      /* Walk from previous cell to the cell containing the point (the */
+      /* first step tests the previous cell itself) */
 
-      /* Test cell */
-
-      if (InTetCell(ifc, loc0, x, y, z, YES, id) == YES)
+      if ((loc0 = WalkTetCell(ifc, loc0, x, y, z, id)) > VALID_PTR)
 	{
-	  /* Return pointer */
-
-	  return loc0;
-	}
-    }
-
-  /***************************************************************************/
+	  /* Store pointer */
 
-  /***** Try neighbour search ************************************************/
-      
-  /* Check if previous cell was given (NOTE: Tää on nyt disabloitu kun  */
-  /* se ei toimi kovin hyvin) */
-  /* NOTE: Tää pitää kirjoittaa uudestaan uusien tetrojen vuoksi -Ville */
+	  PutPrivateData(ptr, loc0, id);
 
-#ifdef taaeitoiminyt
-  if (1 == 2)
-  if (loc0 > VALID_PTR)
-    {
-      /* Reset minimum distance */
+	  /* Return pointer */
 
-      min = INFTY;
-      
-      /* Reset counter */
-      
-      nc = 0;
-      
-      /* Loop */
-      
-      while (1 != 2)
-	{
-	  /* Check pointer */
-	  
-	  CheckPointer(FUNCTION_NAME, "(loc0)", DATA_ARRAY, loc0);
-	  
-	  /* Pointer to geometry cell */
-	  
-	  cell = (long)RDB[loc0 + IFC_TET_MSH_PTR_CELL];
-	  CheckPointer(FUNCTION_NAME, "(cell)", DATA_ARRAY, cell);
-	  
-	  /* Test cell */
-	  
-	  if (InCell(cell, x, y, z, YES, id) == YES)
-	    {
-	      /* Store pointer */
-	      
-	      ptr = (long)RDB[ifc + IFC_PTR_PREV_CELL];
-	      CheckPointer(FUNCTION_NAME, "(ptr2)", PRIVA_ARRAY, ptr);
-	      PutPrivateData(ptr, loc0, id);
-	      
-	      /* Return pointer */
-	      
-	      return loc0;
-	    }
-	  
-	  /* Reset pointer */
-	  
-	  loc0 = -1;
-	  
-	  /* Pointer to intersection list */
-	  
-	  loc1 = (long)RDB[cell + CELL_PTR_SURF_INSC];
-	  CheckPointer(FUNCTION_NAME, "(loc1)", DATA_ARRAY, loc1);
-	  
-	  /* Loop over boundary surfaces using intersection list */
-	  
-	  while (loc1 > VALID_PTR)
-	    {
-	      /* Get pointer to neighbour cell */
-	      
-	      if ((ptr = (long)RDB[loc1 + CELL_INSC_PTR_NEXT_TET_CELL]) 
-		  > VALID_PTR)
-		{
-		  /* Pointer to geometry cell */
-		  
-		  cell = (long)RDB[ptr + IFC_TET_MSH_PTR_CELL];
-		  CheckPointer(FUNCTION_NAME, "(cell)", DATA_ARRAY, cell);
-		  
-		  /* Calculate square distance */
-		  
-		  dx = (x - RDB[ptr + CELL_CENTER_X]);
-		  dy = (y - RDB[ptr + CELL_CENTER_Y]);
-		  dz = (z - RDB[ptr + CELL_CENTER_Z]);
-		  
-		  /* Compare to minimum */
-		  
-		  if ((r2 = dx*dx + dy*dy + dz*dz) == 0.0)
-		    Die(FUNCTION_NAME, "Error in vector lenght");
-		  else if (r2 < min)
-		    {
-		      /* Update pointer and minimum */
-		      
-		      loc0 = ptr;
-		      min = r2;		      
-		    }
-		}
-	      
-	      /* Next boundary surface */
-	      
-	      loc1 = NextItem(loc1);
-	    }
-	  
-	  /* Check if minimum was found */
-	  
-	  if (loc0 < VALID_PTR)
-	    {
-	      /* No neighbour cell (point may be outside), break loop */
-	      
-	      break;
-	    }
-	  
-	  /* Check maximum number of iterations */
-	  
-	  if (nc++ > 10)
-	    break;
+	  return loc0;
 	}
     }
-#endif
 
   /***************************************************************************/
 
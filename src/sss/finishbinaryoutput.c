@@ -0,0 +1,57 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : finishbinaryoutput.c                           */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Waits for frame of binary output file to be written          */
+/*                                                                           */
+/* Comments: - Called from BinaryOutput() before a new frame and at the end  */
+/*             of TransportCycle(), so that the file is complete when the    */
+/*             results are read.                                             */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "FinishBinaryOutput:"
+
+/*****************************************************************************/
+
+void FinishBinaryOutput()
+{
+  /* Wait for writer thread */
+
+  if (binout.busy == YES)
+    {
+      if (pthread_join(binout.thr, NULL) != 0)
+	Die(FUNCTION_NAME, "Unable to join writer thread");
+
+      binout.busy = NO;
+    }
+
+  /* Free frame */
+
+  if (binout.buf != NULL)
+    {
+      Mem(MEM_FREE, binout.buf);
+      binout.buf = NULL;
+    }
+
+  /* Check errors */
+
+  if (binout.err == YES)
+    Die(FUNCTION_NAME, "Error writing binary output file \"%s\"",
+	binout.fname);
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
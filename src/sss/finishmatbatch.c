@@ -0,0 +1,80 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : finishmatbatch.c                               */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Finishes batch of material tasks processed together          */
+/*                                                                           */
+/* Comments: - Used in BurnMaterials() when several materials are burned     */
+/*             in one call. Wall-clock time since the start of the last      */
+/*             task (or the previous batch) is added to thread busy time     */
+/*             and split evenly between the materials for the next           */
+/*             schedule (NextMatTask() would give it all to the last one).   */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "FinishMatBatch:"
+
+/*****************************************************************************/
+
+void FinishMatBatch(long id, long *mat, long nb)
+{
+  long i;
+  double t, dt;
+  struct MatTaskDeque *dq;
+#ifndef OPEN_MP
+  struct timeb tb;
+#endif
+
+  /* Check task list, thread id and batch size */
+
+  if (mattasks.mat == NULL)
+    Die(FUNCTION_NAME, "Task list not scheduled");
+
+  CheckValue(FUNCTION_NAME, "id", "", id, 0, mattasks.nt - 1);
+  CheckValue(FUNCTION_NAME, "nb", "", nb, 1, INFTY);
+
+  /* Pointer to own deque */
+
+  dq = &mattasks.dq[id];
+
+  /* Get current wall-clock time */
+
+#ifdef OPEN_MP
+  t = omp_get_wtime();
+#else
+  ftime(&tb);
+  t = (double)tb.time + (double)tb.millitm/1000.0;
+#endif
+
+  /* Add to busy time */
+
+  dt = t - dq->t0;
+  dq->busy = dq->busy + dt;
+
+  /* Store cost of burnup task */
+
+  if ((mattasks.type == MAT_TASK_BURN) ||
+      (mattasks.type == MAT_TASK_BURN_CI))
+    for (i = 0; i < nb; i++)
+      WDB[mat[i] + MATERIAL_TASK_TIME] = dt/((double)nb);
+
+  /* Reset pointer and time (next task is started in NextMatTask()) */
+
+  dq->cur = -1;
+  dq->t0 = t;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
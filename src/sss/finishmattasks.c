@@ -0,0 +1,90 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : finishmattasks.c                               */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Prints thread busy times and frees task list of material     */
+/*              loop scheduled by ScheduleMatTasks()                         */
+/*                                                                           */
+/* Comments: - Must be called outside the parallel region.                   */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "FinishMatTasks:"
+
+/*****************************************************************************/
+
+void FinishMatTasks()
+{
+  long nt, i, ns;
+  double min, max, sum;
+
+  /* Check task list */
+
+  if (mattasks.mat == NULL)
+    Die(FUNCTION_NAME, "Task list not scheduled");
+
+  /* Number of deques */
+
+  nt = mattasks.nt;
+
+  /* Get minimum, maximum and total busy time and number of steals */
+
+  min = INFTY;
+  max = 0.0;
+  sum = 0.0;
+  ns = 0;
+
+  for (i = 0; i < nt; i++)
+    {
+      /* Check that all tasks are done */
+
+      if ((mattasks.dq[i].head < mattasks.dq[i].tail) ||
+	  (mattasks.dq[i].cur > VALID_PTR))
+	Die(FUNCTION_NAME, "Unfinished tasks in deque %ld", i);
+
+      /* Compare and add */
+
+      if (mattasks.dq[i].busy < min)
+	min = mattasks.dq[i].busy;
+      if (mattasks.dq[i].busy > max)
+	max = mattasks.dq[i].busy;
+
+      sum = sum + mattasks.dq[i].busy;
+      ns = ns + mattasks.dq[i].nsteal;
+
+#ifdef OPEN_MP
+      omp_destroy_lock(&mattasks.dq[i].lock);
+#endif
+    }
+
+  /* Print load balance */
+
+  if ((mpiid == 0) && (nt > 1) && (mattasks.n > 0) && (max > 0.0))
+    {
+      fprintf(out, "Thread busy time: min %1.2f s, max %1.2f s ", min, max);
+      fprintf(out, "(%1.1f%% balance, %ld of %ld tasks stolen)\n\n",
+	      100.0*sum/max/((double)nt), ns, mattasks.n);
+    }
+
+  /* Free task list */
+
+  Mem(MEM_FREE, mattasks.mat);
+
+  mattasks.mat = NULL;
+  mattasks.n = 0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -24,7 +24,7 @@ extern "C" {
 
 void FlushBank()
 {
-  long ptr, part, id;
+  long ptr, part, id, loc0;
 
   /* Get pointer to source */
 
@@ -40,13 +40,47 @@ void FlushBank()
 
   for (id = 0; id < (long)RDB[DATA_OMP_MAX_THREADS]; id++)
     {
-      /* Loop until bank is empty */
+      /* Get pointer to first particle in bank (after dummy) */
 
-      while ((part = FromBank(id)) > VALID_PTR)
+      loc0 = (long)RDB[OMPPtr(DATA_PART_PTR_BANK, id)];
+      CheckPointer(FUNCTION_NAME, "(loc0)", DATA_ARRAY, loc0);
+
+      loc0 = NextItem(FirstItem(loc0));
+
+      /* Check if bank has only neutrons (criticality source mode) */
+
+      part = loc0;
+      while (part > VALID_PTR)
+	{
+	  /* Check type */
+
+	  if ((long)RDB[part + PARTICLE_TYPE] != PARTICLE_TYPE_NEUTRON)
+	    break;
+
+	  /* Next */
+
+	  part = NextItem(part);
+	}
+
+      /* Check */
+
+      if ((loc0 > VALID_PTR) && (part < VALID_PTR) &&
+	  ((long)RDB[DATA_STOP_AFTER_PLOT] != STOP_AFTER_PLOT_TRACKS))
 	{
-	  /* Put particle back to stack */
+	  /* Move all particles to neutron stack at once */
+
+	  MoveListTail(loc0, OMPPtr(DATA_PART_PTR_NSTACK, id));
+	}
+      else
+	{
+	  /* Loop until bank is empty */
+
+	  while ((part = FromBank(id)) > VALID_PTR)
+	    {
+	      /* Put particle back to stack */
 
-	  ToStack(part, id);
+	      ToStack(part, id);
+	    }
 	}
     }
 
@@ -0,0 +1,90 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : flushbufcache.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Adds data in thread-private cache to shared scoring buffer   */
+/*              and empties the cache                                        */
+/*                                                                           */
+/* Comments: - Threads can be flushed in parallel, the buffer is updated     */
+/*             with atomic operations.                                       */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "FlushBufCache:"
+
+/*****************************************************************************/
+
+void FlushBufCache(long id)
+{
+  long ptr, nc, n, loc1;
+  double *dat;
+
+  /* Get pointer to cache */
+
+  if ((ptr = (long)RDB[DATA_PTR_PRIVA_BUF_CACHE]) < VALID_PTR)
+    return;
+
+  /* Get number of slots */
+
+  nc = (long)RDB[DATA_OPTI_BUF_CACHE_SIZE];
+  CheckValue(FUNCTION_NAME, "nc", "", nc, 1, 1000000);
+
+  /* Pointer to data */
+
+  dat = &PRIVA[ptr + id*(long)RDB[DATA_REAL_PRIVA_SIZE]];
+
+  /* Loop over slots */
+
+  for (n = 0; n < nc; n++)
+    {
+      /* Check if slot is used */
+
+      if ((loc1 = (long)dat[BUFC_LOC]) > VALID_PTR)
+	{
+	  CheckPointer(FUNCTION_NAME, "(loc1)", BUF_ARRAY, loc1);
+
+	  /* Add to shared buffer */
+
+#ifdef OPEN_MP
+#pragma omp atomic
+#endif
+	  BUF[loc1 + BUF_VAL] += dat[BUFC_VAL];
+
+#ifdef OPEN_MP
+#pragma omp atomic
+#endif
+	  BUF[loc1 + BUF_WGT] += dat[BUFC_WGT];
+
+#ifdef OPEN_MP
+#pragma omp atomic
+#endif
+	  BUF[loc1 + BUF_N] += dat[BUFC_N];
+	}
+
+      /* Reset slot */
+
+      dat[BUFC_LOC] = 0.0;
+      dat[BUFC_VAL] = 0.0;
+      dat[BUFC_WGT] = 0.0;
+      dat[BUFC_N] = 0.0;
+
+      /* Next slot */
+
+      dat = dat + BUFC_BLOCK_SIZE;
+    }
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
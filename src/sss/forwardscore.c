@@ -0,0 +1,73 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : forwardscore.c                                 */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Adds score to bin owned by another MPI task in thread-private*/
+/*              forward table                                                */
+/*                                                                           */
+/* Comments: - Called from AddBuf() and AddBuf1D(). Scores are summed by     */
+/*             bin in a hash table per statistics (SparseEntry()), so the    */
+/*             memory and the message size grow with the number of remote   */
+/*             bins scored in the cycle, not with the number of scores.      */
+/*             The tables are sent to the owner tasks by ExchangeScores() at */
+/*             the end of the cycle.                                         */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "ForwardScore:"
+
+/*****************************************************************************/
+
+void ForwardScore(double val, double wgt, long ptr, long id, long idx)
+{
+  long k;
+  double *dat;
+  struct DecompFwd *fwd;
+
+  /* Check id */
+
+  CheckValue(FUNCTION_NAME, "id", "", id, 0, MAX_OMP_THREADS - 1);
+
+  /* Pointer to tables */
+
+  fwd = &dtally.fwd[id];
+
+  /* Allocate memory for (empty) tables at first score */
+
+  if (fwd->n == 0)
+    {
+      fwd->tab = (struct SparseTab *)
+	Mem(MEM_ALLOC, dtally.n, sizeof(struct SparseTab));
+      fwd->n = dtally.n;
+    }
+
+  /* Get index to table */
+
+  k = (long)RDB[ptr + SCORE_DECOMP_IDX];
+  CheckValue(FUNCTION_NAME, "k", "", k, 0, fwd->n - 1);
+
+  /* Get entry */
+
+  dat = SparseEntry(&fwd->tab[k], idx, YES);
+
+  /* Add data */
+
+  dat[BUF_VAL] += wgt*val;
+  dat[BUF_WGT] += wgt;
+  dat[BUF_N] += 1.0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,68 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : freeace.c                                      */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Frees ACE data array                                         */
+/*                                                                           */
+/* Comments: - Shared window set up by ShareACEData() is freed collectively  */
+/*             by all tasks within node.                                     */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "FreeACE:"
+
+/*****************************************************************************/
+
+void FreeACE()
+{
+  /* Check pointer */
+
+  if (ACE == NULL)
+    return;
+
+#ifdef MPI
+
+  /* Check shared window */
+
+  if (mpinode.shared == YES)
+    {
+      /* Free window and communicator */
+
+      MPI_Win_free(&mpinode.win);
+      MPI_Comm_free(&mpinode.comm);
+
+      /* Reset flag and pointer */
+
+      mpinode.shared = NO;
+      ACE = NULL;
+
+      /* Exit subroutine */
+
+      return;
+    }
+
+#endif
+
+  /* Free private array */
+
+  Mem(MEM_FREE, ACE);
+
+  /* Reset pointer */
+
+  ACE = NULL;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
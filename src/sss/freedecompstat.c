@@ -0,0 +1,49 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : freedecompstat.c                               */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Frees statistics gathered to MPI task 0                      */
+/*                                                                           */
+/* Comments: - Called by the routines that call GatherDecompStat() when      */
+/*             they are done with output, so that task 0 holds the full      */
+/*             arrays only while results are printed.                        */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "FreeDecompStat:"
+
+/*****************************************************************************/
+
+void FreeDecompStat()
+{
+  long idx;
+
+  /* Check gathered data */
+
+  if (dtally.gat == NULL)
+    return;
+
+  /* Loop over statistics */
+
+  for (idx = 0; idx < dtally.n; idx++)
+    if (dtally.gat[idx] != NULL)
+      {
+	Mem(MEM_FREE, dtally.gat[idx]);
+	dtally.gat[idx] = NULL;
+      }
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
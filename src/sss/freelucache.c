@@ -0,0 +1,65 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : freelucache.c                                  */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Frees symbolic LU decompositions and work arrays stored by   */
+/*              CachedSymbolicLU()                                           */
+/*                                                                           */
+/* Comments:                                                                 */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "FreeLUCache:"
+
+/*****************************************************************************/
+
+void FreeLUCache()
+{
+  long id;
+
+  /* Loop over threads */
+
+  for (id = 0; id < MAX_OMP_THREADS; id++)
+    {
+      /* Decomposition */
+
+      if (lucache[id].LU != NULL)
+	{
+	  /* Free memory */
+
+	  ccsMatrixFree(lucache[id].LU);
+	  Mem(MEM_FREE, lucache[id].colptr);
+	  Mem(MEM_FREE, lucache[id].rowind);
+	  Mem(MEM_FREE, lucache[id].map);
+
+	  /* Reset pointer */
+
+	  lucache[id].LU = NULL;
+	}
+
+      /* Work array of batched solver */
+
+      if (lucache[id].work != NULL)
+	{
+	  Mem(MEM_FREE, lucache[id].work);
+
+	  lucache[id].work = NULL;
+	  lucache[id].wsz = 0;
+	}
+    }
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
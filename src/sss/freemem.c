@@ -32,6 +32,10 @@ void FreeMem()
 
 #endif
 
+  /* Free symbolic LU decompositions */
+
+  FreeLUCache();
+
   /* Free data arrays */
 
   if (ACE != NULL)
@@ -0,0 +1,108 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : gatherdecompstat.c                             */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Gathers slabs of decomposed statistics to MPI task 0         */
+/*                                                                           */
+/* Comments: - Called in all tasks by DetectorOutput(), BinaryOutput() and   */
+/*             CoefOutput(). Mean(), RelErr() and StdDev() read the          */
+/*             gathered copy in task 0, so the output routines need no       */
+/*             changes.                                                      */
+/*                                                                           */
+/*           - Only task 0 holds full arrays, and only until the caller      */
+/*             frees them with FreeDecompStat() after the output.            */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "GatherDecompStat:"
+
+/*****************************************************************************/
+
+void GatherDecompStat()
+{
+#ifdef MPI
+
+  long ptr, idx, slab, loc0;
+  double *dat;
+
+  /* Check decomposed statistics */
+
+  if (dtally.n == 0)
+    return;
+
+  /* Start timers */
+
+  StartTimer(TIMER_MPI_OVERHEAD);
+  StartTimer(TIMER_MPI_OVERHEAD_TOTAL);
+
+  /* Allocate memory for pointers */
+
+  if ((mpiid == 0) && (dtally.gat == NULL))
+    dtally.gat = (double **)Mem(MEM_ALLOC, dtally.n, sizeof(double *));
+
+  /* Loop over statistics */
+
+  ptr = (long)RDB[DATA_PTR_SCORE0];
+  while (ptr > VALID_PTR)
+    {
+      /* Check slab size */
+
+      if ((slab = (long)RDB[ptr + SCORE_DECOMP_SLAB]) > 0)
+	{
+	  /* Get index and pointer to local slab */
+
+	  idx = (long)RDB[ptr + SCORE_DECOMP_IDX];
+	  CheckValue(FUNCTION_NAME, "idx", "", idx, 0, dtally.n - 1);
+
+	  loc0 = (long)RDB[ptr + SCORE_PTR_DATA];
+	  CheckPointer(FUNCTION_NAME, "(loc0)", RES1_ARRAY, loc0);
+
+	  /* Allocate memory for full array in task 0 (slabs of last tasks */
+	  /* may extend past the last bin) */
+
+	  if (mpiid == 0)
+	    {
+	      if (dtally.gat[idx] == NULL)
+		dtally.gat[idx] = (double *)Mem(MEM_ALLOC,
+						slab*mpitasks*STAT_BLOCK_SIZE,
+						sizeof(double));
+	      dat = dtally.gat[idx];
+	    }
+	  else
+	    dat = NULL;
+
+	  /* Gather slabs */
+
+	  if (MPI_Gather(&RES1[loc0], slab*STAT_BLOCK_SIZE, MPI_DOUBLE,
+			 dat, slab*STAT_BLOCK_SIZE, MPI_DOUBLE, 0,
+			 MPI_COMM_WORLD) != MPI_SUCCESS)
+	    Die(FUNCTION_NAME, "MPI Error");
+	}
+
+      /* Next */
+
+      ptr = NextItem(ptr);
+    }
+
+  /* Stop timers */
+
+  StopTimer(TIMER_MPI_OVERHEAD);
+  StopTimer(TIMER_MPI_OVERHEAD_TOTAL);
+
+#endif
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,43 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : getmooseifcpower.c                             */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Returns pointer to the power array of the in-memory          */
+/*              interface                                                    */
+/*                                                                           */
+/* Comments: - The array is indexed by output index (map entry - 1) and      */
+/*             contains the cell power in W as in the m-file output.         */
+/*             It is written by PrintInterfaceOutput().                      */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "GetMooseIFCPower:"
+
+/*****************************************************************************/
+
+double *GetMooseIFCPower(long *nc)
+{
+  /* Put size */
+
+  if (nc != NULL)
+    *nc = mooseifc.nc;
+
+  /* Return pointer */
+
+  return mooseifc.pwr;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -26,7 +26,7 @@ extern "C" {
 long GridSearch(long erg, double E)
 {
   double Emin, Emax, Emid, logE;
-  long ptr, ne, idx, i0, nb;
+  long ptr, ne, idx, i0, i1, nb, nh;
 
   /* Check pointer and value */
 
@@ -47,6 +47,52 @@ long GridSearch(long erg, double E)
     
   /***************************************************************************/
 
+  /***** Hash table **********************************************************/
+
+  /* Check if hash table is used (top level only) */
+
+  if ((nh = (long)RDB[erg + ENERGY_GRID_NH]) > 0)
+    {
+      /* Calculate bin index */
+
+      logE = log(E);
+
+      Emin = RDB[erg + ENERGY_GRID_LOG_EMIN];
+      Emax = RDB[erg + ENERGY_GRID_LOG_EMAX];
+
+      idx = (long)((double)nh*(logE - Emin)/(Emax - Emin));
+
+      /* Log-function may cause numerical problems */
+
+      if (idx < 0)
+	idx = 0;
+      else if (idx > nh - 1)
+	idx = nh - 1;
+
+      /* Get pointer to hash table */
+
+      ptr = (long)RDB[erg + ENERGY_GRID_PTR_HASH];
+      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+      /* Get first and last interval */
+
+      i0 = (long)RDB[ptr + idx];
+      i1 = (long)RDB[ptr + idx + 1];
+
+      /* Get pointer to data */
+
+      ptr = (long)RDB[erg + ENERGY_GRID_PTR_DATA];
+      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+      /* Find interval (search from tree if rounding puts E outside */
+      /* the bin) */
+
+      if ((idx = SearchArray(&RDB[ptr + i0], E, i1 - i0 + 2)) > -1)
+	return i0 + idx;
+    }
+
+  /***************************************************************************/
+
   /***** Sub-intervals *******************************************************/
   
   /* Get number of bins */
@@ -43,6 +43,38 @@ unsigned long parent_seed;
 /* Created tag to compile on Mac, LMK 6/2016 */
 struct Timer timer[TOT_TIMERS + 1];
 
+/* In-memory MOOSE interface, LMK */
+
+struct MooseIFC mooseifc;
+
+/* Symbolic LU decompositions for CRAM */
+
+struct LUCache lucache[MAX_OMP_THREADS];
+
+/* Task deques for material loops */
+
+struct MatTasks mattasks;
+
+/* Nonblocking MPI collectives */
+
+struct MPIColl mpicoll[MPI_COLL_N];
+
+/* Tasks sharing node memory */
+
+struct MPINode mpinode;
+
+/* Decomposed detector tallies */
+
+struct DecompTally dtally;
+
+/* Sparse scoring buffer */
+
+struct SparseBuf spbuf;
+
+/* Binary output file */
+
+struct BinOut binout;
+
 
 #ifdef __cplusplus
 }
@@ -24,9 +24,9 @@ extern "C" {
 
 void IFCPoint(long mat, double *f0, double *T0, long id)
 {
-  long loc0, loc1, msh, type, dim, ptr, lst, np, uni, ncol;
+  long loc0, loc1, msh, type, ptr, np, uni, ncol;
   long tbi, ang, nr, rad, i, ptr0, ptr1;
-  double f, T, wgt, r, r2, d2, d, ex, w, x, y, z, t, dx, dy, dz;
+  double f, T, r2, x, y, z, t;
   double Temp1, Temp0, phi, phi2;
   /* Check if interfaces are defined */
 
@@ -102,104 +102,12 @@ void IFCPoint(long mat, double *f0, double *T0, long id)
       
       /***** Average of point-wise values ************************************/
 
-      /* Get pointer to search mesh */
-  
-      msh = (long)RDB[loc0 + IFC_PTR_SEARCH_MESH];
-      CheckPointer(FUNCTION_NAME, "(msh)", DATA_ARRAY, msh);
-
-      /* Get dimensions */
-  
-      dim = (long)RDB[loc0 + IFC_DIM];
-          
-      /* Reset mean density factor, temperature and weight */
-	  
-      f = 0.0;
-      T = 0.0;
-      wgt = 0.0;
-      
-      /* Get exclusion radius and square of radius */
-      
-      r = RDB[loc0 + IFC_EXCL_RAD];
-      r2 = r*r;
-      
-      /* Get exponent */
-      
-      ex = RDB[loc0 + IFC_EXP];
-      
-      /* Get pointer to search mesh */
-      
-      if ((lst = MeshPtr(msh, x, y, z)) > VALID_PTR)
-	lst = (long)RDB[lst];
-      
-      /* Loop over content */
-      
-      while (lst > VALID_PTR)
-	{
-	  /* Pointer to point */
-	  
-	  loc1 = (long)RDB[lst + SEARCH_MESH_CELL_CONTENT];
-	  CheckPointer(FUNCTION_NAME, "(loc1)", DATA_ARRAY, loc1);
-	  
-	  /* Get parameters */
-	  
-	  dx = x - RDB[loc1 + IFC_PT_X];
-	  dy = y - RDB[loc1 + IFC_PT_Y];
-	  dz = z - RDB[loc1 + IFC_PT_Z];
-	  
-	  /* Avoid compiler warning */
-	  
-	  d2 = -1.0;
-	  
-	  /* Calculate square distance */
-	  
-	  if (dim == 3)
-	    d2 = dx*dx + dy*dy + dz*dz;
-	  else if (dim == 2)
-	    d2 = dx*dx + dy*dy;
-	  else if (dim == 1)
-	    d2 = dz*dz;
-	  else
-	    Die(FUNCTION_NAME, "Invalid dimension");
-
-	  /* Compare to exclusion radius */
-	  
-	  if (d2 < r2)
-	    {
-	      /* Calculate distance */
-	      
-	      d = sqrt(d2);
-	      
-	      /* Calculate weight factor */
-
-	      w = pow(d, ex);
-	      CheckValue(FUNCTION_NAME, "w", "", w, 0.0, INFTY);
-	      
-	      /* Invert */
-
-	      if (w < 1E-3)
-		w = 1E+3;
-	      else
-		w = 1.0/w;
+      /* Interpolate from lattice or calculate average from points */
 
-	      /* Add to values */
-
-	      f = f + RDB[loc1 + IFC_PT_DF]*w;
-	      T = T + RDB[loc1 + IFC_PT_TMP]*w;
-	      wgt = wgt + w;
-	    }
-	  
-	  /* Next */
-	  
-	  lst = NextItem(lst);
-	}
-
-      /* Calculate mean */
-      
-      if (wgt != 0.0)
-	{
-	  f = f/wgt;
-	  T = T/wgt;
-	}
+      if ((ptr = (long)RDB[loc0 + IFC_PTR_LATTICE]) < VALID_PTR)
+	IFCPtAvgValue(loc0, x, y, z, &f, &T);
+      else if (IFCPtLattice(ptr, x, y, z, &f, &T) == NO)
+	IFCPtAvgValue(loc0, x, y, z, &f, &T);
 
       /* Avoid round-off errors */
 
@@ -0,0 +1,202 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : ifcptavgvalue.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Calculates inverse-distance weighted average of density      */
+/*              factor and temperature of point-average interface            */
+/*                                                                           */
+/* Comments: - Radius query in the k-d tree built by BuildIFCPtKDTree().     */
+/*             Only points within the exclusion radius are visited, and      */
+/*             subtrees are skipped when the splitting plane is farther      */
+/*             than the radius.                                              */
+/*                                                                           */
+/*           - Returns sum of weights. Values are zero if no points are      */
+/*             found, and they are not limited to interface minimum and      */
+/*             maximum (done in IFCPoint()).                                 */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "IFCPtAvgValue:"
+
+/*****************************************************************************/
+
+double IFCPtAvgValue(long loc0, double x, double y, double z, double *f0,
+		     double *T0)
+{
+  long tree, loc1, dim, ax, lo, hi, dp, m, ns, node;
+  long stlo[IFC_KD_MAX_DEPTH + 2], sthi[IFC_KD_MAX_DEPTH + 2];
+  long stdp[IFC_KD_MAX_DEPTH + 2];
+  double f, T, wgt, r2, ex, d2, d, w, dx, dy, dz, dd, pos[3];
+
+  /* Get pointer to tree */
+
+  tree = (long)RDB[loc0 + IFC_PTR_KD_TREE];
+  CheckPointer(FUNCTION_NAME, "(tree)", DATA_ARRAY, tree);
+
+  /* Get dimensions */
+
+  dim = (long)RDB[loc0 + IFC_DIM];
+
+  /* Get square of exclusion radius and exponent */
+
+  r2 = RDB[loc0 + IFC_EXCL_RAD]*RDB[loc0 + IFC_EXCL_RAD];
+  ex = RDB[loc0 + IFC_EXP];
+
+  /* Put coordinates in array for splitting axis comparison */
+
+  pos[IFC_KD_X] = x;
+  pos[IFC_KD_Y] = y;
+  pos[IFC_KD_Z] = z;
+
+  /* Reset mean density factor, temperature and weight */
+
+  f = 0.0;
+  T = 0.0;
+  wgt = 0.0;
+
+  /* Put root range in stack */
+
+  stlo[0] = 0;
+  sthi[0] = (long)RDB[loc0 + IFC_NP];
+  stdp[0] = 0;
+  ns = 1;
+
+  /* Traverse tree */
+
+  while (ns > 0)
+    {
+      /* Pop range */
+
+      ns--;
+      lo = stlo[ns];
+      hi = sthi[ns];
+      dp = stdp[ns];
+
+      /* Check empty */
+
+      if (lo >= hi)
+	continue;
+
+      /* Pointer to splitting node */
+
+      m = (lo + hi)/2;
+      node = tree + m*IFC_KD_BLOCK_SIZE;
+
+      /* Calculate square distance */
+
+      dx = x - RDB[node + IFC_KD_X];
+      dy = y - RDB[node + IFC_KD_Y];
+      dz = z - RDB[node + IFC_KD_Z];
+
+      if (dim == 3)
+	d2 = dx*dx + dy*dy + dz*dz;
+      else if (dim == 2)
+	d2 = dx*dx + dy*dy;
+      else
+	d2 = dz*dz;
+
+      /* Compare to exclusion radius */
+
+      if (d2 < r2)
+	{
+	  /* Pointer to point */
+
+	  loc1 = (long)RDB[node + IFC_KD_PTR_PT];
+	  CheckPointer(FUNCTION_NAME, "(loc1)", DATA_ARRAY, loc1);
+
+	  /* Calculate distance */
+
+	  d = sqrt(d2);
+
+	  /* Calculate weight factor (avoid pow() for common exponents) */
+
+	  if (ex == 1.0)
+	    w = d;
+	  else if (ex == 2.0)
+	    w = d*d;
+	  else
+	    w = pow(d, ex);
+
+	  CheckValue(FUNCTION_NAME, "w", "", w, 0.0, INFTY);
+
+	  /* Invert */
+
+	  if (w < 1E-3)
+	    w = 1E+3;
+	  else
+	    w = 1.0/w;
+
+	  /* Add to values */
+
+	  f = f + RDB[loc1 + IFC_PT_DF]*w;
+	  T = T + RDB[loc1 + IFC_PT_TMP]*w;
+	  wgt = wgt + w;
+	}
+
+      /* Check leaf */
+
+      if (hi - lo < 2)
+	continue;
+
+      /* Get splitting axis and distance to plane */
+
+      if (dim == 1)
+	ax = IFC_KD_Z;
+      else
+	ax = dp % dim;
+
+      dd = pos[ax] - RDB[node + ax];
+
+      /* Check stack size */
+
+      if (ns > IFC_KD_MAX_DEPTH)
+	Die(FUNCTION_NAME, "Stack overflow");
+
+      /* Push far side if within radius */
+
+      if (dd*dd < r2)
+	{
+	  stlo[ns] = (dd < 0.0) ? m + 1 : lo;
+	  sthi[ns] = (dd < 0.0) ? hi : m;
+	  stdp[ns++] = dp + 1;
+	}
+
+      /* Push near side */
+
+      stlo[ns] = (dd < 0.0) ? lo : m + 1;
+      sthi[ns] = (dd < 0.0) ? m : hi;
+      stdp[ns++] = dp + 1;
+    }
+
+  /* Calculate mean */
+
+  if (wgt != 0.0)
+    {
+      f = f/wgt;
+      T = T/wgt;
+    }
+
+  /* Put values */
+
+  *f0 = f;
+  *T0 = T;
+
+  /* Return sum of weights */
+
+  return wgt;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
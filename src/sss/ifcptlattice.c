@@ -0,0 +1,171 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : ifcptlattice.c                                 */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Interpolates point-average interface values from lattice     */
+/*                                                                           */
+/* Comments: - Linear interpolation in each direction used by the interface  */
+/*             (trilinear in 3D) between values tabulated by                 */
+/*             BuildIFCPtLattice().                                          */
+/*                                                                           */
+/*           - Returns NO if the point is outside the lattice or if any of   */
+/*             the surrounding lattice points has no interface points within */
+/*             the exclusion radius (edges of point cloud), in which case    */
+/*             the caller calculates the average directly.                   */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "IFCPtLattice:"
+
+/*****************************************************************************/
+
+long IFCPtLattice(long lat, double x, double y, double z, double *f,
+		  double *T)
+{
+  long ptr, nx, ny, nz, i0, j0, k0, i1, j1, k1, n;
+  double u, v, w, a, b, c;
+
+  /* Check pointer */
+
+  CheckPointer(FUNCTION_NAME, "(lat)", DATA_ARRAY, lat);
+
+  /* Get sizes */
+
+  nx = (long)RDB[lat + IFC_LAT_NX];
+  ny = (long)RDB[lat + IFC_LAT_NY];
+  nz = (long)RDB[lat + IFC_LAT_NZ];
+
+  /* Reset indexes and fractions */
+
+  i0 = 0;
+  j0 = 0;
+  k0 = 0;
+
+  u = 0.0;
+  v = 0.0;
+  w = 0.0;
+
+  /* Get indexes and fractions in x-direction */
+
+  if (nx > 1)
+    {
+      if ((x < RDB[lat + IFC_LAT_XMIN]) || (x > RDB[lat + IFC_LAT_XMAX]))
+	return NO;
+
+      u = (x - RDB[lat + IFC_LAT_XMIN])/
+	(RDB[lat + IFC_LAT_XMAX] - RDB[lat + IFC_LAT_XMIN])*((double)(nx - 1));
+
+      if ((i0 = (long)u) > nx - 2)
+	i0 = nx - 2;
+
+      u = u - (double)i0;
+    }
+
+  /* Get indexes and fractions in y-direction */
+
+  if (ny > 1)
+    {
+      if ((y < RDB[lat + IFC_LAT_YMIN]) || (y > RDB[lat + IFC_LAT_YMAX]))
+	return NO;
+
+      v = (y - RDB[lat + IFC_LAT_YMIN])/
+	(RDB[lat + IFC_LAT_YMAX] - RDB[lat + IFC_LAT_YMIN])*((double)(ny - 1));
+
+      if ((j0 = (long)v) > ny - 2)
+	j0 = ny - 2;
+
+      v = v - (double)j0;
+    }
+
+  /* Get indexes and fractions in z-direction */
+
+  if (nz > 1)
+    {
+      if ((z < RDB[lat + IFC_LAT_ZMIN]) || (z > RDB[lat + IFC_LAT_ZMAX]))
+	return NO;
+
+      w = (z - RDB[lat + IFC_LAT_ZMIN])/
+	(RDB[lat + IFC_LAT_ZMAX] - RDB[lat + IFC_LAT_ZMIN])*((double)(nz - 1));
+
+      if ((k0 = (long)w) > nz - 2)
+	k0 = nz - 2;
+
+      w = w - (double)k0;
+    }
+
+  /* Upper indexes */
+
+  i1 = (nx > 1) ? i0 + 1 : i0;
+  j1 = (ny > 1) ? j0 + 1 : j0;
+  k1 = (nz > 1) ? k0 + 1 : k0;
+
+  /* Pointer to data */
+
+  ptr = (long)RDB[lat + IFC_LAT_PTR_DATA];
+  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+  /* Check weights of surrounding lattice points */
+
+  if ((RDB[ptr + 3*((k0*ny + j0)*nx + i0) + 2] == 0.0) ||
+      (RDB[ptr + 3*((k0*ny + j0)*nx + i1) + 2] == 0.0) ||
+      (RDB[ptr + 3*((k0*ny + j1)*nx + i0) + 2] == 0.0) ||
+      (RDB[ptr + 3*((k0*ny + j1)*nx + i1) + 2] == 0.0) ||
+      (RDB[ptr + 3*((k1*ny + j0)*nx + i0) + 2] == 0.0) ||
+      (RDB[ptr + 3*((k1*ny + j0)*nx + i1) + 2] == 0.0) ||
+      (RDB[ptr + 3*((k1*ny + j1)*nx + i0) + 2] == 0.0) ||
+      (RDB[ptr + 3*((k1*ny + j1)*nx + i1) + 2] == 0.0))
+    return NO;
+
+  /* Interpolate density factor and temperature */
+
+  for (n = 0; n < 2; n++)
+    {
+      /* Interpolate in x-direction */
+
+      a = (1.0 - u)*RDB[ptr + 3*((k0*ny + j0)*nx + i0) + n]
+	+ u*RDB[ptr + 3*((k0*ny + j0)*nx + i1) + n];
+      b = (1.0 - u)*RDB[ptr + 3*((k0*ny + j1)*nx + i0) + n]
+	+ u*RDB[ptr + 3*((k0*ny + j1)*nx + i1) + n];
+
+      /* Interpolate in y-direction (lower z-plane) */
+
+      c = (1.0 - v)*a + v*b;
+
+      /* Same for upper z-plane */
+
+      a = (1.0 - u)*RDB[ptr + 3*((k1*ny + j0)*nx + i0) + n]
+	+ u*RDB[ptr + 3*((k1*ny + j0)*nx + i1) + n];
+      b = (1.0 - u)*RDB[ptr + 3*((k1*ny + j1)*nx + i0) + n]
+	+ u*RDB[ptr + 3*((k1*ny + j1)*nx + i1) + n];
+
+      /* Interpolate in z-direction */
+
+      a = (1.0 - w)*c + w*((1.0 - v)*a + v*b);
+
+      /* Put value */
+
+      if (n == 0)
+	*f = a;
+      else
+	*T = a;
+    }
+
+  /* Point is inside */
+
+  return YES;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -299,6 +299,10 @@ void InitData()
 
   WDB[DATA_OPTI_MODE] = 4.0;
   WDB[DATA_OPTI_UNIONIZE_GRID] = -1.0;
+
+  /* Number of bins in energy grid hash tables (set in SetOptimization()) */
+
+  WDB[DATA_ERG_HASH_NB] = -1.0;
   WDB[DATA_OPTI_RECONSTRUCT_MICROXS] = -1.0;
   WDB[DATA_OPTI_RECONSTRUCT_MACROXS] = -1.0;
   WDB[DATA_OPTI_INCLUDE_SPECIALS] = (double)NO;
@@ -403,6 +407,11 @@ void InitData()
 
   WDB[DATA_BURN_CRAM_K] = 14.0;
 
+  /* Number of materials burned together with CRAM (work array of the */
+  /* batched solver grows with the batch) */
+
+  WDB[DATA_BURN_CRAM_BATCH] = 1.0;
+
   /* Predictor-corrector calculation */
 
   WDB[DATA_BURN_PRED_TYPE] = (double)PRED_TYPE_CONSTANT;
@@ -488,6 +497,29 @@ void InitData()
   WDB[DATA_OPTI_OMP_REPRODUCIBILITY] = (double)YES;
   WDB[DATA_OPTI_MPI_REPRODUCIBILITY] = (double)NO;
 
+  /* Event-based transport and particle bank size */
+
+  WDB[DATA_OPTI_EVENT_TRANSPORT] = (double)NO;
+  WDB[DATA_OPTI_EVENT_BANK_SIZE] = 256.0;
+
+  /* Random number generator type */
+
+  WDB[DATA_RNG_TYPE] = (double)RNG_TYPE_LCG;
+
+  /* Number of slots in thread-private caches of shared scoring buffer */
+
+  WDB[DATA_OPTI_BUF_CACHE_SIZE] = 256.0;
+  WDB[DATA_PTR_PRIVA_BUF_CACHE] = NULLPTR;
+
+  /* Directory for binary ACE cache files */
+
+  WDB[DATA_PTR_ACE_CACHE_PATH] = NULLPTR;
+
+  /* Warm-start snapshot */
+
+  WDB[DATA_PTR_SNAPSHOT_FNAME] = NULLPTR;
+  WDB[DATA_SNAPSHOT_KEY] = 0.0;
+
   /* Include scattering production in removal xs */
 
   WDB[DATA_GC_REMXS_MULT] = (double)YES;
@@ -586,6 +618,26 @@ void InitData()
 
   WDB[DATA_OPTI_MPI_BATCH_SIZE] = 10000.0;
 
+  /* Results and buffer are reduced with nonblocking collectives */
+
+  WDB[DATA_OPTI_MPI_COLL_MODE] = (double)MPI_COLL_MODE_NB;
+
+  /* Each MPI task has a private copy of ACE data */
+
+  WDB[DATA_OPTI_SHARED_ACE] = (double)NO;
+
+  /* Detector tallies are not decomposed between MPI tasks */
+
+  WDB[DATA_OPTI_DECOMP_TALLY_MIN] = 0.0;
+
+  /* Sparse tables are used only for detectors with "dsparse" */
+
+  WDB[DATA_OPTI_SPARSE_TALLY_MIN] = 0.0;
+
+  /* No binary output file */
+
+  WDB[DATA_BINARY_OUTPUT] = (double)NO;
+
   /* Actinide limits for burnup calculation */
 
   WDB[DATA_BU_ACT_MIN_Z] = 90.0;
@@ -649,6 +701,16 @@ void InitData()
 
   WDB[DATA_STL_ENFORCE_DT] = (double)YES;
 
+  /* Ray tests and surface distances in STL geometries are done with */
+  /* bounding volume hierarchies instead of search mesh walk */
+
+  WDB[DATA_STL_BVH] = (double)NO;
+
+  /* Point-average interfaces are calculated directly from points, */
+  /* without interpolation lattice */
+
+  WDB[DATA_IFC_PT_LATTICE_N] = 0.0;
+
   /* Reset parameters for Wielandt method */
 
   WDB[DATA_WIELANDT_MODE] = (double)WIELANDT_MODE_NONE;
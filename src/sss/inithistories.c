@@ -238,6 +238,58 @@ void InitHistories()
       WDB[DATA_PTR_DYN_PARTCOUNT] = (double)ptr;
     }
   
+  /***************************************************************************/
+
+  /***** Event-based transport ***********************************************/
+
+  if ((long)RDB[DATA_OPTI_EVENT_TRANSPORT] == YES)
+    {
+      /* Check simulation mode and event recording */
+
+      if ((long)RDB[DATA_SIMULATION_MODE] != SIMULATION_MODE_CRIT)
+	{
+	  Note(0, "Event-based transport only in criticality source mode");
+	  WDB[DATA_OPTI_EVENT_TRANSPORT] = (double)NO;
+	}
+      else if ((long)RDB[DATA_EVENT_RECORD_FLAGS] != 0)
+	{
+	  Note(0, "Event-based transport not used with event recording");
+	  WDB[DATA_OPTI_EVENT_TRANSPORT] = (double)NO;
+	}
+      else
+	{
+	  /* Allocate memory for particle bank */
+
+	  np = (long)RDB[DATA_OPTI_EVENT_BANK_SIZE];
+	  WorkArray(DATA_PTR_WORK_PRIVA_EVENT, PRIVA_ARRAY, 
+		    np*EVB_VARIABLES, 0);
+
+	  /* Separate secondary que for each slot, so that secondaries */
+	  /* stay in the history that produced them */
+
+	  loc0 = ReallocMem(DATA_ARRAY,
+			    np*(long)RDB[DATA_OMP_MAX_THREADS]);
+	  WDB[DATA_PART_PTR_EVB_QUE] = (double)loc0;
+
+	  for (n = 0; n < np*(long)RDB[DATA_OMP_MAX_THREADS]; n++)
+	    {
+	      ptr = NewItem(loc0++, PARTICLE_BLOCK_SIZE);
+	      WDB[ptr + PARTICLE_TYPE] = (double)PARTICLE_TYPE_DUMMY;
+	      WDB[ptr + PARTICLE_RNG_IDX] = -1.0;
+	    }
+	}
+    }
+
+  /* Thread-private caches for shared scoring buffer */
+
+  if (((long)RDB[DATA_OPTI_SHARED_BUF] == YES) && 
+      ((long)RDB[DATA_OMP_MAX_THREADS] > 1) &&
+      ((np = (long)RDB[DATA_OPTI_BUF_CACHE_SIZE]) > 0))
+    {
+      ptr = AllocPrivateData(np*BUFC_BLOCK_SIZE, PRIVA_ARRAY);
+      WDB[DATA_PTR_PRIVA_BUF_CACHE] = (double)ptr;
+    }
+
   /* History index for debugging */
   
   ptr = AllocPrivateData(1, PRIVA_ARRAY);
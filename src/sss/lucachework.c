@@ -0,0 +1,66 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : lucachework.c                                  */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Returns thread-private work array for batched CRAM solver    */
+/*                                                                           */
+/* Comments: - The array is stored with the cached LU decomposition and      */
+/*             re-used between calls, so the burnup solver does not need     */
+/*             to allocate memory for each material. It is only grown when   */
+/*             a larger size is requested and freed in FreeLUCache().        */
+/*                                                                           */
+/*           - Contents are not preserved between calls.                     */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "LUCacheWork:"
+
+/*****************************************************************************/
+
+complex *LUCacheWork(long id, long sz)
+{
+  struct LUCache *c;
+
+  /* Check thread id and size */
+
+  CheckValue(FUNCTION_NAME, "id", "", id, 0, MAX_OMP_THREADS - 1);
+  CheckValue(FUNCTION_NAME, "sz", "", sz, 1, INFTY);
+
+  /* Pointer to cache */
+
+  c = &lucache[id];
+
+  /* Check size */
+
+  if ((c->work == NULL) || (sz > c->wsz))
+    {
+      /* Free previous */
+
+      if (c->work != NULL)
+	Mem(MEM_FREE, c->work);
+
+      /* Allocate memory */
+
+      c->work = (complex *)Mem(MEM_ALLOC, sz, sizeof(complex));
+      c->wsz = sz;
+    }
+
+  /* Return pointer */
+
+  return c->work;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -236,15 +236,28 @@ double MacroXS(long rea0, double E, long id)
   if ((xs = TestValuePair(rea0 + REACTION_PTR_PREV_XS, E, id)) > -INFTY)
     return xs;
 
-  /* Reset cross section */
-  
-  xs = 0.0;
-  
   /* Get pointer to partial list */
   
   ptr = (long)RDB[rea0 + REACTION_PTR_PARTIAL_LIST];
   CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
 
+  /* Sum from packed list */
+
+  if ((xs = PackedMacroXS(ptr, mt, E, id)) > -INFTY)
+    {
+      /* Store cross section */
+
+      StoreValuePair(rea0 + REACTION_PTR_PREV_XS, E, xs, id);
+
+      /* Return value */
+
+      return xs;
+    }
+
+  /* Reset cross section */
+  
+  xs = 0.0;
+
   /* Reset reaction pointer (rewind list) */
   
   rea = -1;
@@ -28,7 +28,7 @@ long MakeEnergyGrid(long ne, long i0, long lvl, long ptr,
 		    const double *E, long mode)
 {
   double Emin, Emax, E0, mean, med;
-  long erg, idx, loc0, loc1, n, nb, imin, imax, type;
+  long erg, idx, loc0, loc1, n, nb, nh, imin, imax, type;
 
   /* Check if first level */
 
@@ -109,11 +109,13 @@ long MakeEnergyGrid(long ne, long i0, long lvl, long ptr,
   WDB[erg + ENERGY_GRID_PTR_LOW] = NULLPTR;
   WDB[erg + ENERGY_GRID_PTR_HIGH] = NULLPTR;
   WDB[erg + ENERGY_GRID_PTR_BINS] = NULLPTR;
+  WDB[erg + ENERGY_GRID_PTR_HASH] = NULLPTR;
 
   /* Reset mid-point energy and number of bins */
 
   WDB[erg + ENERGY_GRID_EMID] = -1.0;
   WDB[erg + ENERGY_GRID_NB] = -1.0;
+  WDB[erg + ENERGY_GRID_NH] = 0.0;
 
   /* Allocate memory for previous values */
 
@@ -139,6 +141,54 @@ long MakeEnergyGrid(long ne, long i0, long lvl, long ptr,
 
   WDB[erg + ENERGY_GRID_TYPE] = (double)type;
 
+  /***************************************************************************/
+
+  /***** Hash table **********************************************************/
+
+  /* Logarithmic hash table for the top level grid. Each entry is the    */
+  /* index of the interval containing the lower boundary of a hash bin, */
+  /* so that one bin index limits the search to a few points (see      */
+  /* GridSearch()). */
+
+  if ((lvl == 0) && ((nh = (long)RDB[DATA_ERG_HASH_NB]) > 0) && 
+      (ne > 100) && (Emin > 0.0))
+    {
+      /* Allocate memory for hash table */
+
+      loc1 = ReallocMem(DATA_ARRAY, nh + 1);
+
+      /* Put pointer and number of bins */
+
+      WDB[erg + ENERGY_GRID_PTR_HASH] = (double)loc1;
+      WDB[erg + ENERGY_GRID_NH] = (double)nh;
+
+      /* Loop over bin boundaries */
+
+      for (n = 0; n < nh + 1; n++)
+	{
+	  /* Calculate energy */
+
+	  E0 = exp(((double)n/((double)nh))*(log(Emax) - log(Emin)) 
+		   + log(Emin));
+
+	  /* Search index */
+
+	  if (E0 <= Emin)
+	    idx = 0;
+	  else if (E0 >= Emax)
+	    idx = ne - 2;
+	  else if ((idx = SearchArray(E, E0, ne)) < 0)
+	    Die(FUNCTION_NAME, "idx < 0: %E %E %E, %ld", E[0], E0, 
+		E[ne - 1], ne);
+
+	  /* Put value */
+
+	  WDB[loc1 + n] = (double)idx;
+	}
+    }
+
+  /***************************************************************************/
+
   /* TÄÄ !!!!!!!!!!!!!!!!!!!!!! */
   /*
   return erg;
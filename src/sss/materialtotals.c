@@ -23,10 +23,6 @@ extern "C" {
 
 #define FUNCTION_NAME "MaterialTotals:"
 
-/* Use local function to simplify OpenMP implementation */
-
-void MaterialTotals0(long);
-
 /* Toi for-luupin OpenMP -rinnakkaistus jumittaa espnr130-klusterissa. */
 /* Tll viritelmll sen saa kytketty pois */
 
@@ -101,19 +97,9 @@ void MaterialTotals()
     {
       /***** Parallelization by material *************************************/
 
-      /* Reset thread numbers */
+      /* Distribute materials to threads */
 
-      mat = (long)RDB[DATA_PTR_M0];
-      while (mat > VALID_PTR)
-	{
-	  /* Check thread number */
-	  
-	  WDB[mat + MATERIAL_OMP_ID] = -1.0;
-	  
-	  /* Next material */
-	  
-	  mat = NextItem(mat);
-	}	  
+      ScheduleMatTasks(MAT_TASK_TOTALS);
 
       /* Start parallel timer */
 
@@ -127,27 +113,17 @@ void MaterialTotals()
 
 	PrintProgress(0, 0);
 
-	/* Loop over materials */
+	/* Loop over tasks */
 	
-	mat = (long)RDB[DATA_PTR_M0];
-	while (mat > VALID_PTR)
+	while ((mat = NextMatTask(OMP_THREAD_NUM)) > VALID_PTR)
 	  {
-	    /* Test parallel id's */
-
-	    if (MyParallelMat(mat, YES) == YES)
-	      {
-		/* Process */
+	    /* Process */
 		    
-		MaterialTotals0(mat);
+	    MaterialTotals0(mat);
 
-		/* Print */
+	    /* Print */
 		
-		PrintProgress(mat, 1);
-	      }
-	    
-	    /* Next material */
-	    
-	    mat = NextItem(mat);
+	    PrintProgress(mat, 1);
 	  }
       }
     
@@ -159,6 +135,10 @@ void MaterialTotals()
 
       PrintProgress(0, 100);
 
+      /* Print load balance and free task list */
+
+      FinishMatTasks();
+
       /***********************************************************************/
     }
 }
@@ -511,6 +511,11 @@ void MatlabOutput()
       fprintf(fp, "PROCESS_TIME              (idx, [1:  2])  = [ %12.5E %12.5E ];\n", 
 	      TimerVal(TIMER_PROCESS_TOTAL)/60.0, TimerVal(TIMER_PROCESS)/60.0);
 
+      fprintf(fp, "XS_PROCESS_TIME           (idx, [1:  5])  = [ %12.5E %12.5E %12.5E %12.5E %12.5E ];\n", 
+	      TimerVal(TIMER_XS_READ)/60.0, TimerVal(TIMER_XS_BROADEN)/60.0,
+	      TimerVal(TIMER_XS_UNIONIZE)/60.0, TimerVal(TIMER_XS_PROCESS)/60.0,
+	      TimerVal(TIMER_XS_TMP)/60.0);
+
       fprintf(fp, "TRANSPORT_CYCLE_TIME      (idx, [1:  3])  = [ %12.5E %12.5E %12.5E ];\n", 
 	      TimerVal(TIMER_TRANSPORT_TOTAL)/60.0, RDB[DATA_PRED_TRANSPORT_TIME]/60.0, RDB[DATA_CORR_TRANSPORT_TIME]/60.0);
 
@@ -530,6 +535,31 @@ void MatlabOutput()
       fprintf(fp, "MPI_OVERHEAD_TIME         (idx, [1:  2])  = [ %12.5E %12.5E ];\n", 
 	      TimerVal(TIMER_MPI_OVERHEAD_TOTAL)/60.0, TimerVal(TIMER_MPI_OVERHEAD)/60.0);
 
+      /* Bandwidth of nonblocking collectives (calls, MB, MB/s) */
+
+      if (mpitasks > 1)
+	for (n = 0; n < MPI_COLL_N; n++)
+	  {
+	    if (n == MPI_COLL_RES1)
+	      fprintf(fp, "MPI_RES1_REDUCE           ");
+	    else if (n == MPI_COLL_RES2)
+	      fprintf(fp, "MPI_RES2_REDUCE           ");
+	    else
+	      fprintf(fp, "MPI_BUF_REDUCE            ");
+
+	    fprintf(fp, "(idx, [1:  3])  = [ %ld %12.5E %12.5E ];\n", 
+		    mpicoll[n].ncall, mpicoll[n].bytes/MEGA, 
+		    (mpicoll[n].time > 0.0) ? 
+		    mpicoll[n].bytes/MEGA/mpicoll[n].time : 0.0);
+	  }
+
+      /* Scores forwarded to decomposed detector bins (calls, MB, MB/s) */
+
+      if (dtally.n > 0)
+	fprintf(fp, "MPI_DTALLY_EXCHANGE       (idx, [1:  3])  = [ %ld %12.5E %12.5E ];\n", 
+		dtally.ncall, dtally.bytes/MEGA, 
+		(dtally.time > 0.0) ? dtally.bytes/MEGA/dtally.time : 0.0);
+
       fprintf(fp, "ESTIMATED_RUNNING_TIME    (idx, [1:  2])  = [ %12.5E %12.5E ];\n", RDB[DATA_ESTIM_CYCLE_TIME]/60.0, RDB[DATA_ESTIM_TOT_TIME]/60.0);
 
       if (TimerVal(TIMER_RUNTIME) > 0.0)
@@ -14,6 +14,11 @@ extern "C" {
 /* Comments: Funktio palauttaa matriisieksponenttiratkaisun N=exp(At)N0,     */
 /*           miss exp(At)N0 on laskettu CRAM-menetelmn kertaluvulla k      */
 /*                                                                           */
+/*         - MatrixExponentialBatch() solves nb materials whose matrices     */
+/*           have the same sparsity pattern in one call. The poles of all    */
+/*           materials form one batch in NumericGaussBatch() (pole index     */
+/*           innermost). Results are the same as with separate calls.        */
+/*                                                                           */
 /*****************************************************************************/
 
 #include "header.h"
@@ -28,11 +33,34 @@ extern "C" {
 
 double *MatrixExponential(struct ccsMatrix *A, double *N0, double t)
 {
-  long i, j, k, n, m, cram_k;
+  double *N;
+
+  /* Allocate memory for solution */
+
+  N = (double *)Mem(MEM_ALLOC, A->n, sizeof(double));
+
+  /* Solve as batch of one */
+
+  MatrixExponentialBatch(&A, &N0, &t, 1, &N);
+
+  /* Return solution */
+
+  return N;
+}
+
+/*****************************************************************************/
+
+/* Same for nb materials, solutions are put in N[0...nb - 1] (allocated by */
+/* caller). Matrices must have the same sparsity pattern. */
+
+void MatrixExponentialBatch(struct ccsMatrix **A, double **N0, double *t,
+			    long nb, double **N)
+{
+  long i, j, k, n, m, np, nbp, q, nnz, cram_k;
  
-  double *N;  /* CRAM-ratkaisu, joka palautetaan */
+  double y;
 
-  complex z, alpha0, alpha[8], theta[8], *b, *N0c, *x, *y, *val; 
+  complex alpha0, alpha[8], theta[8], *b, *x, *wrk, *vb, *thb; 
 
   struct ccsMatrix *LU;
 
@@ -259,37 +287,27 @@ double *MatrixExponential(struct ccsMatrix *A, double *N0, double t)
 
   /* Aseta muuttujat kenttiin */
 
-  n   = A->n; 
-  m   = A->m; 
+  CheckValue(FUNCTION_NAME, "nb", "", nb, 1, INFTY);
+
+  n   = A[0]->n; 
+  m   = A[0]->m; 
+  nnz = A[0]->nnz;
   
   if (m != n)
     Die(FUNCTION_NAME, "Burnup matrix not square\n"); 
-  
-  /* Varaa tilaa uusille muuttujille */
-  /* Lasketaan ratkaisu ensin thn */
-
-  y =  (complex *)Mem(MEM_ALLOC, n, sizeof(complex));
-
-  /* Reaalinen ratkaisu joka palautetaan */
-
 
-  N = (double  *)Mem(MEM_ALLOC, n, sizeof(double));
+  /* Check that all matrices have the same pattern */
 
-  /*
-  N = WorkArray(DATA_PTR_WORK_COMP2, PRIVA_ARRAY, n, OMP_THREAD_NUM);
-  */
+  for (q = 1; q < nb; q++)
+    if ((A[q]->n != n) || (A[q]->nnz != nnz) ||
+	(memcmp(A[q]->colptr, A[0]->colptr, (n + 1)*sizeof(long))) ||
+	(memcmp(A[q]->rowind, A[0]->rowind, nnz*sizeof(long))))
+      Die(FUNCTION_NAME, "Mismatch in sparsity pattern");
 
-  /* b = alpha[k] * N0 */
+  /* Number of poles per material and total batch size */
 
-  b = (complex *)Mem(MEM_ALLOC, n, sizeof(complex));
-
-  /* (A - theta[k]*I) x = b */
-
-  x = (complex *)Mem(MEM_ALLOC, n, sizeof(complex));
-
-  /* N0 kompleksiformaatissa  */
-  
-  N0c = (complex *)Mem(MEM_ALLOC, n, sizeof(complex));
+  np = cram_k/2;
+  nbp = nb*np;
 
 /*****************************************************************************/
 
@@ -297,120 +315,95 @@ double *MatrixExponential(struct ccsMatrix *A, double *N0, double t)
 
 #ifdef DEBUG
 
-  for (i = 0; i < A->nnz; i++)
-    {
-      CheckValue(FUNCTION_NAME, "A re (1)", "", A->values[i].re, -INFTY, 
-		 INFTY);
-      CheckValue(FUNCTION_NAME, "A im (1)", "", A->values[i].im, 0.0, 0.0);
-    }
+  for (q = 0; q < nb; q++)
+    for (i = 0; i < A[q]->nnz; i++)
+      {
+	CheckValue(FUNCTION_NAME, "A re (1)", "", A[q]->values[i].re, -INFTY, 
+		   INFTY);
+	CheckValue(FUNCTION_NAME, "A im (1)", "", A[q]->values[i].im, 
+		   0.0, 0.0);
+      }
 
 #endif
 
-  /* Lasketaan ensin symbolinen LU-hajotelma (tm tarvitsee tehd */
-  /* vain kerran) */
+  /* Decomposition is re-used if sparsity pattern has not changed */
 
-  LU = SymbolicLU(A);
-  /* Hae rivi-informaatio numeerista eliminaatiota varten */
-  FindRowIndexes(LU);
+  LU = CachedSymbolicLU(A[0], OMP_THREAD_NUM);
 
-  /* Tarkastetaan matriisin LU alkiot */
-  
-#ifdef DEBUG
+  /* Thread-private work array for right-hand sides, solutions, */
+  /* batched solver and poles (no memory allocation per material) */
+
+  b = LUCacheWork(OMP_THREAD_NUM, (LU->nnz + 5*n + 2)*nbp);
+  x = &b[n*nbp];
+  wrk = &x[n*nbp];
+  thb = &wrk[(LU->nnz + 3*n + 1)*nbp];
+
+  /* Matrix values are put in the beginning of the work array */
+
+  vb = wrk;
 
-  for (i = 0; i < LU->nnz; i++)
+  /* Loop over materials */
+
+  for (q = 0; q < nb; q++)
     {
-      CheckValue(FUNCTION_NAME, "LU re (1)", "", LU->values[i].re, -INFTY, 
-		 INFTY);
-      CheckValue(FUNCTION_NAME, "LU im (1)", "", LU->values[i].im, 0.0, 0.0);
-    }
-  
-#endif
+      /* Tarkistetaan aika-askel (JLe) */
 
+      if ((t[q] < ZERO) || (t[q] > INFTY))
+	Die(FUNCTION_NAME, "t = %E\n", t[q]);
 
+      /* Copy values to decomposition (pattern is the same) */
 
-  /* ccsMatrixPrint(LU); */
-  
-  /* Varataan tila toiselle samankokoiselle matriisille */
-  
-  /* Jaa, onkohan tss turhaa kopioida koko matriisi, eik riittisi ottaa talteen values??*/
+      if (q > 0)
+	LU = CachedSymbolicLU(A[q], OMP_THREAD_NUM);
 
-  /*LU_copy = ccsMatrixNew(n,n,LU->nnz);*/
+      /* Alusta muuttujat  */
 
-  /* Tarkistetaan aika-askel (JLe) */
+      for (i=0 ; i < LU->nnz; i++)
+	LU->values[i].re = LU->values[i].re*t[q]; /* Lis aika t */
 
-  if ((t < ZERO) || (t > INFTY))
-    Die(FUNCTION_NAME, "t = %E\n", t);
+      /* Values and poles for each pole of material */
 
-  /* Alusta muuttujat  */
+      for (k = 0; k < np; k++)
+	{
+	  for (i = 0; i < LU->nnz; i++)
+	    vb[i*nbp + q*np + k] = LU->values[i];
 
-  for (i=0 ; i < LU->nnz; i++)
-    LU->values[i].re = LU->values[i].re*t; /* Lis aika t matriisiin */
-  
-  for (i=0; i < n; i++)
-    N0c[i].re = N0[i]; 
+	  thb[q*np + k] = theta[k];
+	}
 
-  /* Ota matriisin numeeriset arvot talteen */
+      /* b = alpha(k) * N0, pole index innermost */
+
+      for (j = 0; j < n; j++)
+	for (k = 0; k < np; k++)
+	  {
+	    b[j*nbp + q*np + k].re = alpha[k].re*N0[q][j];
+	    b[j*nbp + q*np + k].im = alpha[k].im*N0[q][j];
+	  }
+    }
 
-  val = (complex *)Mem(MEM_ALLOC, LU->nnz, sizeof(complex));
-  memcpy(val, LU->values, (LU->nnz) * sizeof(complex)); 
-    
   /***************************************************************************/
 
   /* Lasketaan CRAM-approksimaatio astetta cram_k */
-  
-  /* vaatii cram_k / 2 matriisin knt */
-  
-  for (k=0; k < cram_k/2; k++)
-    { 
-      /* Kopioi LU -> LU_copy */
-
-      memcpy(LU->values, val, (LU->nnz) * sizeof(complex)); 
-
-      /*    ccsMatrixCopy(LU, LU_copy); */
-      /* tarvitseeko tss oikeestaan kopioida muuta kuin values? */
-      /* Eik indeksit ja muut pysy samana koko ajan?? */
-
-
-      /* b = alpha(k) * N0 */
-    
-      for (j=0; j < n; j++)
-	b[j] = c_mul( alpha[k], N0c[j]); 
-    
-      /* ratkaise (A - theta[k]*I)x = b  */
-
-      NumericGauss(LU, b, theta[k], x); 
-       
-      /* y = alpha0 * N0 + sum_i (A - theta[k]*I)^(-1) * b */
-       
-      for (i= 0; i < n; i++)
-	y[i] = c_add(y[i], x[i]);	       
-    }
 
-  /* Listn viel alpha0 * N0 muuttujaan y */
-  
-  for (j=0; j < n; j++)
-    {
-      z = c_mul(alpha0, N0c[j]);     
-      N[j] = (2.0 * y[j].re) + z.re;
-    }
-  
-  /**************************************************************************/
-  
-  /* Vapauta muisti */
+  /* ratkaise (A - theta[k]*I)x = b kaikille napoille kerralla */
 
-  Mem(MEM_FREE, y);
-  Mem(MEM_FREE, b);
-  Mem(MEM_FREE, N0c);
-  Mem(MEM_FREE, x, 0);
-  ccsMatrixFree(LU);
-  
-  Mem(MEM_FREE, val);
+  if (NumericGaussBatch(LU, b, thb, nbp, x, wrk) < 0)
+    Die(FUNCTION_NAME, "Singular burnup matrix");
+
+  /* N = alpha0 * N0 + 2 Re(sum_k (A - theta[k]*I)^(-1) * b) */
 
-  /*  ccsMatrixFree(LU_copy); */
+  for (q = 0; q < nb; q++)
+    for (j=0; j < n; j++)
+      {
+	/* Sum over poles */
+
+	y = 0.0;
 
-  /* palauta ratkaisu */
+	for (k = 0; k < np; k++)
+	  y = y + x[j*nbp + q*np + k].re;
 
-  return N; 
+	N[q][j] = (2.0 * y) + alpha0.re*N0[q][j];
+      }
   
   /**************************************************************************/
 }
@@ -73,6 +73,10 @@ void *Mem(long mode, ...)
 	Die(FUNCTION_NAME, "Memory allocation already denied");
       else      
 	WDB[DATA_ALLOW_MEM_OP] = (double)NO;
+
+      /* Mark data for same-page merging between MPI tasks */
+
+      MergeMainData();
     }
   else if (mode == MEM_ALLOC)
     {
@@ -0,0 +1,108 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : mergemaindata.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Marks main data and ASCII arrays for kernel same-page        */
+/*              merging, so that identical pages are shared by MPI tasks     */
+/*              within node                                                  */
+/*                                                                           */
+/* Comments: - Called from Mem() when memory allocation is denied, if        */
+/*             "set shace 1" is given. The arrays are not re-allocated       */
+/*             after that, until allocation is allowed again.                */
+/*                                                                           */
+/*           - All tasks process the same data, so the pages holding cross   */
+/*             sections, grids and other read-only data are identical and    */
+/*             the kernel keeps one copy per node. Pages written during      */
+/*             the run are copied on write, so the writable parts stay       */
+/*             private without changes in the data layout.                   */
+/*                                                                           */
+/*           - Requires Linux with KSM enabled (/sys/kernel/mm/ksm/run set   */
+/*             to 1, checked in ShareACEData()). Pages are merged by the     */
+/*             kernel thread in the background, not immediately.             */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "MergeMainData:"
+
+/*****************************************************************************/
+
+void MergeMainData()
+{
+
+#ifdef MADV_MERGEABLE
+
+  long n, sz, pg;
+  unsigned long beg, end;
+  const void *ptr;
+
+  /* Check mode */
+
+  if (mpinode.merge == NO)
+    return;
+
+  /* Get page size */
+
+  pg = sysconf(_SC_PAGESIZE);
+  CheckValue(FUNCTION_NAME, "pg", "", pg, 1, INFTY);
+
+  /* Loop over main data and ASCII arrays */
+
+  for (n = 0; n < 2; n++)
+    {
+      /* Get pointer and size in bytes */
+
+      if (n == 0)
+	{
+	  ptr = (const void *)RDB;
+	  sz = (long)RDB[DATA_ALLOC_MAIN_SIZE]*sizeof(double);
+	}
+      else
+	{
+	  ptr = (const void *)ASCII;
+	  sz = (long)RDB[DATA_ASCII_DATA_SIZE]*sizeof(char);
+	}
+
+      /* Check pointer */
+
+      if (ptr == NULL)
+	continue;
+
+      /* Whole pages within array */
+
+      beg = ((unsigned long)ptr + pg - 1) & ~((unsigned long)pg - 1);
+      end = ((unsigned long)ptr + sz) & ~((unsigned long)pg - 1);
+
+      if (end <= beg)
+	continue;
+
+      /* Mark for merging */
+
+      if (madvise((void *)beg, end - beg, MADV_MERGEABLE) != 0)
+	{
+	  /* Not supported by kernel, use private copies */
+
+	  Note(0, "Same-page merging not available, data is not shared");
+
+	  mpinode.merge = NO;
+
+	  return;
+	}
+    }
+
+#endif
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
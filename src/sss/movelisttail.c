@@ -0,0 +1,123 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : movelisttail.c                                 */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Moves item and all items after it to the end of another      */
+/*              list                                                         */
+/*                                                                           */
+/* Comments: - Used for moving particles between banks and stacks without    */
+/*             removing and adding them one by one. Only the pointers to     */
+/*             common data are looped over.                                  */
+/*                                                                           */
+/*           - The first item cannot be moved (lists used for particles      */
+/*             start with a dummy).                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "MoveListTail:"
+
+/*****************************************************************************/
+
+void MoveListTail(long ptr, long root)
+{
+  long loc0, loc1, lst, prev, last0, last1, n;
+
+  /* Check pointer */
+
+  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+  /* Check if list is closed */
+
+  if ((long)RDB[ptr + LIST_PTR_DIRECT] > VALID_PTR)
+    Die(FUNCTION_NAME, "Trying to move items from a closed list");
+
+  /* Get pointer to previous item */
+
+  if ((prev = PrevItem(ptr)) < VALID_PTR)
+    Die(FUNCTION_NAME, "Trying to move first item");
+
+  /* Get pointer to common data of source list */
+
+  loc0 = (long)RDB[ptr + LIST_PTR_COMMON];
+  CheckPointer(FUNCTION_NAME, "(loc0)", DATA_ARRAY, loc0);
+
+  /* Check root pointer */
+
+  if (root < 1)
+    Die(FUNCTION_NAME, "Pointer error %ld", root);
+
+  /* Check that target list exists */
+
+  if ((lst = (long)RDB[root]) < VALID_PTR)
+    Die(FUNCTION_NAME, "List is empty");
+
+  /* Get pointer to common data of target list */
+
+  loc1 = (long)RDB[lst + LIST_PTR_COMMON];
+  CheckPointer(FUNCTION_NAME, "(loc1)", DATA_ARRAY, loc1);
+
+  /* Check lists */
+
+  if (loc0 == loc1)
+    Die(FUNCTION_NAME, "Source and target are the same list");
+
+  if ((long)RDB[loc0 + LIST_COMMON_ITEM_SIZE] != 
+      (long)RDB[loc1 + LIST_COMMON_ITEM_SIZE])
+    Die(FUNCTION_NAME, "Mismatch in item size");
+
+  /* Get pointers to last items */
+
+  last0 = (long)RDB[loc0 + LIST_COMMON_PTR_LAST];
+  CheckPointer(FUNCTION_NAME, "(last0)", DATA_ARRAY, last0);
+
+  last1 = (long)RDB[loc1 + LIST_COMMON_PTR_LAST];
+  CheckPointer(FUNCTION_NAME, "(last1)", DATA_ARRAY, last1);
+
+  /* Put pointers to common data and count items */
+
+  n = 0;
+
+  lst = ptr;
+  while (lst > VALID_PTR)
+    {
+      /* Put pointer */
+
+      WDB[lst + LIST_PTR_COMMON] = (double)loc1;
+
+      /* Add to count */
+
+      n++;
+
+      /* Next */
+
+      lst = NextItem(lst);
+    }
+
+  /* Detach items from source list */
+
+  WDB[prev + LIST_PTR_NEXT] = NULLPTR;
+  WDB[loc0 + LIST_COMMON_PTR_LAST] = (double)prev;
+  WDB[loc0 + LIST_COMMON_N_ITEMS] = RDB[loc0 + LIST_COMMON_N_ITEMS] - (double)n;
+
+  /* Attach items to target list */
+
+  WDB[last1 + LIST_PTR_NEXT] = (double)ptr;
+  WDB[ptr + LIST_PTR_PREV] = (double)last1;
+  WDB[loc1 + LIST_COMMON_PTR_LAST] = (double)last0;
+  WDB[loc1 + LIST_COMMON_N_ITEMS] = RDB[loc1 + LIST_COMMON_N_ITEMS] + (double)n;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
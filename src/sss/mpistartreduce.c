@@ -0,0 +1,124 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : mpistartreduce.c                               */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Starts nonblocking in-place sum reduction of data block to   */
+/*              all MPI tasks                                                */
+/*                                                                           */
+/* Comments: - Replaces MPITransfer() reduce + broadcast pair for results    */
+/*             and buffer. Data is split in chunks of batch size (at most    */
+/*             MPI_COLL_MAX_REQ chunks) that are all posted at once without  */
+/*             barriers. Completed by MPIWaitReduce(), the array must not be */
+/*             accessed in between.                                          */
+/*                                                                           */
+/*           - The MPI library is free to implement allreduce as             */
+/*             reduce-scatter + allgather, which moves less data than the    */
+/*             reduce + broadcast through task 0.                            */
+/*                                                                           */
+/*           - Blocking allreduce is used with MPI versions older than 3.    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "MPIStartReduce:"
+
+/*****************************************************************************/
+
+void MPIStartReduce(double *dat, long sz, long id)
+{
+
+#ifdef MPI
+
+  long tot, sz0, n, rc;
+
+  /* Check id */
+
+  CheckValue(FUNCTION_NAME, "id", "", id, 0, MPI_COLL_N - 1);
+
+  /* Check that previous reduction is completed */
+
+  if (mpicoll[id].nreq > 0)
+    Die(FUNCTION_NAME, "Reduction %ld already pending (task %d)", id, mpiid);
+
+  /* Check main data block */
+
+  if (RDB == NULL)
+    Die(FUNCTION_NAME, "Main data block not allocated (task %d)", mpiid);
+
+  /* Get MPI batch size */
+
+  if ((sz0 = (long)RDB[DATA_OPTI_MPI_BATCH_SIZE]) < 1)
+    Die(FUNCTION_NAME, "Batch size not defined (task %d)", mpiid);
+
+  /* Limit number of requests */
+
+  if (sz > sz0*MPI_COLL_MAX_REQ)
+    sz0 = (sz + MPI_COLL_MAX_REQ - 1)/MPI_COLL_MAX_REQ;
+
+  /* Put size and start time */
+
+  mpicoll[id].sz = sz;
+  mpicoll[id].t0 = MPI_Wtime();
+
+  /* Avoid compiler warning */
+
+  rc = MPI_SUCCESS;
+
+  /* Loop over chunks */
+
+  n = 0;
+  tot = 0;
+
+  while (tot < sz)
+    {
+      /* Compare to total */
+
+      if (tot + sz0 > sz)
+	sz0 = sz - tot;
+
+      /* Start reduction */
+
+#if MPI_VERSION >= 3
+
+      rc = MPI_Iallreduce(MPI_IN_PLACE, &dat[tot], sz0, MPI_DOUBLE, MPI_SUM,
+			  MPI_COMM_WORLD, &mpicoll[id].req[n]);
+#else
+
+      rc = MPI_Allreduce(MPI_IN_PLACE, &dat[tot], sz0, MPI_DOUBLE, MPI_SUM,
+			 MPI_COMM_WORLD);
+
+      mpicoll[id].req[n] = MPI_REQUEST_NULL;
+
+#endif
+
+      /* Check error */
+
+      if (rc != MPI_SUCCESS)
+	Die(FUNCTION_NAME, "Reduction failed with error condition %ld", rc);
+
+      /* Add to totals */
+
+      tot = tot + sz0;
+      n++;
+    }
+
+  /* Put number of requests */
+
+  mpicoll[id].nreq = n;
+
+#endif
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
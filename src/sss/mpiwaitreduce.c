@@ -0,0 +1,70 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : mpiwaitreduce.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Completes reduction started by MPIStartReduce()              */
+/*                                                                           */
+/* Comments: - Bandwidth statistics are collected in mpicoll[] and printed   */
+/*             in MatlabOutput(). The time is measured from start to         */
+/*             completion, and includes any work overlapped with the         */
+/*             reduction.                                                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "MPIWaitReduce:"
+
+/*****************************************************************************/
+
+void MPIWaitReduce(long id)
+{
+
+#ifdef MPI
+
+  long rc;
+
+  /* Check id */
+
+  CheckValue(FUNCTION_NAME, "id", "", id, 0, MPI_COLL_N - 1);
+
+  /* Check that reduction was started (zero-size arrays have no requests) */
+
+  if (mpicoll[id].nreq < 1)
+    return;
+
+  /* Wait for completion */
+
+  rc = MPI_Waitall(mpicoll[id].nreq, mpicoll[id].req, MPI_STATUSES_IGNORE);
+
+  /* Check error */
+
+  if (rc != MPI_SUCCESS)
+    Die(FUNCTION_NAME, "Reduction failed with error condition %ld", rc);
+
+  /* Add to statistics */
+
+  mpicoll[id].ncall++;
+  mpicoll[id].bytes = mpicoll[id].bytes
+    + ((double)mpicoll[id].sz)*sizeof(double);
+  mpicoll[id].time = mpicoll[id].time + MPI_Wtime() - mpicoll[id].t0;
+
+  /* Reset number of requests */
+
+  mpicoll[id].nreq = 0;
+
+#endif
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
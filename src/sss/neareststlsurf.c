@@ -109,6 +109,55 @@ double NearestSTLSurf(long stl, double x, double y, double z, double u,
 
   /***** Point is in search mesh *********************************************/
 
+  /* Use bounding volume hierarchy if available */
+
+  if ((ptr = (long)RDB[stl + STL_PTR_BVH]) > VALID_PTR)
+    {
+      /* Distance to outer boundaries */
+
+      min = INFTY;
+
+      if (u > 0.0)
+	min = (xmax - x)/u;
+      else if (u < 0.0)
+	min = (xmin - x)/u;
+
+      if (v > 0.0)
+	{
+	  if ((l = (ymax - y)/v) < min)
+	    min = l;
+	}
+      else if (v < 0.0)
+	{
+	  if ((l = (ymin - y)/v) < min)
+	    min = l;
+	}
+
+      if (w > 0.0)
+	{
+	  if ((l = (zmax - z)/w) < min)
+	    min = l;
+	}
+      else if (w < 0.0)
+	{
+	  if ((l = (zmin - z)/w) < min)
+	    min = l;
+	}
+
+      /* Distance to nearest facet */
+
+      if ((l = STLBVHDistance(ptr, x, y, z, u, v, w)) < min)
+	min = l;
+
+      /* Check value */
+
+      CheckValue(FUNCTION_NAME, "min", "", min, 0.0, INFTY);
+
+      /* Return minimum distance */
+
+      return min;
+    }
+
   /* Distance to search mesh boundaries */
 
   min = NearestMeshBoundary(msh, x, y, z, u, v, w, NULL);
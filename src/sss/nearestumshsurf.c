@@ -26,9 +26,9 @@ extern "C" {
 double NearestUMSHSurf(long ifc, double x, double y, double z, 
 		       double u, double v, double w, long id)
 {
-  long loc0, msh, lst, surf, ptr, out;
+  long loc0, msh, lst, surf, ptr, out, bnd;
   long i, j, k, n, nf, np, pt;
-  long surflist, facelist;
+  long surflist, facelist, sidelist, nbrlist;
   double xmin, xmax, ymin, ymax, zmin, zmax, dx, dy, dz, l, min, d;
   double x1, y1, z1, params[9];
 
@@ -46,6 +46,11 @@ double NearestUMSHSurf(long ifc, double x, double y, double z,
   surflist = (long)RDB[ifc + IFC_PTR_SURF_LIST];
   CheckPointer(FUNCTION_NAME, "(surflist)", DATA_ARRAY, surflist);
 
+  /* Get pointer to neighbour list (point is outside all cells, so it */
+  /* can enter the mesh only through a face that has no neighbour) */
+
+  nbrlist = (long)RDB[ifc + IFC_PTR_NBR_LIST];
+
   /***************************************************************************/
 
   /***** Distance to outer boundaries ****************************************/
@@ -141,6 +146,41 @@ double NearestUMSHSurf(long ifc, double x, double y, double z,
       loc0 = (long)RDB[lst + SEARCH_MESH_CELL_CONTENT];
       CheckPointer(FUNCTION_NAME, "(loc0)", DATA_ARRAY, loc0);
 
+      /* Get pointers to cell's face and side lists */
+
+      facelist = (long)RDB[loc0 + IFC_TET_MSH_PTR_FACES];
+      CheckPointer(FUNCTION_NAME, "(facelist)", DATA_ARRAY, facelist);
+
+      sidelist = (long)RDB[loc0 + IFC_TET_MSH_PTR_SIDES];
+      CheckPointer(FUNCTION_NAME, "(sidelist)", DATA_ARRAY, sidelist);
+
+      nf = (long)RDB[loc0 + IFC_TET_MSH_NF];
+      CheckValue(FUNCTION_NAME, "nf", "", nf, 4, 4);
+
+      /* Check if cell has boundary faces (owner side without neighbour) */
+
+      if (nbrlist > VALID_PTR)
+	{
+	  bnd = NO;
+
+	  for (i = 0; i < nf; i++)
+	    if (((long)RDB[sidelist + i] < 0) &&
+		((long)RDB[nbrlist + (long)RDB[facelist + i]] < VALID_PTR))
+	      {
+		bnd = YES;
+		break;
+	      }
+
+	  /* Interior cells can't be reached without crossing a boundary */
+	  /* face of another cell first */
+
+	  if (bnd == NO)
+	    {
+	      lst = NextItem(lst);
+	      continue;
+	    }
+	}
+
       /***********************************************************************/
 
       /***** Distance to bounding box ****************************************/
@@ -291,16 +331,8 @@ double NearestUMSHSurf(long ifc, double x, double y, double z,
 
       if (out == NO)
 	{
-	  /* Get pointer to cell's face list */
-
-	  facelist = (long)RDB[loc0 + IFC_TET_MSH_PTR_FACES];
-	  CheckPointer(FUNCTION_NAME, "(facelist)", DATA_ARRAY, facelist);
-
 	  /* Loop over cell faces */
 
-	  nf = (long)RDB[loc0 + IFC_TET_MSH_NF];
-	  CheckValue(FUNCTION_NAME, "nf", "", nf, 4, 4);
-
 	  for (i = 0; i < nf; i++)
 	    {
 
@@ -308,6 +340,13 @@ double NearestUMSHSurf(long ifc, double x, double y, double z,
 
 	      n = (long)RDB[facelist + i];
 
+	      /* Skip internal faces */
+
+	      if (nbrlist > VALID_PTR)
+		if (((long)RDB[sidelist + i] > 0) ||
+		    ((long)RDB[nbrlist + n] > VALID_PTR))
+		  continue;
+
 	      /* Get pointer to face surface */
 
 	      surf = ListPtr(surflist, n);
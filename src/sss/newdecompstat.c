@@ -0,0 +1,111 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : newdecompstat.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Creates two-dimensional statistical variable with bins       */
+/*              decomposed between MPI tasks                                 */
+/*                                                                           */
+/* Comments: - Called from ProcessDetectors() instead of NewStat() for       */
+/*             detectors that are not referenced by other detectors and      */
+/*             don't store history. Falls back to NewStat() unless MPI       */
+/*             reproducibility is on and the number of bins is at least      */
+/*             the value given by "set dtally".                              */
+/*                                                                           */
+/*           - Only detectors are decomposed. Mesh plots are scored in the   */
+/*             RES2 array (AddMesh()), not in statistics with a buffer, and  */
+/*             their size is limited by the image resolution. Interface      */
+/*             statistics are read in all tasks at each coupling iteration   */
+/*             (RelaxInterfacePower()), so they would have to be gathered    */
+/*             every cycle.                                                  */
+/*                                                                           */
+/*           - Bins are split in consecutive slabs, task i owns bins         */
+/*             i*slab ... (i + 1)*slab - 1. RES1 and BUF blocks are          */
+/*             allocated for one slab only, so the pointers stay the same    */
+/*             in all tasks. Scores to bins owned by other tasks are         */
+/*             forwarded by ForwardScore() and added to the owner buffer by  */
+/*             ExchangeScores() before the reduction in CollectBuf().        */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "NewDecompStat:"
+
+/*****************************************************************************/
+
+long NewDecompStat(char *name, long n0, long n1)
+{
+  long loc0, ptr, ntot, min, slab;
+
+  /* Get total number of bins */
+
+  ntot = n0*n1;
+  CheckValue(FUNCTION_NAME, "ntot", "", ntot, 1, INFTY);
+
+  /* Check number of tasks, reproducibility and minimum size */
+
+  min = (long)RDB[DATA_OPTI_DECOMP_TALLY_MIN];
+
+  if ((mpitasks < 2) || (min < 1) || (ntot < min) ||
+      ((long)RDB[DATA_OPTI_MPI_REPRODUCIBILITY] == NO))
+    return NewStat(name, 2, n0, n1);
+
+  /* Number of bins per task */
+
+  slab = (ntot + mpitasks - 1)/mpitasks;
+
+  /* New item */
+
+  loc0 = NewItem(DATA_PTR_SCORE0, SCORE_BLOCK_SIZE);
+
+  /* Put name */
+
+  WDB[loc0 + SCORE_PTR_NAME] = (double)PutText(name);
+
+  /* Allocate memory for bin sizes and put values */
+
+  ptr = ReallocMem(DATA_ARRAY, 2);
+  WDB[ptr] = (double)n0;
+  WDB[ptr + 1] = (double)n1;
+
+  /* Put pointer, dimension and size */
+
+  WDB[loc0 + SCORE_PTR_NMAX] = (double)ptr;
+  WDB[loc0 + SCORE_DIM] = 2.0;
+  WDB[loc0 + SCORE_STAT_SIZE] = (double)ntot;
+
+  /* Allocate memory for data (one slab) */
+
+  ptr = ReallocMem(RES1_ARRAY, slab);
+  WDB[loc0 + SCORE_PTR_DATA] = (double)ptr;
+
+  /* Allocate memory for buffer (one slab) */
+
+  ptr = AllocPrivateData(slab*BUF_BLOCK_SIZE, BUF_ARRAY);
+  WDB[loc0 + SCORE_PTR_BUF] = (double)ptr;
+
+  /* Put slab size and index to gathered statistics */
+
+  WDB[loc0 + SCORE_DECOMP_SLAB] = (double)slab;
+  WDB[loc0 + SCORE_DECOMP_IDX] = (double)(dtally.n++);
+
+  fprintf(out, "Statistics %s: %ld bins decomposed in slabs of %ld bins\n",
+	  name, ntot, slab);
+
+  /* Return pointer */
+
+  return loc0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -30,7 +30,7 @@ extern "C" {
 
 void NewReaList(long mat, long mode)
 {
-  long loc0, loc1, iso, nuc, rea, idx, ures, mt, ty, mul, ptr;
+  long loc0, loc1, iso, nuc, rea, idx, ures, mt, ty, mul, ptr, n;
 
   /* Check material pointer */
 
@@ -54,6 +54,11 @@ void NewReaList(long mat, long mode)
   WDB[loc0 + RLS_PTR_MAT] = (double)mat;
   WDB[loc0 + RLS_REA_MODE] = (double)mode;
 
+  /* Reset packed data */
+
+  WDB[loc0 + RLS_PTR_PACK] = NULLPTR;
+  WDB[loc0 + RLS_PACK_OK] = (double)NO;
+
   /* Allocate memory for next pointer */
  
   AllocValuePair(loc0 + RLS_PTR_NEXT);
@@ -443,6 +448,24 @@ void NewReaList(long mat, long mode)
       /* Close list */
 
       CloseList(loc1);
+
+      /* Allocate memory for packed data (set in PackReactionList(), */
+      /* only for lists summed in PackedMacroXS()) */
+
+      if ((mode == MATERIAL_PTR_TOT_REA_LIST) ||
+	  (mode == MATERIAL_PTR_ELA_REA_LIST) ||
+	  (mode == MATERIAL_PTR_ABS_REA_LIST) ||
+	  (mode == MATERIAL_PTR_FISS_REA_LIST) ||
+	  (mode == MATERIAL_PTR_HEATT_REA_LIST) ||
+	  (mode == MATERIAL_PTR_INLP_REA_LIST))
+	{
+	  n = ListSize(loc1);
+
+	  ptr = ReallocMem(DATA_ARRAY, n*RLS_PACK_VARIABLES);
+
+	  WDB[loc0 + RLS_PTR_PACK] = (double)ptr;
+	  WDB[loc0 + RLS_PACK_NMAX] = (double)n;
+	}
     }
   else
     {
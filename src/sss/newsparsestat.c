@@ -0,0 +1,103 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : newsparsestat.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Creates two-dimensional statistical variable with sparse     */
+/*              scoring buffer                                               */
+/*                                                                           */
+/* Comments: - Called from ProcessDetectors() for detectors with "dsparse"   */
+/*             option, or with at least the number of bins given with "set   */
+/*             bufsparse". The BUF array is not used, scores are collected   */
+/*             in thread-private hash tables that hold only the touched bins */
+/*             (AddSparseBuf()). The tables are merged in ReduceBuffer() and */
+/*             CollectBuf(), after which BufVal() etc. read the merged       */
+/*             table. The RES1 block is allocated for all bins as usual, so  */
+/*             the output routines work without changes.                     */
+/*                                                                           */
+/*           - The tables are allocated at first score, so the memory is     */
+/*             proportional to the number of bins scored in one cycle.       */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "NewSparseStat:"
+
+/*****************************************************************************/
+
+long NewSparseStat(char *name, long n0, long n1)
+{
+  long loc0, ptr, ntot, nt;
+
+  /* Get total number of bins */
+
+  ntot = n0*n1;
+  CheckValue(FUNCTION_NAME, "ntot", "", ntot, 1, INFTY);
+
+  /* New item */
+
+  loc0 = NewItem(DATA_PTR_SCORE0, SCORE_BLOCK_SIZE);
+
+  /* Put name */
+
+  WDB[loc0 + SCORE_PTR_NAME] = (double)PutText(name);
+
+  /* Allocate memory for bin sizes and put values */
+
+  ptr = ReallocMem(DATA_ARRAY, 2);
+  WDB[ptr] = (double)n0;
+  WDB[ptr + 1] = (double)n1;
+
+  /* Put pointer, dimension and size */
+
+  WDB[loc0 + SCORE_PTR_NMAX] = (double)ptr;
+  WDB[loc0 + SCORE_DIM] = 2.0;
+  WDB[loc0 + SCORE_STAT_SIZE] = (double)ntot;
+
+  /* Allocate memory for data */
+
+  ptr = ReallocMem(RES1_ARRAY, ntot);
+  WDB[loc0 + SCORE_PTR_DATA] = (double)ptr;
+
+  /* No buffer */
+
+  WDB[loc0 + SCORE_PTR_BUF] = NULLPTR;
+
+  /* Get number of tables per statistics (threads) */
+
+  if ((nt = spbuf.nt) == 0)
+    {
+      nt = (long)RDB[DATA_OMP_MAX_THREADS];
+      CheckValue(FUNCTION_NAME, "nt", "", nt, 1, MAX_OMP_THREADS);
+
+      spbuf.nt = nt;
+    }
+
+  /* Allocate memory for (empty) tables */
+
+  spbuf.tab = (struct SparseTab *)
+    Mem(MEM_REALLOC, spbuf.tab, (spbuf.n + 1)*nt*sizeof(struct SparseTab));
+  memset(&spbuf.tab[spbuf.n*nt], 0, nt*sizeof(struct SparseTab));
+
+  /* Put flag and index */
+
+  WDB[loc0 + SCORE_SPARSE] = (double)YES;
+  WDB[loc0 + SCORE_SPARSE_IDX] = (double)(spbuf.n++);
+
+  /* Return pointer */
+
+  return loc0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,154 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : nextmattask.c                                  */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Returns next material to be processed by this thread in a    */
+/*              loop scheduled by ScheduleMatTasks()                         */
+/*                                                                           */
+/* Comments: - Tasks are taken from the head of the thread's own deque       */
+/*             (most expensive first). When it is empty, a task is stolen    */
+/*             from the tail of another deque. Returns -1 when all deques    */
+/*             are empty.                                                    */
+/*                                                                           */
+/*           - Each call finishes the previous task of the thread, adds its  */
+/*             wall-clock time to thread busy time and, in burnup loops,     */
+/*             stores it in the material for the next schedule.              */
+/*                                                                           */
+/*           - Material OpenMP id is set to the processing thread, as in     */
+/*             MyParallelMat().                                              */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "NextMatTask:"
+
+/*****************************************************************************/
+
+long NextMatTask(long id)
+{
+  long mat, nt, i;
+  double t;
+  struct MatTaskDeque *dq, *vic;
+#ifndef OPEN_MP
+  struct timeb tb;
+#endif
+
+  /* Check task list and thread id */
+
+  if (mattasks.mat == NULL)
+    Die(FUNCTION_NAME, "Task list not scheduled");
+
+  nt = mattasks.nt;
+  CheckValue(FUNCTION_NAME, "id", "", id, 0, nt - 1);
+
+  /* Pointer to own deque */
+
+  dq = &mattasks.dq[id];
+
+  /* Get current wall-clock time */
+
+#ifdef OPEN_MP
+  t = omp_get_wtime();
+#else
+  ftime(&tb);
+  t = (double)tb.time + (double)tb.millitm/1000.0;
+#endif
+
+  /***************************************************************************/
+
+  /***** Finish previous task ************************************************/
+
+  if ((mat = dq->cur) > VALID_PTR)
+    {
+      /* Add to busy time */
+
+      dq->busy = dq->busy + t - dq->t0;
+
+      /* Store cost of burnup task */
+
+      if ((mattasks.type == MAT_TASK_BURN) ||
+	  (mattasks.type == MAT_TASK_BURN_CI))
+	WDB[mat + MATERIAL_TASK_TIME] = t - dq->t0;
+
+      /* Reset pointer and time (batch of tasks is finished from here */
+      /* in FinishMatBatch()) */
+
+      dq->cur = -1;
+      dq->t0 = t;
+    }
+
+  /***************************************************************************/
+
+  /***** Get new task ********************************************************/
+
+  mat = -1;
+
+  /* Take from own deque */
+
+#ifdef OPEN_MP
+  omp_set_lock(&dq->lock);
+#endif
+
+  if (dq->head < dq->tail)
+    mat = mattasks.mat[dq->head++];
+
+#ifdef OPEN_MP
+  omp_unset_lock(&dq->lock);
+#endif
+
+  /* Steal from other deques */
+
+  for (i = 1; (mat < VALID_PTR) && (i < nt); i++)
+    {
+      /* Pointer to victim */
+
+      vic = &mattasks.dq[(id + i) % nt];
+
+#ifdef OPEN_MP
+      omp_set_lock(&vic->lock);
+#endif
+
+      if (vic->head < vic->tail)
+	{
+	  mat = mattasks.mat[--vic->tail];
+	  dq->nsteal++;
+	}
+
+#ifdef OPEN_MP
+      omp_unset_lock(&vic->lock);
+#endif
+    }
+
+  /* Check if all tasks are done */
+
+  if (mat < VALID_PTR)
+    return -1;
+
+  /* Put thread id */
+
+  WDB[mat + MATERIAL_OMP_ID] = (double)id;
+
+  /* Start task */
+
+  dq->cur = mat;
+  dq->t0 = t;
+  dq->ntask++;
+
+  /* Return pointer */
+
+  return mat;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,279 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : numericgaussbatch.c                            */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Solves a batch of systems (A[p] - theta[p]*I)x[p] = c[p]     */
+/*              that share the same sparsity pattern                         */
+/*                                                                           */
+/* Comments: - Same algorithm as NumericGauss() and GaussianSubst(), but     */
+/*             the row-wise elimination is done once for all systems. Batch  */
+/*             index is innermost in all arrays (c[j*np + p]), so the        */
+/*             pattern is traversed only once and the inner loops run over   */
+/*             contiguous data.                                              */
+/*                                                                           */
+/*           - Used for the CRAM poles of one or several materials in        */
+/*             MatrixExponentialBatch(). Arithmetic is written out in the    */
+/*             same order as in the complex number routines, so the results  */
+/*             equal those of NumericGauss().                                */
+/*                                                                           */
+/*           - Pattern is taken from cmat, its values are not used. Values   */
+/*             of the systems are given by the caller in the first nnz*np    */
+/*             entries of the work array (wrk[m*np + p]) and overwritten.    */
+/*             Right-hand side c is overwritten. Work array must be of size  */
+/*             (nnz + 3n + 1)*np.                                            */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "NumericGaussBatch:"
+
+/*****************************************************************************/
+
+long NumericGaussBatch(struct ccsMatrix *cmat, complex *c, complex *theta,
+		       long np, complex *x, complex *wrk)
+{
+  long n, nnz, i, j, k, l, m, s, p;
+  long *row, *col, *first, *next, *colind;
+  double nrm;
+  complex z, *vb, *array, *diag, *sum, *piv, *a, *v;
+
+  /***************************************************************************/
+
+  /***** Set pointers ********************************************************/
+
+  n = cmat->n;
+  nnz = cmat->nnz;
+
+  if (n != cmat->m)
+    Die(FUNCTION_NAME, "Matrix not square");
+
+  /* Check batch size */
+
+  CheckValue(FUNCTION_NAME, "np", "", np, 1, INFTY);
+
+  row = cmat->rowind;
+  col = cmat->colptr;
+  first = cmat->rowptr;
+  next = cmat->next;
+  colind = cmat->colind;
+
+  /* Split work array */
+
+  vb = wrk;
+  array = &vb[nnz*np];
+  diag = &array[n*np];
+  sum = &diag[n*np];
+  piv = &sum[n*np];
+
+#ifdef DEBUG
+
+  /* Check that values are real */
+
+  for (m = 0; m < nnz*np; m++)
+    {
+      CheckValue(FUNCTION_NAME, "vb.re", "", vb[m].re, -INFTY, INFTY);
+      CheckValue(FUNCTION_NAME, "vb.im", "", vb[m].im, 0.0, 0.0);
+    }
+
+#endif
+
+  /***************************************************************************/
+
+  /***** Elimination *********************************************************/
+
+  /* First row is not processed, put diagonal */
+
+  for (p = 0; p < np; p++)
+    {
+      if (row[0] != 0)
+	{
+	  diag[p].re = -theta[p].re;
+	  diag[p].im = -theta[p].im;
+	}
+      else
+	{
+	  diag[p].re = vb[p].re - theta[p].re;
+	  diag[p].im = vb[p].im - theta[p].im;
+	}
+    }
+
+  /* Zero diagonal elements */
+
+  for (k = 1; k < n; k++)
+    for (p = 0; p < np; p++)
+      {
+	diag[k*np + p].re = -theta[p].re;
+	diag[k*np + p].im = -theta[p].im;
+      }
+
+  /* Loop over rows */
+
+  for (k = 1; k < n; k++)
+    {
+      /* Copy row to work array and subtract theta from diagonal */
+
+      for (m = first[k]; m > 0; m = next[m])
+	{
+	  j = colind[m];
+
+	  if (row[m] != k)
+	    Die(FUNCTION_NAME, "Mismatch in row");
+
+	  v = &vb[m*np];
+	  a = &array[j*np];
+
+	  if (j == k)
+	    for (p = 0; p < np; p++)
+	      {
+		v[p].re = v[p].re - theta[p].re;
+		v[p].im = v[p].im - theta[p].im;
+
+		diag[j*np + p] = v[p];
+	      }
+
+	  for (p = 0; p < np; p++)
+	    a[p] = v[p];
+	}
+
+      /* Eliminate elements left of diagonal */
+
+      for (m = first[k]; m > 0; m = next[m])
+	{
+	  if ((j = colind[m]) >= k)
+	    continue;
+
+	  /* Pivots (A_kj / A_jj) and update of right-hand side */
+
+	  a = &array[j*np];
+	  v = &diag[j*np];
+
+	  for (p = 0; p < np; p++)
+	    {
+	      nrm = sqrt(v[p].re*v[p].re + v[p].im*v[p].im);
+	      nrm = nrm*nrm;
+
+	      piv[p].re = (a[p].re*v[p].re + a[p].im*v[p].im)/nrm;
+	      piv[p].im = (a[p].im*v[p].re - a[p].re*v[p].im)/nrm;
+
+	      z.re = piv[p].re*c[j*np + p].re - piv[p].im*c[j*np + p].im;
+	      z.im = piv[p].re*c[j*np + p].im + piv[p].im*c[j*np + p].re;
+
+	      c[k*np + p].re = c[k*np + p].re - z.re;
+	      c[k*np + p].im = c[k*np + p].im - z.im;
+	    }
+
+	  /* A_kl = A_kl - A_kj / A_jj * A_jl */
+
+	  for (s = first[j]; s > 0; s = next[s])
+	    if ((l = colind[s]) > j)
+	      {
+		v = &vb[s*np];
+		a = &array[l*np];
+
+		for (p = 0; p < np; p++)
+		  {
+		    z.re = v[p].re*piv[p].re - v[p].im*piv[p].im;
+		    z.im = v[p].re*piv[p].im + v[p].im*piv[p].re;
+
+		    a[p].re = a[p].re - z.re;
+		    a[p].im = a[p].im - z.im;
+		  }
+	      }
+	}
+
+      /* Copy updated values back to matrix */
+
+      for (m = first[k]; m > 0; m = next[m])
+	{
+	  j = colind[m];
+
+	  for (p = 0; p < np; p++)
+	    vb[m*np + p] = array[j*np + p];
+
+	  if (j == k)
+	    for (p = 0; p < np; p++)
+	      diag[j*np + p] = array[j*np + p];
+	}
+    }
+
+  /***************************************************************************/
+
+  /***** Back substitution ***************************************************/
+
+  /* Reset solution and sums */
+
+  memset(x, 0, n*np*sizeof(complex));
+  memset(sum, 0, n*np*sizeof(complex));
+
+  /* Loop over columns in reverse order */
+
+  for (j = n - 1; j >= 0; j--)
+    {
+      /* Check singular */
+
+      for (p = 0; p < np; p++)
+	if (!(sqrt(diag[j*np + p].re*diag[j*np + p].re +
+		   diag[j*np + p].im*diag[j*np + p].im) > 1.0E-20))
+	  {
+	    Warn(FUNCTION_NAME, "matrix singular\n");
+	    return -1;
+	  }
+
+      /* Solve */
+
+      a = &c[j*np];
+      v = &diag[j*np];
+
+      for (p = 0; p < np; p++)
+	{
+	  z.re = a[p].re - sum[j*np + p].re;
+	  z.im = a[p].im - sum[j*np + p].im;
+
+	  nrm = sqrt(v[p].re*v[p].re + v[p].im*v[p].im);
+	  nrm = nrm*nrm;
+
+	  x[j*np + p].re = (z.re*v[p].re + z.im*v[p].im)/nrm;
+	  x[j*np + p].im = (z.im*v[p].re - z.re*v[p].im)/nrm;
+	}
+
+      /* Add to sums of rows above */
+
+      for (k = col[j]; k < col[j + 1]; k++)
+	{
+	  if ((i = row[k]) < 0)
+	    break;
+
+	  if (j > i)
+	    {
+	      v = &vb[k*np];
+	      a = &x[j*np];
+
+	      for (p = 0; p < np; p++)
+		{
+		  sum[i*np + p].re = (v[p].re*a[p].re - v[p].im*a[p].im) +
+		    sum[i*np + p].re;
+		  sum[i*np + p].im = (v[p].re*a[p].im + v[p].im*a[p].re) +
+		    sum[i*np + p].im;
+		}
+	    }
+	}
+    }
+
+  /* Return OK */
+
+  return 0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
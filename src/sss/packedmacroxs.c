@@ -0,0 +1,183 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : packedmacroxs.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Sums material-wise cross section from packed reaction list   */
+/*                                                                           */
+/* Comments: - Replaces the NextReaction() / ReaMulti() / MicroXS() loop in  */
+/*             MacroXS() when macroscopic cross sections are not             */
+/*             reconstructed. The packed arrays are set in                   */
+/*             PackReactionList().                                           */
+/*                                                                           */
+/*           - Returns -INFTY if packed data cannot be used, the caller      */
+/*             then sums the partials from the list.                         */
+/*                                                                           */
+/*           - Microscopic cross sections are not stored in the reaction-    */
+/*             wise buffers.                                                 */
+/*                                                                           */
+/*           - Reactions are summed in blocks of PACKED_XS_BLOCK. Grid       */
+/*             search and energy cut-off are handled in a scalar loop that   */
+/*             collects the data indexes and weights of the block, the sum   */
+/*             is a branch-free gather loop vectorized with omp simd. The    */
+/*             instruction set is selected at compile time, there are no     */
+/*             intrinsics or runtime dispatch.                               */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "PackedMacroXS:"
+
+/*****************************************************************************/
+
+double PackedMacroXS(long lst, long mt, double E, long id)
+{
+  long pack, nmax, n, k, m, j, i, ptr, ne, p0[PACKED_XS_BLOCK];
+  long p1[PACKED_XS_BLOCK];
+  double xs, f, sub, c[PACKED_XS_BLOCK], fac[PACKED_XS_BLOCK];
+  double msk[PACKED_XS_BLOCK];
+  const double *adens, *erg, *dat, *i0, *nep, *wgt, *Emin;
+
+  /* Check list pointer */
+
+  CheckPointer(FUNCTION_NAME, "(lst)", DATA_ARRAY, lst);
+
+  /* Check flag */
+
+  if ((long)RDB[lst + RLS_PACK_OK] == NO)
+    return -INFTY;
+
+  /* Check reaction type (multiplier is energy-dependent for nsf and */
+  /* nuclide-dependent for fission energy) */
+
+  if ((mt == MT_MACRO_TOTXS) || (mt == MT_MACRO_ABSXS) ||
+      (mt == MT_MACRO_ELAXS) || (mt == MT_MACRO_FISSXS) ||
+      (mt == MT_MACRO_HEATXS))
+    sub = 0.0;
+  else if (mt == MT_MACRO_INLPRODXS)
+    sub = 1.0;
+  else
+    return -INFTY;
+
+  /* Get pointer to packed data and sizes */
+
+  pack = (long)RDB[lst + RLS_PTR_PACK];
+  CheckPointer(FUNCTION_NAME, "(pack)", DATA_ARRAY, pack);
+
+  nmax = (long)RDB[lst + RLS_PACK_NMAX];
+  n = (long)RDB[lst + RLS_PACK_N];
+
+  /* Pointers to arrays */
+
+  adens = &RDB[pack + RLS_PACK_PTR_ADENS*nmax];
+  erg = &RDB[pack + RLS_PACK_PTR_EGRID*nmax];
+  dat = &RDB[pack + RLS_PACK_PTR_XS*nmax];
+  i0 = &RDB[pack + RLS_PACK_XS_I0*nmax];
+  nep = &RDB[pack + RLS_PACK_XS_NE*nmax];
+  wgt = &RDB[pack + RLS_PACK_WGT_F*nmax];
+  Emin = &RDB[pack + RLS_PACK_EMIN*nmax];
+
+  /* Reset cross section */
+
+  xs = 0.0;
+
+  /* Loop over blocks */
+
+  k = 0;
+
+  while (k < n)
+    {
+      /***********************************************************************/
+
+      /***** Collect indexes and weights (scalar) ****************************/
+
+      for (m = 0; (m < PACKED_XS_BLOCK) && (k < n); m++)
+	{
+	  /* Reset weight (points outside the grid add zero) */
+
+	  c[m] = 0.0;
+	  fac[m] = 0.0;
+	  msk[m] = 0.0;
+	  p0[m] = (long)dat[k];
+	  p1[m] = p0[m];
+
+	  /* Get interpolation factor (reactions of the same nuclide share */
+	  /* the grid, and the factor is buffered in GridFactor()) */
+
+	  if ((f = GridFactor((long)erg[k], E, id)) >= 0.0)
+	    {
+	      /* Separate integer and decimal parts of interpolation factor */
+
+	      i = (long)f;
+	      f = f - (double)i;
+
+	      /* Get relative index and number of points */
+
+	      i = i - (long)i0[k];
+	      ne = (long)nep[k];
+
+	      /* Check boundaries */
+
+	      if ((i > -1) && (i < ne))
+		{
+		  /* Pointers to tabulated cross sections (last point is */
+		  /* interpolated to zero) */
+
+		  ptr = (long)dat[k] + i;
+
+		  p0[m] = ptr;
+
+		  if (i < ne - 1)
+		    {
+		      p1[m] = ptr + 1;
+		      msk[m] = 1.0;
+		    }
+		  else
+		    p1[m] = ptr;
+
+		  /* Put factor and weight */
+
+		  fac[m] = f;
+		  c[m] = (wgt[k] - sub)*RDB[(long)adens[k]];
+		}
+	    }
+
+	  /* Check energy cut-off (stops after this reaction) */
+
+	  if (E < Emin[k])
+	    n = k + 1;
+
+	  /* Next reaction */
+
+	  k++;
+	}
+
+      /***********************************************************************/
+
+      /***** Sum block (vectorized) ******************************************/
+
+#pragma omp simd reduction(+:xs)
+      for (j = 0; j < m; j++)
+	xs = xs + c[j]*(fac[j]*(msk[j]*RDB[p1[j]] - RDB[p0[j]]) +
+			RDB[p0[j]]);
+
+      /***********************************************************************/
+    }
+
+  /* Return value */
+
+  return xs;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,134 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : packreactionlist.c                             */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Copies the data needed for summing material-wise cross       */
+/*              sections from reaction list into contiguous arrays           */
+/*                                                                           */
+/* Comments: - Called from ProcessReactionLists() after sorting and cut-offs */
+/*             so the packed data follows the order used by NextReaction().  */
+/*                                                                           */
+/*           - Packed data is used by PackedMacroXS() only if none of the    */
+/*             reactions has ures or cache-optimized data.                   */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "PackReactionList:"
+
+/*****************************************************************************/
+
+void PackReactionList(long loc0)
+{
+  long mat, iso, loc1, rea, ptr, pack, nmax, n, ok;
+
+  /* Check list pointer */
+
+  CheckPointer(FUNCTION_NAME, "(loc0)", DATA_ARRAY, loc0);
+
+  /* Reset count and flag */
+
+  WDB[loc0 + RLS_PACK_N] = 0.0;
+  WDB[loc0 + RLS_PACK_OK] = (double)NO;
+
+  /* Get pointer to packed data and maximum size */
+
+  if ((pack = (long)RDB[loc0 + RLS_PTR_PACK]) < VALID_PTR)
+    return;
+
+  nmax = (long)RDB[loc0 + RLS_PACK_NMAX];
+
+  /* Pointer to material */
+
+  mat = (long)RDB[loc0 + RLS_PTR_MAT];
+  CheckPointer(FUNCTION_NAME, "(mat)", DATA_ARRAY, mat);
+
+  /* Pointer to composition */
+
+  iso = (long)RDB[mat + MATERIAL_PTR_COMP];
+  CheckPointer(FUNCTION_NAME, "(iso)", DATA_ARRAY, iso);
+
+  /* Reset count and flag */
+
+  n = 0;
+  ok = YES;
+
+  /* Loop over reactions until cut-off (same as NextReaction()) */
+
+  loc1 = (long)RDB[loc0 + RLS_PTR_REA0];
+  while (loc1 > VALID_PTR)
+    {
+      /* Check cut-off */
+
+      if ((long)RDB[loc1 + RLS_DATA_CUT] == YES)
+	break;
+
+      /* Check size (lists of divided materials are linked to parent) */
+
+      if (n == nmax)
+	return;
+
+      /* Pointer to reaction */
+
+      rea = (long)RDB[loc1 + RLS_DATA_PTR_REA];
+      CheckPointer(FUNCTION_NAME, "(rea)", DATA_ARRAY, rea);
+
+      /* Check ures, cache-optimized and missing data */
+
+      if ((long)RDB[rea + REACTION_PTR_URES] > VALID_PTR)
+	ok = NO;
+      else if ((long)RDB[rea + REACTION_CACHE_OPTI_IDX] > -1)
+	ok = NO;
+      else if ((long)RDB[rea + REACTION_PTR_EGRID] < VALID_PTR)
+	ok = NO;
+      else if ((long)RDB[rea + REACTION_PTR_XS] < VALID_PTR)
+	ok = NO;
+
+      /* Put pointer to atomic density */
+
+      ptr = ListPtr(iso, (long)RDB[loc1 + RLS_DATA_COMP_IDX]);
+      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+      WDB[pack + RLS_PACK_PTR_ADENS*nmax + n] =
+	(double)(ptr + COMPOSITION_ADENS);
+
+      /* Put grid and cross section data */
+
+      WDB[pack + RLS_PACK_PTR_EGRID*nmax + n] = RDB[rea + REACTION_PTR_EGRID];
+      WDB[pack + RLS_PACK_PTR_XS*nmax + n] = RDB[rea + REACTION_PTR_XS];
+      WDB[pack + RLS_PACK_XS_I0*nmax + n] = RDB[rea + REACTION_XS_I0];
+      WDB[pack + RLS_PACK_XS_NE*nmax + n] = RDB[rea + REACTION_XS_NE];
+
+      /* Put multiplier and minimum energy */
+
+      WDB[pack + RLS_PACK_WGT_F*nmax + n] = RDB[rea + REACTION_WGT_F];
+      WDB[pack + RLS_PACK_EMIN*nmax + n] = RDB[loc1 + RLS_DATA_EMIN];
+
+      /* Update count */
+
+      n++;
+
+      /* Next */
+
+      loc1 = NextItem(loc1);
+    }
+
+  /* Put count and flag */
+
+  WDB[loc0 + RLS_PACK_N] = (double)n;
+  WDB[loc0 + RLS_PACK_OK] = (double)ok;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
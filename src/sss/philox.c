@@ -0,0 +1,98 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : philox.c                                       */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Counter-based random number generator, returns a uniformly   */
+/*              distributed random number on the unit interval for given     */
+/*              counter value.                                               */
+/*                                                                           */
+/* Comments: - Philox-2x64-10 with the parent seed as key [1]. The number    */
+/*             depends only on the seed and the counter, so there is no      */
+/*             state to advance and the skip-ahead in ReInitRNG() is a       */
+/*             single shift.                                                 */
+/*                                                                           */
+/*           - The 128-bit product is calculated from 32-bit halves to keep  */
+/*             the routine portable.                                         */
+/*                                                                           */
+/*           [1] J.K. Salmon et al., Parallel Random Numbers: As Easy as     */
+/*               1, 2, 3, Proc. SC11 (2011).                                 */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "Philox:"
+
+/* Multiplier and Weyl increment of key */
+
+#define PHILOX_M 0xD2B74407B1D9A5B7UL
+#define PHILOX_W 0x9E3779B97F4A7C15UL
+
+/* Number of rounds */
+
+#define PHILOX_ROUNDS 10
+
+/*****************************************************************************/
+
+double Philox(unsigned long ctr)
+{
+  unsigned long x0, x1, k, a0, a1, b0, b1, p00, p01, p10, p11, mid, hi, lo;
+  long n;
+
+  /* Put counter and key */
+
+  x0 = ctr;
+  x1 = 0;
+  k = parent_seed;
+
+  /* Split multiplier */
+
+  b0 = PHILOX_M & 0xFFFFFFFFUL;
+  b1 = PHILOX_M >> 32;
+
+  /* Loop over rounds */
+
+  for (n = 0; n < PHILOX_ROUNDS; n++)
+    {
+      /* Calculate 128-bit product of x0 and multiplier */
+
+      a0 = x0 & 0xFFFFFFFFUL;
+      a1 = x0 >> 32;
+
+      p00 = a0*b0;
+      p01 = a0*b1;
+      p10 = a1*b0;
+      p11 = a1*b1;
+
+      mid = (p00 >> 32) + (p01 & 0xFFFFFFFFUL) + (p10 & 0xFFFFFFFFUL);
+
+      hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+      lo = x0*PHILOX_M;
+
+      /* Round function */
+
+      x0 = hi^k^x1;
+      x1 = lo;
+
+      /* Bump key */
+
+      k = k + PHILOX_W;
+    }
+
+  /* Conversion to floating point number in interval [0,1) */
+
+  return (double)(x0 >> 12)/0x0010000000000000;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -6,7 +6,7 @@ extern "C" {
 /* serpent 2 (beta-version) : printinterfaceoutput.c                         */
 /*                                                                           */
 /* Created:       2012/02/15 (JLe)                                           */
-/* Last modified: 2016/04/21 (VVa)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
 /* Version:       2.1.26                                                     */
 /*                                                                           */
 /* Description: Prints output for multi-physics interface                    */
@@ -14,6 +14,8 @@ extern "C" {
 /* Comments:    -2014/03/13 Added angular and time dependence for fuel perf. */
 /*               interface                                                   */
 /*              -TODO: relaxation for fast flux                              */
+/*              -In-memory MOOSE interface writes power to mooseifc.pwr      */
+/*               instead of a file (LMK)                                     */
 /*                                                                           */
 /*****************************************************************************/
 
@@ -66,6 +68,62 @@ void PrintInterfaceOutput()
 
       /***********************************************************************/
 
+      /***** In-memory MOOSE interface ***************************************/
+
+      if ((long)RDB[loc0 + IFC_IN_MEMORY] == YES)
+	{
+	  /* Get pointer to statistics */
+
+	  if(RDB[DATA_RUN_CC] == YES)
+	    ptr = (long)RDB[loc0 + IFC_PTR_STAT_REL];
+	  else
+	    ptr = (long)RDB[loc0 + IFC_PTR_STAT];
+
+	  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+	  /* Get pointer to cells */
+	  
+	  if((loc1 = (long)RDB[loc0 + IFC_PTR_TET_MSH_PRNTS]) < VALID_PTR)
+	    loc1 = (long)RDB[loc0 + IFC_PTR_TET_MSH];
+
+	  CheckPointer(FUNCTION_NAME, "(loc1)", DATA_ARRAY, loc1);
+
+	  /* Loop over cells and copy power to shared array */
+
+	  while (loc1 > VALID_PTR)
+	    {
+	      /* Check stat index */
+
+	      if ((i = (long)RDB[loc1 + IFC_TET_MSH_STAT_IDX]) > -1)
+		{
+		  /* Check index */
+
+		  CheckValue(FUNCTION_NAME, "i", "", i, 0, mooseifc.nc - 1);
+
+		  /* Put value (same as in the m-file output) */
+
+		  if(RDB[DATA_RUN_CC] == NO)
+		    mooseifc.pwr[i] = Mean(ptr, i);
+		  else
+		    mooseifc.pwr[i] = RDB[ptr + i];
+		}
+
+	      /* Next cell */
+
+	      loc1 = NextItem(loc1);
+	    }
+
+	  /* Pointer to next */
+
+	  loc0 = NextItem(loc0);
+
+	  /* Cycle loop, no file is written */
+
+	  continue;
+	}
+
+      /***********************************************************************/
+
       /***** Parse output file name ******************************************/
 
       /* Get file name */
@@ -30,6 +30,7 @@ void ProcessDetectors()
   long det, ene, ptr, mat, uni, lat, cell, surf, tme, tot, n1, n2, msh1, msh2;
   long ebins, ubins, cbins, mbins, lbins, rbins, zbins, ybins, xbins, tbins;
   long mt, ne, n, loc0, loc1, loc2, umsh, sflag, idx, i0, phd, m1, m2, fun;
+  long det1, dflag, lnk, nmin;
   double sum;
   char str[MAX_STR];
 
@@ -957,9 +958,74 @@ void ProcessDetectors()
 
       if ((long)RDB[det + DET_PTR_ADJOINT] < VALID_PTR)
 	{
-	  /* Allocate memory */
+	  /* Bins can be decomposed between MPI tasks unless detector is */
+	  /* cumulative, writes history, uses sparse buffer or is used by */
+	  /* other detectors */
+
+	  if (((long)RDB[det + DET_TYPE] == DETECTOR_TYPE_CUMU) ||
+	      ((long)RDB[det + DET_WRITE_HIS] == 1) ||
+	      ((long)RDB[det + DET_SPARSE] == YES))
+	    dflag = NO;
+	  else
+	    {
+	      dflag = YES;
+
+	      /* Loop over detectors (multiplier pointers are linked up to */
+	      /* current detector and point to name after that) */
+
+	      lnk = YES;
+
+	      det1 = (long)RDB[DATA_PTR_DET0];
+	      while (det1 > VALID_PTR)
+		{
+		  /* Compare */
+
+		  if ((long)RDB[det1 + DET_PTR_MUL] > VALID_PTR)
+		    {
+		      if ((lnk == YES) && 
+			  ((long)RDB[det1 + DET_PTR_MUL] == det))
+			dflag = NO;
+		      else if ((lnk == NO) &&
+			       (!strcmp(GetText(det1 + DET_PTR_MUL),
+					GetText(det + DET_PTR_NAME))))
+			dflag = NO;
+		    }
+
+		  /* Check current */
+
+		  if (det1 == det)
+		    lnk = NO;
+
+		  /* Next */
+
+		  det1 = NextItem(det1);
+		}
+	    }
+
+	  /* Large detectors that are not decomposed are scored in */
+	  /* thread-private sparse tables ("set bufsparse") */
+
+	  nmin = (long)RDB[DATA_OPTI_SPARSE_TALLY_MIN];
+
+	  if ((dflag == YES) && (nmin > 0) && (tot*rbins >= nmin) &&
+	      ((mpitasks < 2) || ((long)RDB[DATA_OPTI_DECOMP_TALLY_MIN] < 1) ||
+	       (tot*rbins < (long)RDB[DATA_OPTI_DECOMP_TALLY_MIN])))
+	    {
+	      /* Set flag */
+
+	      WDB[det + DET_SPARSE] = (double)YES;
+	      dflag = NO;
+	    }
+
+	  /* Allocate memory (only detectors are decomposed between MPI */
+	  /* tasks, see NewDecompStat()) */
 	  
-	  ptr = NewStat(str, 2, tot, rbins);
+	  if ((long)RDB[det + DET_SPARSE] == YES)
+	    ptr = NewSparseStat(str, tot, rbins);
+	  else if (dflag == YES)
+	    ptr = NewDecompStat(str, tot, rbins);
+	  else
+	    ptr = NewStat(str, 2, tot, rbins);
 	
 	  /* Put pointer */
 	  
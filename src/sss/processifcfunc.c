@@ -183,21 +183,14 @@ void ProcessIFCFunc(long loc0, long update)
 		  
       if (RDB[loc0 + IFC_MAX_TEMP] > 0.0)
 	{
-	  /* Check maximum temperature */
+	  /* Widen limits if needed (majorants are updated in */
+	  /* UpdateTmpMajorants()) */
 		      
-	  if (RDB[loc0 + IFC_MAX_TEMP] > 
-	      RDB[mat + MATERIAL_TMS_TMAX])
-		Die(FUNCTION_NAME,
-		    "Material temperature above TMS majorant for material %s",
-		    GetText(mat + MATERIAL_PTR_NAME));
+	  if (RDB[loc0 + IFC_MAX_TEMP] > RDB[mat + MATERIAL_TMS_TMAX])
+	    WDB[mat + MATERIAL_TMS_TMAX] = RDB[loc0 + IFC_MAX_TEMP];
 
-	  /* Checkminimum temperature */
-		      
-	  if (RDB[loc0 + IFC_MIN_TEMP] < 
-	      RDB[mat + MATERIAL_TMS_TMIN])
-	    Die(FUNCTION_NAME,
-		"Material temperature below TMS minorant for material %s",
-		GetText(mat + MATERIAL_PTR_NAME));	   
+	  if (RDB[loc0 + IFC_MIN_TEMP] < RDB[mat + MATERIAL_TMS_TMIN])
+	    WDB[mat + MATERIAL_TMS_TMIN] = RDB[loc0 + IFC_MIN_TEMP];
 
 	}
 
@@ -25,9 +25,8 @@ extern "C" {
 
 void ProcessIFCPtAvg(long loc0, long update)
 {
-  long loc1, mat0, mat, ptr, found, msh, dim, nx, ny, nz, override;
-  double x, y, z, rad, xmin, xmax, ymin, ymax, zmin, zmax, dmax;
-  double lims[6], matdens;
+  long loc1, mat0, mat, ptr, found, override;
+  double dmax, matdens;
 
   /***********************************************************************/
 
@@ -186,21 +185,14 @@ void ProcessIFCPtAvg(long loc0, long update)
 		  
       if (RDB[loc0 + IFC_MAX_TEMP] > 0.0)
 	{
-	  /* Check maximum temperature */
+	  /* Widen limits if needed (majorants are updated in */
+	  /* UpdateTmpMajorants()) */
 		      
-	  if (RDB[loc0 + IFC_MAX_TEMP] > 
-	      RDB[mat + MATERIAL_TMS_TMAX])
-		Die(FUNCTION_NAME,
-		    "Material temperature above TMS majorant for material %s",
-		    GetText(mat + MATERIAL_PTR_NAME));
+	  if (RDB[loc0 + IFC_MAX_TEMP] > RDB[mat + MATERIAL_TMS_TMAX])
+	    WDB[mat + MATERIAL_TMS_TMAX] = RDB[loc0 + IFC_MAX_TEMP];
 
-	  /* Checkminimum temperature */
-		      
-	  if (RDB[loc0 + IFC_MIN_TEMP] < 
-	      RDB[mat + MATERIAL_TMS_TMIN])
-	    Die(FUNCTION_NAME,
-		"Material temperature below TMS minorant for material %s",
-		GetText(mat + MATERIAL_PTR_NAME));	   
+	  if (RDB[loc0 + IFC_MIN_TEMP] < RDB[mat + MATERIAL_TMS_TMIN])
+	    WDB[mat + MATERIAL_TMS_TMIN] = RDB[loc0 + IFC_MIN_TEMP];
 
 	}
 
@@ -305,107 +297,6 @@ void ProcessIFCPtAvg(long loc0, long update)
 
   /***********************************************************************/
 
-  /*******************************************************************/
-
-  /***** Average of points *******************************************/
-
-  if(!update)
-    {
-      /* Get limits */
-
-      xmin = RDB[loc0 + IFC_MESH_XMIN];
-      xmax = RDB[loc0 + IFC_MESH_XMAX];
-      ymin = RDB[loc0 + IFC_MESH_YMIN];
-      ymax = RDB[loc0 + IFC_MESH_YMAX];
-      zmin = RDB[loc0 + IFC_MESH_ZMIN];
-      zmax = RDB[loc0 + IFC_MESH_ZMAX];
-
-      /* Get exclusion radius and dimension */
-
-      rad = RDB[loc0 + IFC_EXCL_RAD];
-      dim = (long)RDB[loc0 + IFC_DIM];
-
-      /* Calculate search mesh size */
-
-      if ((nx = (long)(xmax - xmin)/(2.0*rad)) < 1)
-	nx = 1;
-
-      if ((ny = (long)(ymax - ymin)/(2.0*rad)) < 1)
-	ny = 1;
-
-      if ((nz = (long)(zmax - zmin)/(2.0*rad)) < 1)
-	nz = 1;
-	  
-      /* Adjust boundaries */
-      
-      xmin = xmin - 1E-6;
-      xmax = xmax + 1E-6;
-      ymin = ymin - 1E-6;
-      ymax = ymax + 1E-6;
-      zmin = zmin - 1E-6;
-      zmax = zmax + 1E-6;
-	  
-      /* 1D and 2D distributions */
-      
-      if (dim == 1)
-	{
-	  xmin = -INFTY;
-	  xmax = INFTY;
-	  nx = 1;
-	      
-	  ymin = -INFTY;
-	  ymax = INFTY;
-	  ny = 1;
-	}
-      else if (dim == 2)
-	{
-	  zmin = -INFTY;
-	  zmax = INFTY;
-	  nz = 1;
-	}
-
-      /* Put mesh variables */
-
-      lims[0] = xmin;
-      lims[1] = xmax;
-      lims[2] = ymin;
-      lims[3] = ymax;
-      lims[4] = zmin;
-      lims[5] = zmax;
-	  
-      /* Create mesh structure */
-      
-      msh = CreateMesh(MESH_TYPE_CARTESIAN, MESH_CONTENT_PTR, -1,
-		       50, 50, 50, lims, -1);
-	  
-      /* Put pointer */
-      
-      WDB[loc0 + IFC_PTR_SEARCH_MESH] = (double)msh;
-
-      /* Loop over points */
-	  
-      loc1 = (long)RDB[loc0 + IFC_PTR_POINTS];
-      while (loc1 > VALID_PTR)
-	{
-	  /* Get coordinates */
-	      
-	  x = RDB[loc1 + IFC_PT_X];
-	  y = RDB[loc1 + IFC_PT_Y];
-	  z = RDB[loc1 + IFC_PT_Z];
-	      
-	  /* Add point in search mesh */
-	      
-	  AddSearchMesh(msh, loc1, x - rad, x + rad, y - rad, y + rad, 
-			z - rad, z + rad);	 
-     
-	  /* Next point */
-
-	  loc1 = NextItem(loc1);
-	}	  
-
-
-    }
-
   /* Loop over points to set density factors */
 
   loc1 = (long)RDB[loc0 + IFC_PTR_POINTS];
@@ -423,6 +314,22 @@ void ProcessIFCPtAvg(long loc0, long update)
       loc1 = NextItem(loc1);
     }	  
 
+  /*******************************************************************/
+
+  /***** Spatial index and interpolation lattice *********************/
+
+  /* Build k-d tree (also in updates, since coordinates are re-read) */
+
+  BuildIFCPtKDTree(loc0);
+
+  /* Tabulate values on interpolation lattice */
+
+  BuildIFCPtLattice(loc0);
+
+  if ((ptr = (long)RDB[loc0 + IFC_PTR_LATTICE]) > VALID_PTR)
+    fprintf(out, " - Interpolation lattice: %ld x %ld x %ld points\n",
+	    (long)RDB[ptr + IFC_LAT_NX], (long)RDB[ptr + IFC_LAT_NY],
+	    (long)RDB[ptr + IFC_LAT_NZ]);
 	  
   /********************************************************************/
 }
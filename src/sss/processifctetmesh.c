@@ -289,29 +289,16 @@ void ProcessIFCTetMesh(long loc0, long update)
 
       T = RDB[loc1 + IFC_TET_MSH_TMP];
 
-      /* Compare to material maximum and minimum */
+      /* Compare to material maximum and minimum (in updates the */
+      /* majorants are adjusted in UpdateTmpMajorants()) */
 
       if (T > RDB[mat + MATERIAL_TMS_TMAX])
-	{
-	  if(!update)
-	    WDB[mat + MATERIAL_TMS_TMAX] = T;
-	  else
-	    Die(FUNCTION_NAME,
-		"Material temperature above TMS majorant for material %s",
-		GetText(mat + MATERIAL_PTR_NAME));
-	}
+	WDB[mat + MATERIAL_TMS_TMAX] = T;
 
       /* Put minimum temperature */
 		      
       if (T < RDB[mat + MATERIAL_TMS_TMIN])
-	{
-	  if(!update)
-	    WDB[mat + MATERIAL_TMS_TMIN] = T;
-	  else
-	    Die(FUNCTION_NAME,
-		"Material temperature below TMS minorant for material %s",
-		GetText(mat + MATERIAL_PTR_NAME));
-	}
+	WDB[mat + MATERIAL_TMS_TMIN] = T;
 		      
       loc1 = NextItem(loc1);
     }
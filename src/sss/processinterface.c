@@ -165,6 +165,11 @@ void ProcessInterface(long update)
 
   fprintf(out, "OK.\n\n");
 
+  /* Update majorants if temperature limits were widened */
+
+  if (update == YES)
+    UpdateTmpMajorants();
+
   /***************************************************************************/
 }
 
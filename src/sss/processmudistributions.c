@@ -26,7 +26,7 @@ void ProcessMuDistributions(long rea)
 {
   long L, L0, INTT, NE, NP, mt, n, i, j, l0, l1, type, erg, ang, ace, JXS[32];
   long ptr, nuc, count;
-  double mu, P, *XSS;
+  double mu, P, *XSS, *E;
 
   /* Check reaction pointer */
 
@@ -107,15 +107,21 @@ void ProcessMuDistributions(long rea)
     if ((XSS[L + n] < 1E-12) || (XSS[L + n]) > 1000.0)
       Warn(FUNCTION_NAME, "Invalid energy value %E\n", XSS[L + n]);
 
+  /* Copy energies (ACE data may be shared by MPI tasks, so it is not */
+  /* modified here) */
+
+  E = (double *)Mem(MEM_ALLOC, NE, sizeof(double));
+  memcpy(E, &XSS[L], NE*sizeof(double));
+
   /* Check order and calculate number of coincident points */
 
   count = 0;
   for (n = 0; n < NE - 1; n++)
     {
-      if (XSS[L + n] > XSS[L + n + 1])
+      if (E[n] > E[n + 1])
 	Die(FUNCTION_NAME, "Energy values are not in ascedning order: %E %E",
-	    XSS[L + n], XSS[L + n + 1]);
-      else if (XSS[L + n] == XSS[L + n + 1])
+	    E[n], E[n + 1]);
+      else if (E[n] == E[n + 1])
 	{
 	  /* Add to count */
 	  
@@ -127,19 +133,19 @@ void ProcessMuDistributions(long rea)
 	  /* on korjattu jossain vaiheessa niin oletetaan että sillä   */
 	  /* on joku vaikutus johonkin -- JLE / 2.1.22 / 22.10.2014).  */
 	  
-	  XSS[L + n] = XSS[L + n] - ((double)(NE - n))*1E-11/((double)NE);
+	  E[n] = E[n] - ((double)(NE - n))*1E-11/((double)NE);
 
-	  if (XSS[L + n] < 0.0)
-	    XSS[L + n] = 0.0;
+	  if (E[n] < 0.0)
+	    E[n] = 0.0;
 	}
     }
   
   /* Check again */
 
   for (n = 0; n < NE - 1; n++)
-    if (XSS[L + n] >= XSS[L + n + 1])
+    if (E[n] >= E[n + 1])
       Warn(FUNCTION_NAME, "Energy values are not in ascedning order: %E %E",
-	   XSS[L + n], XSS[L + n + 1]);
+	   E[n], E[n + 1]);
 
   /* Check number of coincident points */
 
@@ -152,7 +158,11 @@ void ProcessMuDistributions(long rea)
 
   /* Make energy grid */
 
-  erg = MakeEnergyGrid(NE, 0, 0, -1, &XSS[L], EG_INTERP_MODE_LIN);
+  erg = MakeEnergyGrid(NE, 0, 0, -1, E, EG_INTERP_MODE_LIN);
+
+  /* Free temporary array */
+
+  Mem(MEM_FREE, E);
 
   /* Allocate memory for distribution */
 
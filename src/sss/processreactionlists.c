@@ -904,6 +904,51 @@ void ProcessReactionLists()
     }
 
   /***************************************************************************/
+
+  /***** Pack lists for summing macroscopic cross sections *******************/
+
+  /* Avoid compiler warning */
+
+  mode = -1;
+
+  /* Loop over materials */
+
+  mat = (long)RDB[DATA_PTR_M0];
+  while (mat > VALID_PTR)
+    {
+      /* Loop over lists (only those summed in PackedMacroXS()) */
+
+      for (n = 0; n < 6; n++)
+	{
+	  /* Get mode */
+
+	  if (n == 0)
+	    mode = MATERIAL_PTR_TOT_REA_LIST;
+	  else if (n == 1)
+	    mode = MATERIAL_PTR_ELA_REA_LIST;
+	  else if (n == 2)
+	    mode = MATERIAL_PTR_ABS_REA_LIST;
+	  else if (n == 3)
+	    mode = MATERIAL_PTR_FISS_REA_LIST;
+	  else if (n == 4)
+	    mode = MATERIAL_PTR_HEATT_REA_LIST;
+	  else if (n == 5)
+	    mode = MATERIAL_PTR_INLP_REA_LIST;
+	  else
+	    Die(FUNCTION_NAME, "Overflow");
+
+	  /* Pack list */
+
+	  if ((loc0 = (long)RDB[mat + mode]) > VALID_PTR)
+	    PackReactionList(loc0);
+	}
+
+      /* Next material */
+
+      mat = NextItem(mat);
+    }
+
+  /***************************************************************************/
 }
 
 /*****************************************************************************/
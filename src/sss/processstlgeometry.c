@@ -29,7 +29,7 @@ extern "C" {
 
 void ProcessSTLGeometry()
 {
-  long loc0, loc1, nf, ptr, pts, n, msh, sld, cell;
+  long loc0, loc1, nf, ptr, pts, n, msh, sld, cell, *fct;
   double x1, y1, z1, x2, y2, z2, x3, y3, z3, l, xmin, xmax, ymin, ymax;
   double zmin, zmax, dx, dy, dz, lims[6], mem, V;
 
@@ -482,6 +482,30 @@ void ProcessSTLGeometry()
 
 	  AddSearchMesh(msh, loc1, xmin, xmax, ymin, ymax, zmin, zmax);
 
+	  /* Build bounding volume hierarchy for ray tests */
+
+	  if (((long)RDB[DATA_STL_BVH] == YES) && (nf > 0))
+	    {
+	      /* Allocate memory for facet pointers */
+
+	      fct = (long *)Mem(MEM_ALLOC, nf, sizeof(long));
+
+	      /* Put pointers */
+
+	      ptr = (long)RDB[loc1 + STL_SOLID_PTR_FACETS];
+	      for (n = 0; n < nf; n++)
+		fct[n] = ptr + n*STL_FACET_BLOCK_SIZE;
+
+	      /* Build hierarchy */
+
+	      ptr = BuildSTLBVH(fct, nf);
+	      WDB[loc1 + STL_SOLID_PTR_BVH] = (double)ptr;
+
+	      /* Free memory */
+
+	      Mem(MEM_FREE, fct);
+	    }
+
 	  /*******************************************************************/
 
 	  /***** Put facets to search mesh ***********************************/
@@ -608,6 +632,58 @@ void ProcessSTLGeometry()
 	  loc1 = NextItem(loc1);
 	}
 
+      /***********************************************************************/
+
+      /***** Bounding volume hierarchy for all facets ************************/
+
+      if ((long)RDB[DATA_STL_BVH] == YES)
+	{
+	  /* Get total number of facets */
+
+	  nf = 0;
+
+	  loc1 = (long)RDB[loc0 + STL_PTR_SOLIDS];
+	  while (loc1 > VALID_PTR)
+	    {
+	      nf = nf + (long)RDB[loc1 + STL_SOLID_N_FACETS];
+	      loc1 = NextItem(loc1);
+	    }
+
+	  /* Check count */
+
+	  if (nf > 0)
+	    {
+	      /* Allocate memory for facet pointers */
+
+	      fct = (long *)Mem(MEM_ALLOC, nf, sizeof(long));
+
+	      /* Loop over solids and put pointers */
+
+	      nf = 0;
+
+	      loc1 = (long)RDB[loc0 + STL_PTR_SOLIDS];
+	      while (loc1 > VALID_PTR)
+		{
+		  ptr = (long)RDB[loc1 + STL_SOLID_PTR_FACETS];
+		  for (n = 0; n < (long)RDB[loc1 + STL_SOLID_N_FACETS]; n++)
+		    fct[nf++] = ptr + n*STL_FACET_BLOCK_SIZE;
+
+		  loc1 = NextItem(loc1);
+		}
+
+	      /* Build hierarchy (used for surface distances) */
+
+	      ptr = BuildSTLBVH(fct, nf);
+	      WDB[loc0 + STL_PTR_BVH] = (double)ptr;
+
+	      /* Free memory */
+
+	      Mem(MEM_FREE, fct);
+	    }
+	}
+
+      /***********************************************************************/
+
       /* Loop over bodies and print */
 
       loc1 = (long)RDB[loc0 + STL_PTR_BODIES];
@@ -702,6 +778,11 @@ void ProcessSTLGeometry()
       fprintf(out, " - %1.1f%% of volume consists of pre-assigned data\n",
 	      100.0*V/((xmax - xmin)*(ymax - ymin)*(zmax - zmin)));
 
+      if ((ptr = (long)RDB[loc0 + STL_PTR_BVH]) > VALID_PTR)
+	fprintf(out, " - Bounding volume hierarchy: %ld nodes, %ld facets\n",
+		(long)RDB[ptr + STL_BVH_N_NODES], 
+		(long)RDB[ptr + STL_BVH_N_TRI]);
+
       mem = (double)MemCount();
 
       if (mem < MEGA)
@@ -36,6 +36,10 @@ void ProcessXSData()
 
   fprintf(out, "Processing cross sections and ENDF reaction laws...\n\n");
 
+  /* Start timer */
+
+  StartTimer(TIMER_XS_PROCESS);
+
   /* Do reaction cut-offs */
   
   ReactionCutoff();
@@ -1037,9 +1041,15 @@ void ProcessXSData()
       /***********************************************************************/
     }
 
+  /* Stop timer */
+
+  StopTimer(TIMER_XS_PROCESS);
+
   /* Process DBRC and TMS data */
 
+  StartTimer(TIMER_XS_TMP);
   ProcessTmpData();
+  StopTimer(TIMER_XS_TMP);
 
   /* Process coarse multi-group majorants */
 
@@ -1049,6 +1059,21 @@ void ProcessXSData()
   
   PrintNuclideData(-1, 0);
 
+  /* Print time used in different stages */
+
+  fprintf(out, "Nuclear data processing times (wall-clock):\n\n");
+
+  fprintf(out, " - Reading ACE files          : %1.2f seconds\n", 
+	  TimerVal(TIMER_XS_READ));
+  fprintf(out, " - Doppler-broadening         : %1.2f seconds\n", 
+	  TimerVal(TIMER_XS_BROADEN));
+  fprintf(out, " - Grid unionization          : %1.2f seconds\n", 
+	  TimerVal(TIMER_XS_UNIONIZE));
+  fprintf(out, " - Cross section processing   : %1.2f seconds\n", 
+	  TimerVal(TIMER_XS_PROCESS));
+  fprintf(out, " - DBRC and TMS data          : %1.2f seconds\n\n", 
+	  TimerVal(TIMER_XS_TMP));
+
   /* Check that neutron and gamma data exists */
 
   if (((long)RDB[DATA_NEUTRON_TRANSPORT_MODE] == YES) &&
@@ -1059,9 +1084,9 @@ void ProcessXSData()
       ((long)RDB[DATA_N_PHOTON_NUCLIDES] < 1))
     Error(0, "No photon transport data in photon transport problem");
 
-  /* Free ACE array */
+  /* Free ACE array (may be shared within node) */
 
-  Mem(MEM_FREE, ACE);
+  FreeACE();
 
   /* Reset data size */
 
@@ -0,0 +1,77 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : putmooseifcfields.c                            */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Copies MOOSE cell temperatures and densities to the          */
+/*              in-memory interface                                          */
+/*                                                                           */
+/* Comments: - Temperatures in K, densities with the Serpent sign            */
+/*             convention (negative for g/cm3)                               */
+/*                                                                           */
+/*           - Mesh must be put first with PutMooseIFCMesh()                 */
+/*                                                                           */
+/*           - Cells with changed values are added to the change list, so    */
+/*             that UpdateMooseIFC() only needs to process those             */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "PutMooseIFCFields:"
+
+/*****************************************************************************/
+
+long PutMooseIFCFields(long nc, const double *T, const double *rho)
+{
+  long n;
+
+  /* Check that mesh is given */
+
+  if ((mooseifc.nc < 1) || (nc != mooseifc.nc))
+    return -1;
+
+  /* Check pointers */
+
+  if ((T == NULL) || (rho == NULL))
+    return -1;
+
+  /* Loop over cells */
+
+  for (n = 0; n < nc; n++)
+    {
+      /* Skip unchanged */
+
+      if ((T[n] == mooseifc.T[n]) && (rho[n] == mooseifc.rho[n]))
+	continue;
+
+      /* Copy data */
+
+      mooseifc.T[n] = T[n];
+      mooseifc.rho[n] = rho[n];
+
+      /* Add to change list */
+
+      if (mooseifc.flag[n] == NO)
+	{
+	  mooseifc.chg[mooseifc.nchg++] = n;
+	  mooseifc.flag[n] = YES;
+	}
+    }
+
+  /* Exit OK */
+
+  return 0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
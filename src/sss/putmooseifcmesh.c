@@ -0,0 +1,136 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : putmooseifcmesh.c                              */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Copies MOOSE mesh topology to the in-memory interface        */
+/*                                                                           */
+/* Comments: - Called from MOOSE before the interface is read, so RDB may    */
+/*             not exist yet. Errors are returned to the caller instead of   */
+/*             calling Die().                                                */
+/*                                                                           */
+/*           - Points are given in cm, faces in OpenFOAM order (internal     */
+/*             faces first), face points as a CSR list: the points of face   */
+/*             n are fpts[fidx[n]] ... fpts[fidx[n + 1] - 1].                */
+/*                                                                           */
+/*           - Output map is 1-based like the OpenFOAM map file, NULL maps   */
+/*             each cell to itself.                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "PutMooseIFCMesh:"
+
+/*****************************************************************************/
+
+long PutMooseIFCMesh(long np, const double *pts, long nf, const long *fidx,
+		     const long *fpts, const long *own, long nnbr,
+		     const long *nbr, long nc, const long *map)
+{
+  long n;
+
+  /* Check sizes */
+
+  if ((np < 4) || (nf < 4) || (nc < 1) || (nnbr < 0) || (nnbr > nf))
+    return -1;
+
+  /* Check pointers */
+
+  if ((pts == NULL) || (fidx == NULL) || (fpts == NULL) || (own == NULL))
+    return -1;
+
+  if ((nnbr > 0) && (nbr == NULL))
+    return -1;
+
+  /* Check face point list */
+
+  if (fidx[0] != 0)
+    return -1;
+
+  for (n = 0; n < nf; n++)
+    if (fidx[n + 1] - fidx[n] < 3)
+      return -1;
+
+  /* Allocate memory */
+
+  mooseifc.pts = (double *)realloc(mooseifc.pts, 3*np*sizeof(double));
+  mooseifc.fidx = (long *)realloc(mooseifc.fidx, (nf + 1)*sizeof(long));
+  mooseifc.fpts = (long *)realloc(mooseifc.fpts, fidx[nf]*sizeof(long));
+  mooseifc.own = (long *)realloc(mooseifc.own, nf*sizeof(long));
+  mooseifc.nbr = (long *)realloc(mooseifc.nbr, (nnbr + 1)*sizeof(long));
+  mooseifc.map = (long *)realloc(mooseifc.map, nc*sizeof(long));
+  mooseifc.T = (double *)realloc(mooseifc.T, nc*sizeof(double));
+  mooseifc.rho = (double *)realloc(mooseifc.rho, nc*sizeof(double));
+  mooseifc.pwr = (double *)realloc(mooseifc.pwr, nc*sizeof(double));
+  mooseifc.chg = (long *)realloc(mooseifc.chg, nc*sizeof(long));
+  mooseifc.flag = (long *)realloc(mooseifc.flag, nc*sizeof(long));
+
+  if ((mooseifc.pts == NULL) || (mooseifc.fidx == NULL) ||
+      (mooseifc.fpts == NULL) || (mooseifc.own == NULL) ||
+      (mooseifc.nbr == NULL) || (mooseifc.map == NULL) ||
+      (mooseifc.T == NULL) || (mooseifc.rho == NULL) ||
+      (mooseifc.pwr == NULL) || (mooseifc.chg == NULL) ||
+      (mooseifc.flag == NULL))
+    return -1;
+
+  /* Free child cell index, created by UpdateMooseIFC() */
+
+  free(mooseifc.cptr);
+  free(mooseifc.cidx);
+
+  mooseifc.cptr = NULL;
+  mooseifc.cidx = NULL;
+
+  /* Copy topology */
+
+  memcpy(mooseifc.pts, pts, 3*np*sizeof(double));
+  memcpy(mooseifc.fidx, fidx, (nf + 1)*sizeof(long));
+  memcpy(mooseifc.fpts, fpts, fidx[nf]*sizeof(long));
+  memcpy(mooseifc.own, own, nf*sizeof(long));
+
+  if (nnbr > 0)
+    memcpy(mooseifc.nbr, nbr, nnbr*sizeof(long));
+
+  /* Copy output map or map each cell to itself */
+
+  for (n = 0; n < nc; n++)
+    {
+      if (map != NULL)
+	mooseifc.map[n] = map[n];
+      else
+	mooseifc.map[n] = n + 1;
+
+      /* Reset fields, power and change flags */
+
+      mooseifc.T[n] = 0.0;
+      mooseifc.rho[n] = 0.0;
+      mooseifc.pwr[n] = 0.0;
+      mooseifc.flag[n] = NO;
+    }
+
+  mooseifc.nchg = 0;
+
+  /* Put sizes */
+
+  mooseifc.np = np;
+  mooseifc.nf = nf;
+  mooseifc.nnbr = nnbr;
+  mooseifc.nc = nc;
+
+  /* Exit OK */
+
+  return 0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -19,6 +19,9 @@ extern "C" {
 /*           - Should be used only during the transport cycle, for other     */
 /*             purposes use C-function drand48().                            */
 /*                                                                           */
+/*           - With "set rng 2" the seed is a counter and the numbers are    */
+/*             generated by the counter-based Philox() instead.              */
+/*                                                                           */
 /*****************************************************************************/
 
 #include "header.h"
@@ -36,17 +39,33 @@ double RandF(long id)
   /* Get seed */
 
   seed = SEED[id*RNG_SZ];
-  CheckValue(FUNCTION_NAME, "seed", "", seed, 1, INFTY);
 
-  /* Sample rng */
+  /* Check generator type */
+
+  if ((long)RDB[DATA_RNG_TYPE] == RNG_TYPE_PHILOX)
+    {
+      /* Update counter and sample rng */
+
+      seed++;
+      f = Philox(seed);
+    }
+  else
+    {
+      /* Check seed */
+
+      CheckValue(FUNCTION_NAME, "seed", "", seed, 1, INFTY);
+
+      /* Sample rng */
   
-  seed *= 2862933555777941757;
-  seed += 12345;
+      seed *= 2862933555777941757;
+      seed += 12345;
 
-  /* Conversion to floating point number in interval [0,1) */
+      /* Conversion to floating point number in interval [0,1) */
   
-  f = (double)(seed >> 12);
-  f /= 0x0010000000000000;
+      f = (double)(seed >> 12);
+      f /= 0x0010000000000000;
+    }
+
   CheckValue(FUNCTION_NAME, "f", "", f, 0.0, 1.0);
 
   /* Store seed */
@@ -0,0 +1,171 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : readacecache.c                                 */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Reads ACE data from binary cache file into ACE data block    */
+/*                                                                           */
+/* Comments: - Cache files are written by WriteACECache() in the directory   */
+/*             given with "set acecache". One file per ZAID (name includes   */
+/*             library identifier, i.e. temperature).                        */
+/*                                                                           */
+/*           - Returns NO if file is not found or if it was written from     */
+/*             a different version of the ACE file (path, size or            */
+/*             modification time differs), and the data is read from the     */
+/*             ACE file.                                                     */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "ReadACECache:"
+
+/*****************************************************************************/
+
+long ReadACECache(long nuc)
+{
+  long ace, ptr, n, sz, fsz, ftime, NXS[16], JXS[32];
+  double awr;
+  char magic[8], src[MAX_STR], name[MAX_STR], file[MAX_STR], path[MAX_STR];
+  struct stat sb;
+  FILE *fp;
+
+  /* Check if cache is used */
+
+  if ((long)RDB[DATA_PTR_ACE_CACHE_PATH] < VALID_PTR)
+    return NO;
+
+  /* Get pointer to ACE data */
+
+  ace = (long)RDB[nuc + NUCLIDE_PTR_ACE];
+  CheckPointer(FUNCTION_NAME, "ace", ACE_ARRAY, ace);
+
+  /* Get name */
+
+  WDB[DATA_DUMMY] = ACE[ace + ACE_PTR_NAME];
+  strcpy(name, GetText(DATA_DUMMY));
+
+  /* Get file name (path may be completed from SERPENT_DATA) */
+
+  WDB[DATA_DUMMY] = ACE[ace + ACE_PTR_FILE];
+
+  fp = OpenDataFile(DATA_DUMMY, "ACE data file");
+  fclose(fp);
+
+  strcpy(file, GetText(DATA_DUMMY));
+
+  /* Get size and modification time of ACE file */
+
+  if (stat(file, &sb) != 0)
+    return NO;
+
+  /* Put cache file name (never open truncated path) */
+
+  if (snprintf(path, MAX_STR, "%s/%s.acebin",
+	       GetText(DATA_PTR_ACE_CACHE_PATH), name) >= MAX_STR)
+    Die(FUNCTION_NAME, "ACE cache file name too long");
+
+  /* Open cache file */
+
+  if ((fp = fopen(path, "r")) == NULL)
+    return NO;
+
+  /* Read header */
+
+  if ((fread(magic, sizeof(char), 8, fp) != 8) ||
+      (fread(&fsz, sizeof(long), 1, fp) != 1) ||
+      (fread(&ftime, sizeof(long), 1, fp) != 1) ||
+      (fread(src, sizeof(char), MAX_STR, fp) != MAX_STR) ||
+      (fread(&awr, sizeof(double), 1, fp) != 1) ||
+      (fread(NXS, sizeof(long), 16, fp) != 16) ||
+      (fread(JXS, sizeof(long), 32, fp) != 32))
+    {
+      fclose(fp);
+      return NO;
+    }
+
+  /* Compare to ACE file */
+
+  src[MAX_STR - 1] = '\0';
+
+  if ((strncmp(magic, ACE_CACHE_MAGIC, 8)) || (strcmp(src, file)) ||
+      (fsz != (long)sb.st_size) || (ftime != (long)sb.st_mtime))
+    {
+      fclose(fp);
+      return NO;
+    }
+
+  /* Check data size */
+
+  if ((sz = NXS[0]) < 10)
+    {
+      fclose(fp);
+      return NO;
+    }
+
+  if ((fstat(fileno(fp), &sb) != 0) ||
+      ((long)sb.st_size != ftell(fp) + sz*(long)sizeof(double)))
+    {
+      fclose(fp);
+      return NO;
+    }
+
+  /* Allocate memory for NXS array and copy data */
+
+  ptr = ReallocMem(ACE_ARRAY, 16);
+  ACE[ace + ACE_PTR_NXS] = (double)ptr;
+
+  for (n = 0; n < 16; n++)
+    ACE[ptr++] = (double)NXS[n];
+
+  /* Allocate memory for JXS array and copy data */
+
+  ptr = ReallocMem(ACE_ARRAY, 32);
+  ACE[ace + ACE_PTR_JXS] = (double)ptr;
+
+  for (n = 0; n < 32; n++)
+    ACE[ptr++] = (double)JXS[n];
+
+  /* Allocate memory for XSS array */
+
+  ptr = ReallocMem(ACE_ARRAY, sz);
+  ACE[ace + ACE_PTR_XSS] = (double)ptr;
+
+  /* Read data */
+
+  if ((long)fread(&ACE[ptr], sizeof(double), sz, fp) != sz)
+    Die(FUNCTION_NAME, "Error reading ACE cache file %s", path);
+
+  /* Close file */
+
+  fclose(fp);
+
+  /* Preserve decay awr (same as in ReadACEFile()) */
+
+  if ((long)RDB[nuc + NUCLIDE_TYPE] != NUCLIDE_TYPE_DECAY)
+    {
+      /* Put atomic weight ratio */
+
+      WDB[nuc + NUCLIDE_AWR] = awr;
+
+      /* Use value read from directory file for atomic weight */
+
+      WDB[nuc + NUCLIDE_AW] = ACE[ace + ACE_AW];
+    }
+
+  /* Data was read */
+
+  return YES;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
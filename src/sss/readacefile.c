@@ -29,11 +29,16 @@ extern "C" {
 void ReadACEFile(long nuc)
 {
   long ace, ptr, rea, n, sz, NXS[16], JXS[32], NES, L0, L, NTR, nr, mt, nc, I0;
+  long cache;
   double *XSS, awr, Emax, T;
   char HZ1[MAX_STR], HZ2[MAX_STR], dummy[MAX_STR], name[MAX_STR];
   char file[MAX_STR], date[MAX_STR];
   FILE *fp;
 
+  /* Start timer */
+
+  StartTimer(TIMER_XS_READ);
+
   /* Check nuclide type */
 
   if ((long)RDB[nuc + NUCLIDE_TYPE] == NUCLIDE_TYPE_DECAY)
@@ -55,13 +60,30 @@ void ReadACEFile(long nuc)
   WDB[DATA_DUMMY] = ACE[ace + ACE_PTR_FILE];
   strcpy(file, GetText(DATA_DUMMY));
   
-  /* Test format */
+  /* Try binary cache file first */
 
-  TestDOSFile(GetText(DATA_DUMMY));
+  if (ReadACECache(nuc) == YES)
+    {
+      /* Data was read from cache, skip ACE file */
 
-  /* Open file for writing */
+      fp = NULL;
+      cache = NO;
+    }
+  else
+    {
+      /* Test format */
+
+      TestDOSFile(GetText(DATA_DUMMY));
+
+      /* Open file for writing */
   
-  fp = OpenDataFile(DATA_DUMMY, "ACE data file");
+      fp = OpenDataFile(DATA_DUMMY, "ACE data file");
+
+      /* Get completed file name and write cache after reading */
+
+      strcpy(file, GetText(DATA_DUMMY));
+      cache = YES;
+    }
 
   /***************************************************************************/
   
@@ -74,7 +96,7 @@ void ReadACEFile(long nuc)
 
   /* Read ZAID and data */
   
-  while (fscanf(fp, "%s", HZ1) != EOF)
+  while ((fp != NULL) && (fscanf(fp, "%s", HZ1) != EOF))
     {
       /* Check for new format (assuming here that the character string  */
       /* is '2.0.0' -- this is something that may need to be checked in */
@@ -213,6 +235,10 @@ void ReadACEFile(long nuc)
 		Warn(FUNCTION_NAME, "Error in XSS array (%s)", 
 		     GetText(nuc + NUCLIDE_PTR_NAME));
 
+		/* Do not cache incomplete data */
+
+		cache = NO;
+
 		/* Break */
 
 		break;
@@ -237,8 +263,27 @@ void ReadACEFile(long nuc)
   
   /* Check that data was found */
   
-  if ((strcmp(HZ1, name)) && (strcmp(HZ2, name)))
+  if ((fp != NULL) && (strcmp(HZ1, name)) && (strcmp(HZ2, name)))
     Die(FUNCTION_NAME, "Unable to find isotope %s in file %s", name, file);
+
+  /* Write binary cache file */
+
+  if (cache == YES)
+    WriteACECache(nuc, file, awr);
+
+  /* Get NXS and JXS arrays (needed if data was read from cache) */
+
+  ptr = (long)ACE[ace + ACE_PTR_NXS];
+  CheckPointer(FUNCTION_NAME, "(ptr)", ACE_ARRAY, ptr);
+
+  for (n = 0; n < 16; n++)
+    NXS[n] = (long)ACE[ptr + n];
+
+  ptr = (long)ACE[ace + ACE_PTR_JXS];
+  CheckPointer(FUNCTION_NAME, "(ptr)", ACE_ARRAY, ptr);
+
+  for (n = 0; n < 32; n++)
+    JXS[n] = (long)ACE[ptr + n];
   
   /* Pointer to XSS array */
       
@@ -1305,7 +1350,12 @@ void ReadACEFile(long nuc)
 
   /* Close file  */
   
-  fclose(fp);	  
+  if (fp != NULL)
+    fclose(fp);	  
+
+  /* Stop timer */
+
+  StopTimer(TIMER_XS_READ);
 }
 
 /*****************************************************************************/
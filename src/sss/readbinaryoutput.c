@@ -0,0 +1,152 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : readbinaryoutput.c                             */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Reads dataset from binary output file                        */
+/*                                                                           */
+/* Comments: - Returns a copy of the dataset in the last frame that has it,  */
+/*             or NULL if not found. Number of values is put in n and the    */
+/*             array is freed with Mem(MEM_FREE, ...).                       */
+/*           - The file is mapped to memory and only the index and the       */
+/*             requested data are accessed. Used by HeatToMoose.             */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "ReadBinaryOutput:"
+
+/*****************************************************************************/
+
+double *ReadBinaryOutput(char *fname, char *name, long *n)
+{
+  long sz, off, i;
+  int fd;
+  char *map;
+  double *dat;
+  struct stat st;
+  struct BinOutHead *head;
+  struct BinOutFrame *frm;
+  struct BinOutIdx *ent;
+  struct BinOutTail *tail;
+
+  /* Reset values */
+
+  *n = 0;
+  dat = NULL;
+
+  /* Open file and get size */
+
+  if ((fd = open(fname, O_RDONLY)) < 0)
+    return NULL;
+
+  if (fstat(fd, &st) != 0)
+    {
+      close(fd);
+      return NULL;
+    }
+
+  sz = (long)st.st_size;
+
+  /* Check size */
+
+  if (sz < (long)(sizeof(struct BinOutHead) + sizeof(struct BinOutTail)))
+    {
+      close(fd);
+      return NULL;
+    }
+
+  /* Map file (mapping remains after file is closed) */
+
+  map = (char *)mmap(NULL, sz, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+
+  if (map == MAP_FAILED)
+    return NULL;
+
+  /* Check header and tail */
+
+  head = (struct BinOutHead *)map;
+  tail = (struct BinOutTail *)&map[sz - sizeof(struct BinOutTail)];
+
+  if ((memcmp(head->magic, "SSSBIN\0\0", 8)) ||
+      (head->ver != BINOUT_VERSION) ||
+      (memcmp(tail->magic, "SSSEND\0\0", 8)))
+    {
+      munmap(map, sz);
+      return NULL;
+    }
+
+  /* Loop over frames starting from last */
+
+  off = tail->idx;
+
+  while ((off > 0) && (dat == NULL))
+    {
+      /* Check offset */
+
+      if (off + (long)sizeof(struct BinOutFrame) > sz)
+	break;
+
+      /* Pointer to frame index */
+
+      frm = (struct BinOutFrame *)&map[off];
+
+      if ((memcmp(frm->magic, "SSSIDX\0\0", 8)) || (frm->nds < 0) ||
+	  (off + (long)sizeof(struct BinOutFrame) +
+	   frm->nds*(long)sizeof(struct BinOutIdx) > sz))
+	break;
+
+      /* Loop over datasets */
+
+      ent = (struct BinOutIdx *)&map[off + sizeof(struct BinOutFrame)];
+
+      for (i = 0; i < frm->nds; i++)
+	if (!strncmp(ent[i].name, name, BINOUT_NAME_LEN))
+	  {
+	    /* Check type and size */
+
+	    if ((ent[i].type != BINOUT_TYPE_DOUBLE) || (ent[i].sz < 1) ||
+		(ent[i].off < 0) || (ent[i].off + ent[i].sz > off))
+	      break;
+
+	    /* Copy data */
+
+	    *n = ent[i].sz/sizeof(double);
+	    dat = (double *)Mem(MEM_ALLOC, *n, sizeof(double));
+	    memcpy(dat, &map[ent[i].off], *n*sizeof(double));
+
+	    /* Break loop */
+
+	    break;
+	  }
+
+      /* Pointer to previous frame (must be before this one) */
+
+      if (frm->prev >= off)
+	break;
+
+      off = frm->prev;
+    }
+
+  /* Unmap file */
+
+  munmap(map, sz);
+
+  /* Return data */
+
+  return dat;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
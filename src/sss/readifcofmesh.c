@@ -6,7 +6,7 @@ extern "C" {
 /* serpent 2 (beta-version) : readifcofmesh.c                                */
 /*                                                                           */
 /* Created:       2014/10/06 (VVa)                                           */
-/* Last modified: 2016/04/04 (VVa)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
 /* Version:       2.1.26                                                     */
 /*                                                                           */
 /* Description: Reads OpenFOAM multi-physics interfaces                      */
@@ -16,6 +16,10 @@ extern "C" {
 /*             - Tiheysjakauman yksiköt luetaan nyt dimensions -vektorista   */
 /*               (2.12.2014 / 2.1.23 / JLe)                                  */
 /*                                                                           */
+/*             - In-memory MOOSE interface (IFC_TYPE_MOOSE) takes the mesh   */
+/*               and fields from PutMooseIFCMesh() and PutMooseIFCFields()   */
+/*               instead of the OpenFOAM files (LMK)                         */
+/*                                                                           */
 /*****************************************************************************/
 
 #include "header.h"
@@ -129,6 +133,8 @@ void ReadIFCOFMesh(long loc0, long update)
 
   dtype = -1;
   ttype = -1;
+  fp1 = NULL;
+  line = NULL;
 
   /* Reset divisor flag */
 
@@ -194,96 +200,138 @@ void ReadIFCOFMesh(long loc0, long update)
   if(!update)
     WDB[ptr] = -1.0;
 
-  /* Read file names (points, faces, owner and neighbour) */
+  /* Check in-memory MOOSE interface */
 
-  if (fscanf(fp, "%s", pfile) == EOF)
-    Error(loc0, "Missing path to points file");
-  else
-    TestDOSFile(pfile);
+  if (type == IFC_TYPE_MOOSE)
+    {
+      /* Check that MOOSE has put the mesh */
 
-  WDB[loc0 + IFC_PTR_OF_PFILE] = PutText(pfile);
+      if (mooseifc.nc < 1)
+	Error(loc0, "In-memory MOOSE interface data is not given");
 
-  if (fscanf(fp, "%s", ffile) == EOF)
-    Error(loc0, "Missing path to faces file");
-  else
-    TestDOSFile(ffile);
+      /* Data is not read from files, put dummy names */
 
-  WDB[loc0 + IFC_PTR_OF_FFILE] = PutText(ffile);
+      sprintf(pfile, "moose");
+      sprintf(ffile, "moose");
+      sprintf(ofile, "moose");
+      sprintf(nfile, "moose");
+      sprintf(rfile, "moose");
+      sprintf(tfile, "moose");
+      sprintf(mapfile, "moose");
 
-  if (fscanf(fp, "%s", ofile) == EOF)
-    Error(loc0, "Missing path to owner file");
-  else
-    TestDOSFile(ofile);
+      WDB[loc0 + IFC_PTR_OF_PFILE] = PutText(pfile);
+      WDB[loc0 + IFC_PTR_OF_FFILE] = PutText(ffile);
+      WDB[loc0 + IFC_PTR_OF_OFILE] = PutText(ofile);
+      WDB[loc0 + IFC_PTR_OF_NFILE] = PutText(nfile);
+      WDB[loc0 + IFC_PTR_OF_RFILE] = PutText(rfile);
+      WDB[loc0 + IFC_PTR_OF_TFILE] = PutText(tfile);
 
-  WDB[loc0 + IFC_PTR_OF_OFILE] = PutText(ofile);
+      /* Densities and absolute temperatures are always given */
 
-  if (fscanf(fp, "%s", nfile) == EOF)
-    Error(loc0, "Missing path to neighbour file");
-  else
-    TestDOSFile(nfile);
+      dtype = 1;
+      ttype = 1;
 
-  WDB[loc0 + IFC_PTR_OF_NFILE] = PutText(nfile);
+      /* Set flag */
 
-  if ((type == IFC_TYPE_OF_MAT) || (type == IFC_TYPE_OF_SOLID))
+      WDB[loc0 + IFC_IN_MEMORY] = (double)YES;
+    }
+  else
     {
+      /* Read file names (points, faces, owner and neighbour) */
 
-      /* Read material file */
+      if (fscanf(fp, "%s", pfile) == EOF)
+	Error(loc0, "Missing path to points file");
+      else
+	TestDOSFile(pfile);
+
+      WDB[loc0 + IFC_PTR_OF_PFILE] = PutText(pfile);
 
-      if (fscanf(fp, "%s", matfile) == EOF)
-	Error(loc0, "Missing path to material file");
+      if (fscanf(fp, "%s", ffile) == EOF)
+	Error(loc0, "Missing path to faces file");
       else
-	TestDOSFile(matfile);
+	TestDOSFile(ffile);
 
-      WDB[loc0 + IFC_PTR_OF_MFILE] = PutText(matfile);
+      WDB[loc0 + IFC_PTR_OF_FFILE] = PutText(ffile);
 
-    }
+      if (fscanf(fp, "%s", ofile) == EOF)
+	Error(loc0, "Missing path to owner file");
+      else
+	TestDOSFile(ofile);
 
-  /* Read density file */
+      WDB[loc0 + IFC_PTR_OF_OFILE] = PutText(ofile);
 
-  if (fscanf(fp, "%s", rfile) == EOF)
-    Error(loc0, "Missing path to density file");
-  else
-    TestDOSFile(rfile);
+      if (fscanf(fp, "%s", nfile) == EOF)
+	Error(loc0, "Missing path to neighbour file");
+      else
+	TestDOSFile(nfile);
 
-  WDB[loc0 + IFC_PTR_OF_RFILE] = PutText(rfile);
+      WDB[loc0 + IFC_PTR_OF_NFILE] = PutText(nfile);
 
-  /* Read type flag */
+      if ((type == IFC_TYPE_OF_MAT) || (type == IFC_TYPE_OF_SOLID))
+	{
 
-  if (strcmp(rfile, "-1"))
-    {
-      if (fscanf(fp, "%ld", &dtype) == EOF)
-	Error(loc0, "Missing density distribution type flag");
-      else if (dtype != 1)
-	Error(loc0, "Invalid density distribution type flag");
-    }
+	  /* Read material file */
 
-  /* Read temperature file */
+	  if (fscanf(fp, "%s", matfile) == EOF)
+	    Error(loc0, "Missing path to material file");
+	  else
+	    TestDOSFile(matfile);
 
-  if (fscanf(fp, "%s", tfile) == EOF)
-    Error(loc0, "Missing path to temperature file");
-  else
-    TestDOSFile(tfile);
+	  WDB[loc0 + IFC_PTR_OF_MFILE] = PutText(matfile);
 
-  WDB[loc0 + IFC_PTR_OF_TFILE] = PutText(tfile);
+	}
 
-  /* Read type flag */
+      /* Read density file */
 
-  if (strcmp(tfile, "-1"))
-    {
-      if (fscanf(fp, "%ld", &ttype) == EOF)
-	Error(loc0, "Missing temperature distribution type flag");
-      else if ((ttype != 1) && (ttype != 2))
-	Error(loc0, "Invalid temperature distribution type flag");
-    }
+      if (fscanf(fp, "%s", rfile) == EOF)
+	Error(loc0, "Missing path to density file");
+      else
+	TestDOSFile(rfile);
 
-  /* Read output mapping file */
+      WDB[loc0 + IFC_PTR_OF_RFILE] = PutText(rfile);
 
-  if ((long)RDB[loc0 + IFC_CALC_OUTPUT] == YES)
-    {
-      if (fscanf(fp, "%s", mapfile) == EOF)
-	Error(loc0, "Missing path to output map file");
+      /* Read type flag */
+
+      if (strcmp(rfile, "-1"))
+	{
+	  if (fscanf(fp, "%ld", &dtype) == EOF)
+	    Error(loc0, "Missing density distribution type flag");
+	  else if (dtype != 1)
+	    Error(loc0, "Invalid density distribution type flag");
+	}
+
+      /* Read temperature file */
+
+      if (fscanf(fp, "%s", tfile) == EOF)
+	Error(loc0, "Missing path to temperature file");
       else
-	TestDOSFile(mapfile);
+	TestDOSFile(tfile);
+
+      WDB[loc0 + IFC_PTR_OF_TFILE] = PutText(tfile);
+
+      /* Read type flag */
+
+      if (strcmp(tfile, "-1"))
+	{
+	  if (fscanf(fp, "%ld", &ttype) == EOF)
+	    Error(loc0, "Missing temperature distribution type flag");
+	  else if ((ttype != 1) && (ttype != 2))
+	    Error(loc0, "Invalid temperature distribution type flag");
+	}
+
+      /* Read output mapping file */
+
+      if ((long)RDB[loc0 + IFC_CALC_OUTPUT] == YES)
+	{
+	  if (fscanf(fp, "%s", mapfile) == EOF)
+	    Error(loc0, "Missing path to output map file");
+	  else
+	    TestDOSFile(mapfile);
+
+	  /* Store name for snapshot key */
+
+	  WDB[loc0 + IFC_PTR_OF_MAPFILE] = PutText(mapfile);
+	}
     }
 
   /* Close file */
@@ -307,19 +355,28 @@ void ReadIFCOFMesh(long loc0, long update)
   if(!update)
     {
 
-      /* Check file format */
+      if (type == IFC_TYPE_MOOSE)
+	{
+	  /* Get number of points */
+
+	  nd = mooseifc.np;
+	}
+      else
+	{
+	  /* Check file format */
 
-      TestDOSFile(pfile);
+	  TestDOSFile(pfile);
 
-      /* Open points file for reading */
+	  /* Open points file for reading */
       
-      if ((fp = fopen(pfile, "r")) == NULL)
-	Error(loc0, "Points file \"%s\" does not exist", 
-	      pfile);
+	  if ((fp = fopen(pfile, "r")) == NULL)
+	    Error(loc0, "Points file \"%s\" does not exist", 
+		  pfile);
 
-      /* Read header data */
+	  /* Read header data */
 
-      ReadOFHeader(fp, &n, &nd, (long *)dim);
+	  ReadOFHeader(fp, &n, &nd, (long *)dim);
+	}
 
       /* Check number of points */
 
@@ -341,18 +398,29 @@ void ReadIFCOFMesh(long loc0, long update)
       
       for (n = 0; n < nd; n++)
 	{
-	  /* Read coordinates */
+	  if (type == IFC_TYPE_MOOSE)
+	    {
+	      /* Get coordinates (already in cm) */
+
+	      x = mooseifc.pts[3*n];
+	      y = mooseifc.pts[3*n + 1];
+	      z = mooseifc.pts[3*n + 2];
+	    }
+	  else
+	    {
+	      /* Read coordinates */
 
-	  line = ReadOFData(fp, OF_FILE_POINTS);
+	      line = ReadOFData(fp, OF_FILE_POINTS);
 	      
-	  if (sscanf(line, "%lf %lf %lf", &x, &y, &z) == EOF)
-	    Error(loc0, "Not enough entries in points file");
+	      if (sscanf(line, "%lf %lf %lf", &x, &y, &z) == EOF)
+		Error(loc0, "Not enough entries in points file");
 	  
-	  /* Convert to cm */
+	      /* Convert to cm */
 	  
-	  x = x*100.0;
-	  y = y*100.0;
-	  z = z*100.0;
+	      x = x*100.0;
+	      y = y*100.0;
+	      z = z*100.0;
+	    }
 	  
 	  /* Put data */
 	  
@@ -380,7 +448,8 @@ void ReadIFCOFMesh(long loc0, long update)
       
       /* Close file */
 
-      fclose(fp);
+      if (type != IFC_TYPE_MOOSE)
+	fclose(fp);
 
       /* Print out points */
 
@@ -416,19 +485,28 @@ void ReadIFCOFMesh(long loc0, long update)
   if (!update)
     {
 
-      /* Check file format */
+      if (type == IFC_TYPE_MOOSE)
+	{
+	  /* Get number of faces */
+
+	  nf = mooseifc.nf;
+	}
+      else
+	{
+	  /* Check file format */
 
-      TestDOSFile(ffile);
+	  TestDOSFile(ffile);
 
-      /* Open faces file for reading */
+	  /* Open faces file for reading */
       
-      if ((fp = fopen(ffile, "r")) == NULL)
-	Error(loc0, "Faces file \"%s\" does not exist", 
-	      ffile);
+	  if ((fp = fopen(ffile, "r")) == NULL)
+	    Error(loc0, "Faces file \"%s\" does not exist", 
+		  ffile);
 
-      /* Read header data */
+	  /* Read header data */
 
-      ReadOFHeader(fp, &n, &nf, (long *)dim);
+	  ReadOFHeader(fp, &n, &nf, (long *)dim);
+	}
 
       /* Check number of faces */
 
@@ -470,15 +548,24 @@ void ReadIFCOFMesh(long loc0, long update)
 	  WDB[solist + n] = -1;
 	  WDB[snlist + n] = -1;
 
-	  /* Read entry */
+	  if (type == IFC_TYPE_MOOSE)
+	    {
+	      /* Get number of points */
+
+	      np = mooseifc.fidx[n + 1] - mooseifc.fidx[n];
+	    }
+	  else
+	    {
+	      /* Read entry */
 
-	  line = ReadOFData(fp, OF_FILE_FACES);
+	      line = ReadOFData(fp, OF_FILE_FACES);
 
-	  /* Read number of points */
+	      /* Read number of points */
 	  
-	  p = NextWord(line, tmpstr);
-	  line = &line[p];
-	  np = (long)atoi(tmpstr);
+	      p = NextWord(line, tmpstr);
+	      line = &line[p];
+	      np = (long)atoi(tmpstr);
+	    }
 	
 	  /* Check type */
 	      
@@ -501,11 +588,20 @@ void ReadIFCOFMesh(long loc0, long update)
 	  
 	  for (j = 0; j < np; j++)
 	    {
-	      /* Read point index */
+	      if (type == IFC_TYPE_MOOSE)
+		{
+		  /* Get point index */
 
-	      p = NextWord(line, tmpstr);
-	      line = &line[p];
-	      k = (long)atoi(tmpstr);
+		  k = mooseifc.fpts[mooseifc.fidx[n] + j];
+		}
+	      else
+		{
+		  /* Read point index */
+
+		  p = NextWord(line, tmpstr);
+		  line = &line[p];
+		  k = (long)atoi(tmpstr);
+		}
 		  
 	      /* Check */
 		  
@@ -525,7 +621,8 @@ void ReadIFCOFMesh(long loc0, long update)
 	  
       /* Close file */
       
-      fclose(fp);
+      if (type != IFC_TYPE_MOOSE)
+	fclose(fp);
 #ifdef mmmaaa
       /* Loop over faces and print out */
 
@@ -579,54 +676,78 @@ void ReadIFCOFMesh(long loc0, long update)
 	  
       for (fi = 1; fi < 3; fi++)
 	{
-	  /* Check mode */
-	  
-	  if (fi == 1)
+	  if (type == IFC_TYPE_MOOSE)
 	    {
-	      /* Open file */
-
-	      if ((fp = fopen(ofile, "r")) 
-		  == NULL)
-		Error(loc0, "Owner file \"%s\" does not exist", 
-		      ofile);
-	      
-	      /* Read header data */
-	      
-	      ReadOFHeader(fp, &n, &nmax, (long *)dim);
+	      /* Get number of entries */
 
+	      if (fi == 1)
+		nmax = mooseifc.nf;
+	      else
+		nmax = mooseifc.nnbr;
 	    }
 	  else
 	    {
-	      /* Open file */
+	      /* Check mode */
+	  
+	      if (fi == 1)
+		{
+		  /* Open file */
+
+		  if ((fp = fopen(ofile, "r")) 
+		      == NULL)
+		    Error(loc0, "Owner file \"%s\" does not exist", 
+			  ofile);
+	      
+		  /* Read header data */
+	      
+		  ReadOFHeader(fp, &n, &nmax, (long *)dim);
+
+		}
+	      else
+		{
+		  /* Open file */
 
-	      if ((fp = fopen(nfile, "r")) 
-		  == NULL)
-		Error(loc0, "Neighbour file \"%s\" does not exist", 
-		      nfile);
+		  if ((fp = fopen(nfile, "r")) 
+		      == NULL)
+		    Error(loc0, "Neighbour file \"%s\" does not exist", 
+			  nfile);
 	      
-	      /* Read header data */
+		  /* Read header data */
 	      
-	      ReadOFHeader(fp, &n, &nmax, (long *)dim);
+		  ReadOFHeader(fp, &n, &nmax, (long *)dim);
 
+		}
 	    }
 	  
 	  /* Loop over faces */
 	  
 	  for (n = 0; n < nmax; n++)
 	    {
-	      /* Read cell index from owner/neighbour file */
-	      
-	      if (fi == 1)
-		line = ReadOFData(fp, OF_FILE_OWNER);
+	      if (type == IFC_TYPE_MOOSE)
+		{
+		  /* Get cell index */
+
+		  if (fi == 1)
+		    i = mooseifc.own[n];
+		  else
+		    i = mooseifc.nbr[n];
+		}
 	      else
-		line = ReadOFData(fp, OF_FILE_NEIGHBOUR);
-	      
-	      if (sscanf(line, "%ld", &i) == EOF)
 		{
+		  /* Read cell index from owner/neighbour file */
+	      
 		  if (fi == 1)
-		    Error(loc0, "Not enough entries in owner file");
+		    line = ReadOFData(fp, OF_FILE_OWNER);
 		  else
-		    Error(loc0, "Not enough entries in neighbour file");
+		    line = ReadOFData(fp, OF_FILE_NEIGHBOUR);
+	      
+		  if (sscanf(line, "%ld", &i) == EOF)
+		    {
+		      if (fi == 1)
+			Error(loc0, "Not enough entries in owner file");
+		      else
+			Error(loc0, "Not enough entries in neighbour file");
+		    }
 		}
 	      
 	      /* Update number of cells */
@@ -645,7 +766,8 @@ void ReadIFCOFMesh(long loc0, long update)
 	  
 	  /* Close file */
 	  
-	  fclose(fp);
+	  if (type != IFC_TYPE_MOOSE)
+	    fclose(fp);
 	}
 
       /***********************************************************************/
@@ -1214,39 +1336,57 @@ void ReadIFCOFMesh(long loc0, long update)
 
   if (strcmp(rfile, "-1"))
     {
-      /* Open density file for reading */
+      if (type == IFC_TYPE_MOOSE)
+	{
+	  /* Get number of entries and cells */
 
-      if ((fp1 = fopen(rfile, "r")) == NULL)
-	Error(loc0, "Density file \"%s\" does not exist", rfile);
+	  i = mooseifc.nc;
+	  nc = (long)RDB[loc0 + IFC_MSH_N_CELLS];
 
-      /* Read header data */
+	  /* Densities are given in Serpent units */
 
-      ReadOFHeader(fp1, &n, &i, (long *)dim);
+	  mul = 1.0;
 
-      /* Get number of cells */
+	  /* Reset index */
 
-      nc = (long)RDB[loc0 + IFC_MSH_N_CELLS];
+	  n = 0;
+	}
+      else
+	{
+	  /* Open density file for reading */
 
-      /* Reset multiplier */
+	  if ((fp1 = fopen(rfile, "r")) == NULL)
+	    Error(loc0, "Density file \"%s\" does not exist", rfile);
 
-      mul = 1.0;
+	  /* Read header data */
 
-      /* Check units */
+	  ReadOFHeader(fp1, &n, &i, (long *)dim);
 
-      if ((dim[0] == 0) && (dim[1] == 0))
-	{
-	  /* Relative values, multiply by nominal density */
+	  /* Get number of cells */
 
-	  mul = d0;
-	}
-      else if ((dim[0] == 1) && (dim[1] == -3))
-	{
-	  /* kg/m3, convert to g/cm3 */
+	  nc = (long)RDB[loc0 + IFC_MSH_N_CELLS];
+
+	  /* Reset multiplier */
+
+	  mul = 1.0;
+
+	  /* Check units */
+
+	  if ((dim[0] == 0) && (dim[1] == 0))
+	    {
+	      /* Relative values, multiply by nominal density */
+
+	      mul = d0;
+	    }
+	  else if ((dim[0] == 1) && (dim[1] == -3))
+	    {
+	      /* kg/m3, convert to g/cm3 */
 
-	  mul = -0.001;
+	      mul = -0.001;
+	    }
+	  else
+	    Die(FUNCTION_NAME, "Undefined dimensions %ld/%ld", dim[0], dim[1]);
 	}
-      else
-	Die(FUNCTION_NAME, "Undefined dimensions %ld/%ld", dim[0], dim[1]);
 
       /* Check type */
       /*
@@ -1273,12 +1413,21 @@ void ReadIFCOFMesh(long loc0, long update)
 
       while (loc1 > VALID_PTR)
 	{
-	  /* Read density */
+	  if (type == IFC_TYPE_MOOSE)
+	    {
+	      /* Get density */
+
+	      d = mooseifc.rho[n++];
+	    }
+	  else
+	    {
+	      /* Read density */
 
-	  line = ReadOFData(fp1, OF_FILE_DENSITY);
+	      line = ReadOFData(fp1, OF_FILE_DENSITY);
 
-	  if (sscanf(line, "%lf", &d) == EOF)
-	    Die(FUNCTION_NAME, "Not enough entries in density file");
+	      if (sscanf(line, "%lf", &d) == EOF)
+		Die(FUNCTION_NAME, "Not enough entries in density file");
+	    }
 
 	  /* Convert to g/cm3 */
 		  
@@ -1302,7 +1451,8 @@ void ReadIFCOFMesh(long loc0, long update)
 	      
       /* Close file */
 	      
-      fclose(fp1);
+      if (type != IFC_TYPE_MOOSE)
+	fclose(fp1);
 	      
       /* Put maximum and minimum density            */
       /* Majorant is checked in processifctetmesh.c */
@@ -1328,40 +1478,58 @@ void ReadIFCOFMesh(long loc0, long update)
 
   if (strcmp(tfile, "-1"))
     {
-      /* Open temperature file for reading */
+      if (type == IFC_TYPE_MOOSE)
+	{
+	  /* Get number of entries and cells */
 
-      if ((fp1 = fopen(tfile, "r")) == NULL)
-	Error(loc0, "Temperature file \"%s\" does not exist", tfile);
+	  i = mooseifc.nc;
+	  nc = (long)RDB[loc0 + IFC_MSH_N_CELLS];
 
-      /* Read header data */
+	  /* Temperatures are given in K */
 
-      ReadOFHeader(fp1, &n, &i, (long *)dim);
+	  mul = 1.0;
 
-      /* Reset multiplier */
+	  /* Reset index */
 
-      mul = 1.0;
+	  n = 0;
+	}
+      else
+	{
+	  /* Open temperature file for reading */
 
-      /* Get number of cells */
+	  if ((fp1 = fopen(tfile, "r")) == NULL)
+	    Error(loc0, "Temperature file \"%s\" does not exist", tfile);
 
-      nc = (long)RDB[loc0 + IFC_MSH_N_CELLS];
+	  /* Read header data */
 
-      /* Check units */
+	  ReadOFHeader(fp1, &n, &i, (long *)dim);
 
-      if (dim[3] == 1)
-	{
-	  /* K */
+	  /* Reset multiplier */
 
 	  mul = 1.0;
-	}
-      else if(dim[3] == 0)
-	{
-	  /* Header might be missing altogether (K) */
 
-	  mul = 1.0;
+	  /* Get number of cells */
+
+	  nc = (long)RDB[loc0 + IFC_MSH_N_CELLS];
+
+	  /* Check units */
+
+	  if (dim[3] == 1)
+	    {
+	      /* K */
 
+	      mul = 1.0;
+	    }
+	  else if(dim[3] == 0)
+	    {
+	      /* Header might be missing altogether (K) */
+
+	      mul = 1.0;
+
+	    }
+	  else
+	    Die(FUNCTION_NAME, "Undefined dimensions %ld", dim[3]);
 	}
-      else
-	Die(FUNCTION_NAME, "Undefined dimensions %ld", dim[3]);
 
       /* Check type */
       /*
@@ -1388,12 +1556,21 @@ void ReadIFCOFMesh(long loc0, long update)
 	      
       while (loc1 > VALID_PTR)
 	{
-	  /* Read temperature */
+	  if (type == IFC_TYPE_MOOSE)
+	    {
+	      /* Get temperature */
+
+	      T = mooseifc.T[n++];
+	    }
+	  else
+	    {
+	      /* Read temperature */
 		  
-	  line = ReadOFData(fp1, OF_FILE_TEMP);
+	      line = ReadOFData(fp1, OF_FILE_TEMP);
 
-	  if (sscanf(line, "%lf", &T) == EOF)
-	    Die(FUNCTION_NAME, "Not enough entries in temp. file");
+	      if (sscanf(line, "%lf", &T) == EOF)
+		Die(FUNCTION_NAME, "Not enough entries in temp. file");
+	    }
 		  
 	  /* Check type flag */
 
@@ -1420,7 +1597,8 @@ void ReadIFCOFMesh(long loc0, long update)
 
       /* Close file */
 	      
-      fclose(fp1);
+      if (type != IFC_TYPE_MOOSE)
+	fclose(fp1);
 	      
       /* Put maximum and minimum temperature */
 
@@ -1443,6 +1621,17 @@ void ReadIFCOFMesh(long loc0, long update)
       WDB[loc0 + IFC_MIN_TEMP] = T0;
     }
 
+  /* All fields of in-memory interface are now up to date, reset */
+  /* change list */
+
+  if (type == IFC_TYPE_MOOSE)
+    {
+      for (n = 0; n < mooseifc.nchg; n++)
+	mooseifc.flag[mooseifc.chg[n]] = NO;
+
+      mooseifc.nchg = 0;
+    }
+
   /*******************************************************************/
 
   /***** Read output mapping file ************************************/
@@ -1462,15 +1651,28 @@ void ReadIFCOFMesh(long loc0, long update)
 	      
 	  if (strcmp(mapfile, "-1"))
 	    {
-	      /* Open file for reading */
+	      if (type == IFC_TYPE_MOOSE)
+		{
+		  /* Get number of entries */
+
+		  i = mooseifc.nc;
+
+		  /* Reset index */
+
+		  j = 0;
+		}
+	      else
+		{
+		  /* Open file for reading */
 
-	      if ((fp1 = fopen(mapfile, "r")) == NULL)
-		Error(loc0, "Output map file \"%s\" does not exist", 
-		      mapfile);
+		  if ((fp1 = fopen(mapfile, "r")) == NULL)
+		    Error(loc0, "Output map file \"%s\" does not exist", 
+			  mapfile);
 
-	      /* Read header data */
+		  /* Read header data */
 		  
-	      ReadOFHeader(fp1, &n, &i, (long *)dim);
+		  ReadOFHeader(fp1, &n, &i, (long *)dim);
+		}
 		  
 	      /* Check size */
 		  
@@ -1483,13 +1685,22 @@ void ReadIFCOFMesh(long loc0, long update)
 	      loc1 = (long)RDB[loc0 + IFC_PTR_TET_MSH];
 	      while (loc1 > VALID_PTR)
 		{
-		  /* Read index */
+		  if (type == IFC_TYPE_MOOSE)
+		    {
+		      /* Get index */
+
+		      n = mooseifc.map[j++];
+		    }
+		  else
+		    {
+		      /* Read index */
 		      
-		  line = ReadOFData(fp1, OF_FILE_MAP);
+		      line = ReadOFData(fp1, OF_FILE_MAP);
 		      
-		  if (sscanf(line, "%ld", &n) == EOF)
-		    Die(FUNCTION_NAME, 
-			"Not enough entries in output map file");
+		      if (sscanf(line, "%ld", &n) == EOF)
+			Die(FUNCTION_NAME, 
+			    "Not enough entries in output map file");
+		    }
 		  
 		  /* Check value */
 		      
@@ -1507,7 +1718,8 @@ void ReadIFCOFMesh(long loc0, long update)
 		  
 	      /* Close file */
 		  
-	      fclose(fp1);
+	      if (type != IFC_TYPE_MOOSE)
+		fclose(fp1);
 	    }
 	  else
 	    {
@@ -1636,7 +1848,8 @@ void ReadIFCOFMesh(long loc0, long update)
 
       /* Read batches */
 
-      ReadOFBatches(loc0);
+      if (type != IFC_TYPE_MOOSE)
+	ReadOFBatches(loc0);
 
       /* Print out number of different cells */
       fprintf(out, "Composition of mesh:\n");
@@ -51,6 +51,13 @@ void ReadInput(char *inputfile)
   
   input = ReadTextFile(inputfile);
 
+  /* Add to hash used as snapshot key */
+
+  WDB[DATA_SNAPSHOT_KEY] = 
+    (double)(DataHash(input, strlen(input), 
+		      (unsigned long)RDB[DATA_SNAPSHOT_KEY]) 
+	     & 0x000FFFFFFFFFFFFFUL);
+
   /* Calculate number of lines */
 
   n = 0;
@@ -5107,6 +5114,17 @@ void ReadInput(char *inputfile)
 		  if ((long)RDB[loc0 + DET_WRITE_HIS] == YES)
 		    WDB[DATA_RUN_STAT_TESTS] = (double)YES;
 		}
+	      else if (!strcmp(str, "dsparse"))
+		{
+		  /* Sparse scoring buffer */
+
+		  if (j == np)
+		    Error(loc0, "Missing sparse buffer indicator after \"%s\"",
+			  str);
+		  else
+		    WDB[loc0 + DET_SPARSE] =
+		      TestParam(pname, fname, line, params[j++], PTYPE_LOGICAL);
+		}
 	      else if (!strcmp(str, "dumsh"))
 		{
 		  /* Mapping for UMSH cells */
@@ -6609,6 +6627,40 @@ void ReadInput(char *inputfile)
 
 	      WDB[ptr] = NULLPTR;	      
 	      
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "acecache"))
+	    {
+	      /***** Directory for binary ACE cache files ********************/
+	      
+	      /* Copy parameter name */
+	      
+	      strcpy (pname, params[j]);
+	      
+	      k = j + 1;
+
+	      /* Directory */
+
+	      if (k < np)
+		WDB[DATA_PTR_ACE_CACHE_PATH] = (double)PutText(params[k++]);
+	      
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "snapshot"))
+	    {
+	      /***** Warm-start snapshot file ********************************/
+	      
+	      /* Copy parameter name */
+	      
+	      strcpy (pname, params[j]);
+	      
+	      k = j + 1;
+
+	      /* File name */
+
+	      if (k < np)
+		WDB[DATA_PTR_SNAPSHOT_FNAME] = (double)PutText(params[k++]);
+	      
 	      /***************************************************************/
 	    }
 	  else if (!strcasecmp(params[j], "comp"))
@@ -6805,6 +6857,25 @@ void ReadInput(char *inputfile)
 		WDB[DATA_OPTI_MODE] = 
 		  TestParam(pname, fname, line, params[k++], PTYPE_INT, 0, 4);
 	      
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "gridhash"))
+	    {
+	      /***** Energy grid hash tables *********************************/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Number of bins (0 = no hash tables) */
+
+	      if (k < np)
+		WDB[DATA_ERG_HASH_NB] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_INT, 0, 
+			    10000000);
+
 	      /***************************************************************/
 	    }
 	  else if (!strcasecmp(params[j], "arr"))
@@ -9701,6 +9772,25 @@ void ReadInput(char *inputfile)
 		    }
 		}
 		  	      
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "crambatch"))
+	    {
+	      /***** Number of materials burned together with CRAM ***********/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Read value */
+
+	      if (k < np)
+		WDB[DATA_BURN_CRAM_BATCH] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_INT, 
+			    1, MAX_CRAM_BATCH);
+
 	      /***************************************************************/
 	    }
 	  else if (!strcasecmp(params[j], "ttacut"))
@@ -9809,6 +9899,117 @@ void ReadInput(char *inputfile)
 		  TestParam(pname, fname, line, params[k++], PTYPE_REAL, 
 			    1.0, 1000.0);
 
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "stlbvh"))
+	    {
+	      /***** Bounding volume hierarchy for STL geometries ************/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Mode */
+
+	      if (k < np)
+		WDB[DATA_STL_BVH] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_LOGICAL);
+
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "ifclat"))
+	    {
+	      /***** Interpolation lattice for point-average interfaces ******/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Number of lattice points in each direction */
+
+	      if (k < np)
+		WDB[DATA_IFC_PT_LATTICE_N] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_INT, 
+			    2, 10000);
+
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "mpicoll"))
+	    {
+	      /***** MPI collective mode for results and buffer **************/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Mode */
+
+	      if (k < np)
+		WDB[DATA_OPTI_MPI_COLL_MODE] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_INT, 
+			    MPI_COLL_MODE_BARRIER, MPI_COLL_MODE_OVERLAP);
+
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "shace"))
+	    {
+	      /***** ACE data shared within node *****************************/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Mode */
+
+	      if (k < np)
+		WDB[DATA_OPTI_SHARED_ACE] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_LOGICAL);
+
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "dtally"))
+	    {
+	      /***** Detector tallies decomposed between MPI tasks ***********/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Minimum number of bins (0 = no decomposition) */
+
+	      if (k < np)
+		WDB[DATA_OPTI_DECOMP_TALLY_MIN] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_INT, 
+			    0, 100000000);
+
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "binout"))
+	    {
+	      /***** Binary output file **************************************/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Mode */
+
+	      if (k < np)
+		WDB[DATA_BINARY_OUTPUT] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_LOGICAL);
+
 	      /***************************************************************/
 	    }
 	  else if (!strcasecmp(params[j], "shbuf"))
@@ -9827,6 +10028,88 @@ void ReadInput(char *inputfile)
 		WDB[DATA_OPTI_SHARED_BUF] = 
 		  TestParam(pname, fname, line, params[k++], PTYPE_LOGICAL);
 
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "evtrack"))
+	    {
+	      /***** Event-based transport ***********************************/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Mode */
+
+	      if (k < np)
+		WDB[DATA_OPTI_EVENT_TRANSPORT] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_LOGICAL);
+
+	      /* Bank size */
+
+	      if (k < np)
+		WDB[DATA_OPTI_EVENT_BANK_SIZE] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_INT, 
+			    1, 100000);
+
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "bufsparse"))
+	    {
+	      /***** Detector tallies scored in sparse tables ****************/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Minimum number of bins (0 = only with "dsparse") */
+
+	      if (k < np)
+		WDB[DATA_OPTI_SPARSE_TALLY_MIN] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_INT, 
+			    0, 100000000);
+
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "bufcache"))
+	    {
+	      /***** Thread-private caches for shared buffer *****************/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Number of slots (0 = no caches) */
+
+	      if (k < np)
+		WDB[DATA_OPTI_BUF_CACHE_SIZE] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_INT, 0, 
+			    1000000);
+
+	      /***************************************************************/
+	    }
+	  else if (!strcasecmp(params[j], "rng"))
+	    {
+	      /***** Random number generator *********************************/
+
+	      /* Copy parameter name */
+
+	      strcpy (pname, params[j]);
+
+	      k = j + 1;
+
+	      /* Type (1 = LCG, 2 = counter-based Philox) */
+
+	      if (k < np)
+		WDB[DATA_RNG_TYPE] = 
+		  TestParam(pname, fname, line, params[k++], PTYPE_INT, 
+			    RNG_TYPE_LCG, RNG_TYPE_PHILOX);
+
 	      /***************************************************************/
 	    }
 	  else if (!strcasecmp(params[j], "ppid"))
@@ -57,7 +57,7 @@ void ReadInterface(long loc0, long update)
 
   /* Check interface type */
 
-  CheckValue(FUNCTION_NAME, "type", "", type, IFC_TYPE_PT_AVG, IFC_TYPE_OF_SOLID);
+  CheckValue(FUNCTION_NAME, "type", "", type, IFC_TYPE_PT_AVG, IFC_TYPE_MOOSE);
 
   /* Close file for now */
 
@@ -165,6 +165,15 @@ void ReadInterface(long loc0, long update)
       break;
       /*************************************************/
 
+    case IFC_TYPE_MOOSE:
+
+      /* In-memory MOOSE mesh, read with the OpenFOAM subroutine */
+
+      ReadIFCOFMesh(loc0, update);
+
+      break;
+      /*************************************************/
+
     default:
       fclose(fp);
       Die(FUNCTION_NAME,
@@ -0,0 +1,575 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : readsnapshot.c                                 */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Restores processed data arrays from snapshot file written by */
+/*              WriteSnapshot()                                              */
+/*                                                                           */
+/* Comments: - Called after ReadInput(). Returns YES if the data was         */
+/*             restored, in which case all processing between ReadInput()    */
+/*             and the transport cycle is skipped.                           */
+/*                                                                           */
+/*           - The snapshot is used only if the key matches. The key is a    */
+/*             hash of the input files, code version, number of OpenMP       */
+/*             threads and the sizes and modification times of the data      */
+/*             library directory files, the ACE data files listed in the     */
+/*             directory files and all other files read with the input       */
+/*             (interface, STL, UMSH, pebble-bed, source and restart         */
+/*             files). Mesh and fields of in-memory MOOSE interface are      */
+/*             hashed as such. Data arrays are verified with a checksum.     */
+/*                                                                           */
+/*           - All pointers in the data arrays are array indexes, so the     */
+/*             arrays can be restored as such. Tables of sparse              */
+/*             statistics and the count of decomposed statistics (outside    */
+/*             the arrays) are restored.                                     */
+/*                                                                           */
+/*           - Not used in MPI mode, coefficient calculation or with FINIX.  */
+/*             The key is calculated also when the file does not exist, so   */
+/*             that WriteSnapshot() can use it.                              */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "ReadSnapshot:"
+
+static unsigned long DataFileStampHash(char *, char *, unsigned long);
+
+/*****************************************************************************/
+
+long ReadSnapshot()
+{
+  long ptr, loc0, loc1, n, m, nt, sz[SNAPSHOT_ARRAYS], esz[SNAPSHOT_ARRAYS];
+  long lst[8];
+  unsigned long key, h, chk;
+  char magic[8], ver[16], fname[MAX_STR], iname[MAX_STR], tmpstr[MAX_STR];
+  char path[MAX_STR];
+  void *dat[SNAPSHOT_ARRAYS];
+  FILE *fp;
+
+  /* Check file name */
+
+  if ((long)RDB[DATA_PTR_SNAPSHOT_FNAME] < VALID_PTR)
+    return NO;
+
+  /* Check mode */
+
+  if ((mpitasks > 1) || ((long)RDB[DATA_PTR_COEF0] > VALID_PTR) ||
+      ((long)RDB[DATA_PTR_FIN0] > VALID_PTR))
+    {
+      /* Print note */
+
+      Note(0, "Snapshot not used with MPI, coefficient calculation or FINIX");
+
+      /* Reset file name */
+
+      WDB[DATA_PTR_SNAPSHOT_FNAME] = NULLPTR;
+
+      /* Exit subroutine */
+
+      return NO;
+    }
+
+  /* Get file name */
+
+  strcpy(fname, GetText(DATA_PTR_SNAPSHOT_FNAME));
+
+  /***************************************************************************/
+
+  /***** Calculate key *******************************************************/
+
+  /* Input files (hash calculated in ReadInput()) */
+
+  key = (unsigned long)RDB[DATA_SNAPSHOT_KEY];
+
+  /* Code version and number of threads */
+
+  key = DataHash(CODE_VERSION, strlen(CODE_VERSION), key);
+
+  nt = (long)RDB[DATA_OMP_MAX_THREADS];
+  key = DataHash(&nt, sizeof(long), key);
+
+  /* Data library directory files (decay and fission yield files are */
+  /* read as such, ACE directory files list the data files) */
+
+  lst[0] = (long)RDB[DATA_PTR_ACEDATA_FNAME_LIST];
+  lst[1] = (long)RDB[DATA_PTR_DECDATA_FNAME_LIST];
+  lst[2] = (long)RDB[DATA_PTR_NFYDATA_FNAME_LIST];
+
+  for (m = 0; m < 3; m++)
+    if ((ptr = lst[m]) > VALID_PTR)
+      while ((long)RDB[ptr] > VALID_PTR)
+	{
+	  /* Add size and modification time */
+
+	  key = DataFileStampHash(GetText(ptr), iname, key);
+
+	  /* Add ACE data files */
+
+	  if ((m == 0) && ((fp = fopen(iname, "r")) != NULL))
+	    {
+	      /* Loop over entries (file path is the last of nine */
+	      /* values, format is checked in ReadDirectoryFile()) */
+
+	      while (1)
+		{
+		  for (n = 0; n < 9; n++)
+		    if (fscanf(fp, "%s", tmpstr) < 1)
+		      break;
+
+		  if (n < 9)
+		    break;
+
+		  key = DataFileStampHash(tmpstr, path, key);
+		}
+
+	      /* Close file */
+
+	      fclose(fp);
+	    }
+
+	  /* Next */
+
+	  ptr++;
+	}
+
+  /* Geometry and interface files (included input files are hashed */
+  /* with the input) */
+
+  loc0 = (long)RDB[DATA_PTR_IFC0];
+  while (loc0 > VALID_PTR)
+    {
+      /* Input file and OpenFOAM mesh files */
+
+      lst[0] = (long)RDB[loc0 + IFC_PTR_INPUT_FNAME];
+      lst[1] = (long)RDB[loc0 + IFC_PTR_OF_PFILE];
+      lst[2] = (long)RDB[loc0 + IFC_PTR_OF_FFILE];
+      lst[3] = (long)RDB[loc0 + IFC_PTR_OF_OFILE];
+      lst[4] = (long)RDB[loc0 + IFC_PTR_OF_NFILE];
+      lst[5] = (long)RDB[loc0 + IFC_PTR_OF_MFILE];
+      lst[6] = (long)RDB[loc0 + IFC_PTR_OF_RFILE];
+      lst[7] = (long)RDB[loc0 + IFC_PTR_OF_TFILE];
+
+      for (m = 0; m < 8; m++)
+	if (lst[m] > VALID_PTR)
+	  key = FileStampHash(GetText(lst[m]), key);
+
+      /* Output map */
+
+      if ((ptr = (long)RDB[loc0 + IFC_PTR_OF_MAPFILE]) > VALID_PTR)
+	key = FileStampHash(GetText(ptr), key);
+
+      /* Next */
+
+      loc0 = NextItem(loc0);
+    }
+
+  /* In-memory MOOSE interface (mesh and fields are passed through */
+  /* the API and the interface has no files) */
+
+  if (mooseifc.np > 0)
+    {
+      /* Sizes */
+
+      key = DataHash(&mooseifc.np, sizeof(long), key);
+      key = DataHash(&mooseifc.nf, sizeof(long), key);
+      key = DataHash(&mooseifc.nnbr, sizeof(long), key);
+      key = DataHash(&mooseifc.nc, sizeof(long), key);
+
+      /* Mesh */
+
+      key = DataHash(mooseifc.pts, 3*mooseifc.np*sizeof(double), key);
+      key = DataHash(mooseifc.fidx, (mooseifc.nf + 1)*sizeof(long), key);
+      key = DataHash(mooseifc.fpts, mooseifc.fidx[mooseifc.nf]*sizeof(long),
+		     key);
+      key = DataHash(mooseifc.own, mooseifc.nf*sizeof(long), key);
+      key = DataHash(mooseifc.nbr, mooseifc.nnbr*sizeof(long), key);
+      key = DataHash(mooseifc.map, mooseifc.nc*sizeof(long), key);
+
+      /* Temperatures and densities */
+
+      key = DataHash(mooseifc.T, mooseifc.nc*sizeof(double), key);
+      key = DataHash(mooseifc.rho, mooseifc.nc*sizeof(double), key);
+    }
+
+  /* STL geometries */
+
+  loc0 = (long)RDB[DATA_PTR_STL0];
+  while (loc0 > VALID_PTR)
+    {
+      /* Loop over files */
+
+      loc1 = (long)RDB[loc0 + STL_PTR_FILES];
+      while (loc1 > VALID_PTR)
+	{
+	  key = FileStampHash(GetText(loc1 + STL_FILE_PTR_FNAME), key);
+	  loc1 = NextItem(loc1);
+	}
+
+      /* Next */
+
+      loc0 = NextItem(loc0);
+    }
+
+  /* Unstructured mesh based geometries */
+
+  loc0 = (long)RDB[DATA_PTR_UMSH0];
+  while (loc0 > VALID_PTR)
+    {
+      /* Mesh files */
+
+      lst[0] = (long)RDB[loc0 + UMSH_PTR_POINTS_FNAME];
+      lst[1] = (long)RDB[loc0 + UMSH_PTR_FACES_FNAME];
+      lst[2] = (long)RDB[loc0 + UMSH_PTR_OWNER_FNAME];
+      lst[3] = (long)RDB[loc0 + UMSH_PTR_NEIGHBOUR_FNAME];
+      lst[4] = (long)RDB[loc0 + UMSH_PTR_MATERIALS_FNAME];
+
+      for (m = 0; m < 5; m++)
+	if (lst[m] > VALID_PTR)
+	  key = FileStampHash(GetText(lst[m]), key);
+
+      /* Mesh given in interface format */
+
+      if ((loc1 = (long)RDB[loc0 + UMSH_PTR_IFC]) > VALID_PTR)
+	{
+	  lst[0] = (long)RDB[loc1 + IFC_PTR_INPUT_FNAME];
+	  lst[1] = (long)RDB[loc1 + IFC_PTR_OF_PFILE];
+	  lst[2] = (long)RDB[loc1 + IFC_PTR_OF_FFILE];
+	  lst[3] = (long)RDB[loc1 + IFC_PTR_OF_OFILE];
+	  lst[4] = (long)RDB[loc1 + IFC_PTR_OF_NFILE];
+	  lst[5] = (long)RDB[loc1 + IFC_PTR_OF_MFILE];
+
+	  for (m = 0; m < 6; m++)
+	    if (lst[m] > VALID_PTR)
+	      key = FileStampHash(GetText(lst[m]), key);
+	}
+
+      /* Next */
+
+      loc0 = NextItem(loc0);
+    }
+
+  /* Pebble-bed geometries */
+
+  loc0 = (long)RDB[DATA_PTR_PB0];
+  while (loc0 > VALID_PTR)
+    {
+      key = FileStampHash(GetText(loc0 + PBED_PTR_FNAME), key);
+      loc0 = NextItem(loc0);
+    }
+
+  /* Source files */
+
+  loc0 = (long)RDB[DATA_PTR_SRC0];
+  while (loc0 > VALID_PTR)
+    {
+      if ((long)RDB[loc0 + SRC_READ_PTR_FILE] > VALID_PTR)
+	key = FileStampHash(GetText(loc0 + SRC_READ_PTR_FILE), key);
+
+      loc0 = NextItem(loc0);
+    }
+
+  /* Restart file */
+
+  if ((long)RDB[DATA_READ_RESTART_FILE] == YES)
+    {
+      if ((long)RDB[DATA_RESTART_READ_PTR_FNAME] > VALID_PTR)
+	key = FileStampHash(GetText(DATA_RESTART_READ_PTR_FNAME), key);
+      else
+	{
+	  sprintf(iname, "%s.wrk", GetText(DATA_PTR_INPUT_FNAME));
+	  key = FileStampHash(iname, key);
+	}
+    }
+
+  /* Store key (truncated to fit in mantissa) */
+
+  key = key & 0x000FFFFFFFFFFFFFUL;
+  WDB[DATA_SNAPSHOT_KEY] = (double)key;
+
+  /***************************************************************************/
+
+  /***** Read header *********************************************************/
+
+  /* Open file */
+
+  if ((fp = fopen(fname, "r")) == NULL)
+    return NO;
+
+  /* Read and compare */
+
+  if ((fread(magic, sizeof(char), 8, fp) != 8) ||
+      (fread(ver, sizeof(char), 16, fp) != 16) ||
+      (fread(&h, sizeof(unsigned long), 1, fp) != 1) ||
+      (fread(&nt, sizeof(long), 1, fp) != 1) ||
+      (fread(sz, sizeof(long), SNAPSHOT_ARRAYS, fp) != SNAPSHOT_ARRAYS) ||
+      (strncmp(magic, SNAPSHOT_MAGIC, 8)) ||
+      (strncmp(ver, CODE_VERSION, 16)) || (h != key) ||
+      (nt != (long)RDB[DATA_OMP_MAX_THREADS]))
+    {
+      fprintf(out, "Snapshot file \"%s\" does not match input.\n\n", fname);
+
+      fclose(fp);
+      return NO;
+    }
+
+  /***************************************************************************/
+
+  /***** Read data arrays ****************************************************/
+
+  /* Element sizes (main, ACE, ASCII, private, buffer, RES1 and RES2) */
+
+  for (n = 0; n < SNAPSHOT_ARRAYS; n++)
+    esz[n] = sizeof(double);
+
+  esz[2] = sizeof(char);
+
+  /* Reset checksum */
+
+  h = 0;
+
+  /* Loop over arrays */
+
+  for (n = 0; n < SNAPSHOT_ARRAYS; n++)
+    {
+      /* Check size */
+
+      if (sz[n] < 1)
+	{
+	  dat[n] = NULL;
+	  continue;
+	}
+
+      /* Allocate memory and read data */
+
+      dat[n] = Mem(MEM_ALLOC, sz[n], esz[n]);
+
+      if ((long)fread(dat[n], esz[n], sz[n], fp) != sz[n])
+	break;
+
+      /* Add to checksum */
+
+      h = DataHash(dat[n], sz[n]*esz[n], h);
+    }
+
+  /* Read checksum */
+
+  if ((n < SNAPSHOT_ARRAYS) || (dat[0] == NULL) ||
+      (fread(&chk, sizeof(unsigned long), 1, fp) != 1) || (chk != h))
+    {
+      Note(0, "Snapshot file \"%s\" is corrupted", fname);
+
+      /* Free memory */
+
+      for (m = 0; (m <= n) && (m < SNAPSHOT_ARRAYS); m++)
+	if (dat[m] != NULL)
+	  Mem(MEM_FREE, dat[m]);
+
+      /* Close file and exit */
+
+      fclose(fp);
+      return NO;
+    }
+
+  /* Close file */
+
+  fclose(fp);
+
+  /***************************************************************************/
+
+  /***** Replace arrays ******************************************************/
+
+  /* Remember input file name (key depends only on contents) */
+
+  strcpy(iname, GetText(DATA_PTR_INPUT_FNAME));
+
+  if (ACE != NULL)
+    Mem(MEM_FREE, ACE);
+  if (RES1 != NULL)
+    Mem(MEM_FREE, RES1);
+  if (RES2 != NULL)
+    Mem(MEM_FREE, RES2);
+  if (BUF != NULL)
+    Mem(MEM_FREE, BUF);
+  if (PRIVA != NULL)
+    Mem(MEM_FREE, PRIVA);
+  if (ASCII != NULL)
+    Mem(MEM_FREE, ASCII);
+
+  Mem(MEM_FREE, WDB);
+
+  WDB = (double *)dat[0];
+  RDB = (const double *)WDB;
+  ACE = (double *)dat[1];
+  ASCII = (char *)dat[2];
+  PRIVA = (double *)dat[3];
+  BUF = (double *)dat[4];
+  RES1 = (double *)dat[5];
+  RES2 = (double *)dat[6];
+
+  /* Put input file name and time stamp of this run */
+
+  WDB[DATA_PTR_INPUT_FNAME] = (double)PutText(iname);
+  WDB[DATA_PTR_DATE] = (double)PutText(TimeStamp());
+
+  /* Initialize secondary RNG (done in main program if not restored) */
+
+  srand48(parent_seed);
+
+  /* Sparse statistics are scored in tables outside the data arrays, */
+  /* allocated in NewSparseStat() (tables are empty between cycles) */
+
+  n = 0;
+
+  loc0 = (long)RDB[DATA_PTR_SCORE0];
+  while (loc0 > VALID_PTR)
+    {
+      if ((long)RDB[loc0 + SCORE_SPARSE] == YES)
+	if ((long)RDB[loc0 + SCORE_SPARSE_IDX] + 1 > n)
+	  n = (long)RDB[loc0 + SCORE_SPARSE_IDX] + 1;
+
+      /* Next */
+
+      loc0 = NextItem(loc0);
+    }
+
+  if (n > 0)
+    {
+      /* Number of tables per statistics */
+
+      nt = (long)RDB[DATA_OMP_MAX_THREADS];
+      CheckValue(FUNCTION_NAME, "nt", "", nt, 1, MAX_OMP_THREADS);
+
+      /* Allocate memory for empty tables */
+
+      if (spbuf.tab != NULL)
+	Mem(MEM_FREE, spbuf.tab);
+
+      spbuf.tab = (struct SparseTab *)
+	Mem(MEM_ALLOC, n*nt, sizeof(struct SparseTab));
+
+      spbuf.n = n;
+      spbuf.nt = nt;
+    }
+
+  /* Decomposed statistics are indexed in dtally (NewDecompStat()), the */
+  /* slabs must match the number of MPI tasks */
+
+  n = 0;
+
+  loc0 = (long)RDB[DATA_PTR_SCORE0];
+  while (loc0 > VALID_PTR)
+    {
+      if ((m = (long)RDB[loc0 + SCORE_DECOMP_SLAB]) > 0)
+	{
+	  /* Check slab size */
+
+	  if (m != ((long)RDB[loc0 + SCORE_STAT_SIZE] + mpitasks - 1)/mpitasks)
+	    Die(FUNCTION_NAME, 
+		"Snapshot written with different number of MPI tasks");
+
+	  /* Update count */
+
+	  if ((long)RDB[loc0 + SCORE_DECOMP_IDX] + 1 > n)
+	    n = (long)RDB[loc0 + SCORE_DECOMP_IDX] + 1;
+	}
+
+      /* Next */
+
+      loc0 = NextItem(loc0);
+    }
+
+  /* Put number of statistics (gathered slabs are allocated in */
+  /* GatherDecompStat()) */
+
+  dtally.n = n;
+
+  /* Print */
+
+  fprintf(out, "Processed data restored from snapshot file \"%s\".\n\n",
+	  fname);
+
+  /* Data was restored */
+
+  return YES;
+}
+
+/*****************************************************************************/
+
+/*****************************************************************************/
+
+/***** Add stamp of data file ************************************************/
+
+/* Resolves the file name in the same order as OpenDataFile() (as given */
+/* and under SERPENT_DATA) and adds the stamp of the first file found.  */
+/* Resolved name is returned in res. */
+
+static unsigned long DataFileStampHash(char *fname, char *res,
+				       unsigned long h)
+{
+  long n, m;
+  char *path, *base;
+  struct stat sb;
+
+  /* Try name as given */
+
+  strcpy(res, fname);
+
+  if ((stat(res, &sb) != 0) && ((path = getenv("SERPENT_DATA")) != NULL))
+    {
+      /* Get file name without directory */
+
+      if ((base = strrchr(fname, '/')) != NULL)
+	base++;
+      else
+	base = fname;
+
+      /* Loop over alternatives */
+
+      for (m = 0; m < 4; m++)
+	{
+	  /* Put name */
+
+	  if (m == 0)
+	    sprintf(res, "%s%s", path, fname);
+	  else if (m == 1)
+	    sprintf(res, "%s/%s", path, fname);
+	  else if (m == 2)
+	    sprintf(res, "%s%s", path, base);
+	  else
+	    sprintf(res, "%s/%s", path, base);
+
+	  /* Check */
+
+	  if (stat(res, &sb) == 0)
+	    break;
+	}
+
+      /* Not found, use name as given */
+
+      if (m == 4)
+	strcpy(res, fname);
+    }
+
+  /* Add name, size and modification time */
+
+  n = strlen(res);
+  h = DataHash(res, n, h);
+
+  /* Return value */
+
+  return FileStampHash(res, h);
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -104,14 +104,26 @@ void ReDistributeStacks()
 	    break;
 	  else
 	    {
-	      /* Move half of particles to other stack */
-	      
-	      for (n = 0; n < (long)(0.5*sz); n++)
-		{
-		  ptr = FromStack(type, id1);
-		  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
-		  ToStack(ptr, id0);
-		}
+	      /* Find first of the last half of particles in stack */
+
+	      ptr = (long)RDB[OMPPtr(loc0, id1)];
+	      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+	      ptr = LastItem(ptr);
+
+	      for (n = 1; n < (long)(0.5*sz); n++)
+		ptr = PrevItem(ptr);
+
+	      /* Check type (dummy cannot be moved) */
+
+	      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+	      if ((long)RDB[ptr + PARTICLE_TYPE] != type)
+		Die(FUNCTION_NAME, "Error in stack");
+
+	      /* Move particles to other stack at once */
+
+	      MoveListTail(ptr, OMPPtr(loc0, id0));
 	    }
 	}
 
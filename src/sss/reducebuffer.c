@@ -39,10 +39,31 @@ void ReduceBuffer()
   else
     WDB[DATA_BUF_REDUCED] = (double)YES;
 
-  /* Return if shared buffer */
+  /* Merge sparse buffer */
+
+  ReduceSparseBuf();
+
+  /* Check shared buffer */
 
   if ((long)RDB[DATA_OPTI_SHARED_BUF] == YES)
-    return;
+    {
+      /* Flush thread-private caches */
+
+      if ((long)RDB[DATA_PTR_PRIVA_BUF_CACHE] > VALID_PTR)
+	{
+	  nseg = (long)RDB[DATA_OMP_MAX_THREADS];
+
+#ifdef OPEN_MP
+#pragma omp parallel for private(i)
+#endif
+	  for (i = 0; i < nseg; i++)
+	    FlushBufCache(i);
+	}
+
+      /* Exit subroutine */
+
+      return;
+    }
 
   /* Number of segments */
   
@@ -0,0 +1,90 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : reducesparsebuf.c                              */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Merges thread tables of sparse scoring buffer to the first   */
+/*              table                                                        */
+/*                                                                           */
+/* Comments: - Called from ReduceBuffer(). Only used entries are visited,    */
+/*             tables are merged in thread order and cleared after that.     */
+/*             Statistics are divided between threads.                       */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "ReduceSparseBuf:"
+
+/*****************************************************************************/
+
+void ReduceSparseBuf()
+{
+  long k, i, n;
+  double *dat;
+  struct SparseTab *tab0, *tab;
+
+  /* Check sparse statistics */
+
+  if (spbuf.n == 0)
+    return;
+
+  /* Loop over statistics */
+
+#ifdef OPEN_MP
+#pragma omp parallel for private(k, i, n, dat, tab0, tab)
+#endif
+
+  for (k = 0; k < spbuf.n; k++)
+    {
+      /* Pointer to first table */
+
+      tab0 = &spbuf.tab[k*spbuf.nt];
+
+      /* Loop over other threads */
+
+      for (i = 1; i < spbuf.nt; i++)
+	{
+	  /* Pointer to table */
+
+	  tab = &spbuf.tab[k*spbuf.nt + i];
+
+	  /* Check if used */
+
+	  if (tab->n == 0)
+	    continue;
+
+	  /* Loop over entries */
+
+	  for (n = 0; n < tab->sz; n++)
+	    if (tab->key[n] > -1)
+	      {
+		/* Add to first table */
+
+		dat = SparseEntry(tab0, tab->key[n], YES);
+
+		dat[BUF_VAL] += tab->dat[n*BUF_BLOCK_SIZE + BUF_VAL];
+		dat[BUF_WGT] += tab->dat[n*BUF_BLOCK_SIZE + BUF_WGT];
+		dat[BUF_N] += tab->dat[n*BUF_BLOCK_SIZE + BUF_N];
+	      }
+
+	  /* Clear table */
+
+	  memset(tab->key, -1, tab->sz*sizeof(long));
+	  memset(tab->dat, 0, tab->sz*BUF_BLOCK_SIZE*sizeof(double));
+	  tab->n = 0;
+	}
+    }
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -16,6 +16,9 @@ extern "C" {
 /*           g^(n*2^STRIDE)*parentseed+(g^(n*2^STRIDE)-1)/(g-1)*12345mod2^64 */
 /*           efficiently.                                                    */
 /*                                                                           */
+/*           With the counter-based generator the skip is just the counter   */
+/*           value n*2^STRIDE.                                               */
+/*                                                                           */
 /*****************************************************************************/
 
 #include "header.h"
@@ -46,6 +49,12 @@ unsigned long ReInitRNG(long n0)
 	n = n0*mpitasks + mpiid;
     }
 
+  /* Counter-based generator: the history index gives the counter */
+  /* directly and the parent seed is used as key in Philox() */
+
+  if ((long)RDB[DATA_RNG_TYPE] == RNG_TYPE_PHILOX)
+    return n << STRIDE;
+
   /* Re-initialize RNG */
 
   n = n << STRIDE;
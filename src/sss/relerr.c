@@ -27,7 +27,7 @@ extern "C" {
 double RelErr(long ptr, ...)
 {
   long i, idx, nmax, n, loc0, bins, dim, stp;
-  double X, X2, Y, N;
+  double X, X2, Y, N, *dat;
   va_list argp;
   va_start (argp, ptr);
 
@@ -100,17 +100,35 @@ double RelErr(long ptr, ...)
 
   /* Get pointer to statistics */
 
+  dat = RES1;
   stp = (long)RDB[ptr + SCORE_PTR_DATA] + idx*STAT_BLOCK_SIZE;
 
+  /* Decomposed statistics are read from the copy gathered to task 0 */
+  /* during output (see GatherDecompStat()). Otherwise only the bins  */
+  /* of own slab are available and zero is returned for the others.   */
+
+  if ((long)RDB[ptr + SCORE_DECOMP_SLAB] > 0)
+    {
+      if ((dat = DecompStat(ptr)) != NULL)
+	stp = idx*STAT_BLOCK_SIZE;
+      else if ((idx = DecompIdx(ptr, idx)) < 0)
+	return 0.0;
+      else
+	{
+	  dat = RES1;
+	  stp = (long)RDB[ptr + SCORE_PTR_DATA] + idx*STAT_BLOCK_SIZE;
+	}
+    }
+
   /****************************************************************************/
 
   /***** Access data **********************************************************/
 
   /* Get sum, square sum and number of scores */
 
-  X = RES1[stp + STAT_X];
-  X2 = RES1[stp + STAT_X2];
-  N = RES1[stp + STAT_N];
+  X = dat[stp + STAT_X];
+  X2 = dat[stp + STAT_X2];
+  N = dat[stp + STAT_N];
 
   /* Check zero result */
 
@@ -0,0 +1,275 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : schedulemattasks.c                             */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Builds cost-weighted task lists for OpenMP parallel loops    */
+/*              over materials                                               */
+/*                                                                           */
+/* Comments: - Replaces MyParallelMat() in burnup, macroscopic total and     */
+/*             DT majorant loops. Instead of every thread walking the full   */
+/*             material list and claiming materials in a critical section,   */
+/*             the materials are sorted by estimated cost and dealt to       */
+/*             per-thread deques. Threads take tasks from their own deque    */
+/*             and steal from others when it runs empty (NextMatTask()).     */
+/*                                                                           */
+/*           - Cost of burnup tasks is the wall-clock time measured on the   */
+/*             previous burnup step. On the first step, and in the other     */
+/*             loops, the estimate is based on the size of the composition.  */
+/*                                                                           */
+/*           - Must be called outside the parallel region, loop is closed    */
+/*             by FinishMatTasks().                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "ScheduleMatTasks:"
+
+/* Local function for sort */
+
+int CompareMatTasks(const void *, const void *);
+
+/*****************************************************************************/
+
+void ScheduleMatTasks(long type)
+{
+  long mat, n, nt, i, j, sz, *cnt;
+  double *lst, c;
+
+  /* Check that previous loop is finished */
+
+  if (mattasks.mat != NULL)
+    Die(FUNCTION_NAME, "Previous task list not finished");
+
+  /* Number of threads */
+
+  nt = (long)RDB[DATA_OMP_MAX_THREADS];
+  CheckValue(FUNCTION_NAME, "nt", "", nt, 1, MAX_OMP_THREADS);
+
+  /* Allocate memory for cost and pointer pairs */
+
+  if ((mat = (long)RDB[DATA_PTR_M0]) > VALID_PTR)
+    sz = ListSize(mat);
+  else
+    sz = 0;
+
+  lst = (double *)Mem(MEM_ALLOC, 2*sz + 2, sizeof(double));
+
+  /***************************************************************************/
+
+  /***** Collect materials ***************************************************/
+
+  n = 0;
+
+  mat = (long)RDB[DATA_PTR_M0];
+  while (mat > VALID_PTR)
+    {
+      /* Check loop type */
+
+      if (type == MAT_TASK_BURN)
+	{
+	  /* Burnable materials not receiving inflow (flow chains are */
+	  /* burned together with the first material) */
+
+	  if (!((long)RDB[mat + MATERIAL_OPTIONS] & OPT_BURN_MAT) ||
+	      ((long)RDB[mat + MATERIAL_PTR_INFLOW] > VALID_PTR) ||
+	      ((long)RDB[mat + MATERIAL_FLOW_IDX] > 1))
+	    {
+	      mat = NextItem(mat);
+	      continue;
+	    }
+	}
+      else if (type == MAT_TASK_BURN_CI)
+	{
+	  /* Burnable materials */
+
+	  if (!((long)RDB[mat + MATERIAL_OPTIONS] & OPT_BURN_MAT))
+	    {
+	      mat = NextItem(mat);
+	      continue;
+	    }
+	}
+      else if (type == MAT_TASK_MAJORANT)
+	{
+	  /* Materials included in majorant */
+
+	  if (!((long)RDB[mat + MATERIAL_OPTIONS] & OPT_INCLUDE_MAJORANT))
+	    {
+	      mat = NextItem(mat);
+	      continue;
+	    }
+	}
+      else if (type == MAT_TASK_TMS_UPDATE)
+	{
+	  /* Materials with widened TMS temperature limits */
+
+	  if ((long)RDB[mat + MATERIAL_TMS_UPDATE] == NO)
+	    {
+	      mat = NextItem(mat);
+	      continue;
+	    }
+	}
+      else if (type != MAT_TASK_TOTALS)
+	Die(FUNCTION_NAME, "Invalid loop type %ld", type);
+
+      /* Check MPI task number (majorant is calculated by all tasks) */
+
+      if ((type != MAT_TASK_MAJORANT) &&
+	  ((long)RDB[mat + MATERIAL_MPI_ID] != -1) &&
+	  ((long)RDB[mat + MATERIAL_MPI_ID] != mpiid))
+	{
+	  mat = NextItem(mat);
+	  continue;
+	}
+
+      /* Estimate cost */
+
+      if (((type == MAT_TASK_BURN) || (type == MAT_TASK_BURN_CI)) &&
+	  (RDB[mat + MATERIAL_TASK_TIME] > 0.0))
+	{
+	  /* Measured on previous step */
+
+	  c = RDB[mat + MATERIAL_TASK_TIME];
+	}
+      else
+	{
+	  /* Size of composition (multiplied by number of materials in */
+	  /* flow chain) */
+
+	  if ((long)RDB[mat + MATERIAL_PTR_COMP] > VALID_PTR)
+	    sz = ListSize((long)RDB[mat + MATERIAL_PTR_COMP]);
+	  else
+	    sz = 1;
+
+	  if ((type == MAT_TASK_BURN) &&
+	      ((long)RDB[mat + MATERIAL_FLOW_IDX] == 1))
+	    sz = sz*(long)RDB[mat + MATERIAL_FLOW_N];
+
+	  /* Depletion is roughly quadratic in the number of nuclides, */
+	  /* other loops linear. Scale to seconds to keep comparable with */
+	  /* measured times. */
+
+	  if ((type == MAT_TASK_BURN) || (type == MAT_TASK_BURN_CI))
+	    c = 1E-8*((double)sz)*((double)sz);
+	  else
+	    c = 1E-6*((double)sz);
+	}
+
+      /* Put cost and pointer */
+
+      lst[2*n] = c;
+      lst[2*n + 1] = (double)mat;
+      n++;
+
+      /* Next material */
+
+      mat = NextItem(mat);
+    }
+
+  /***************************************************************************/
+
+  /***** Distribute to deques ************************************************/
+
+  /* Sort by decreasing cost */
+
+  if (n > 1)
+    qsort(lst, n, 2*sizeof(double), CompareMatTasks);
+
+  /* Count tasks per thread. Tasks are dealt in alternating direction */
+  /* (0, 1, ..., nt - 1, nt - 1, ..., 0) to even out the total cost. */
+
+  cnt = (long *)Mem(MEM_ALLOC, nt + 1, sizeof(long));
+
+  for (i = 0; i < n; i++)
+    {
+      if ((i/nt) % 2 == 0)
+	j = i % nt;
+      else
+	j = nt - 1 - (i % nt);
+
+      cnt[j]++;
+    }
+
+  /* Allocate memory for task list */
+
+  mattasks.mat = (long *)Mem(MEM_ALLOC, n + 1, sizeof(long));
+  mattasks.n = n;
+  mattasks.nt = nt;
+  mattasks.type = type;
+
+  /* Set deque limits */
+
+  j = 0;
+
+  for (i = 0; i < nt; i++)
+    {
+      mattasks.dq[i].head = j;
+      mattasks.dq[i].tail = j;
+      mattasks.dq[i].cur = -1;
+      mattasks.dq[i].ntask = 0;
+      mattasks.dq[i].nsteal = 0;
+      mattasks.dq[i].t0 = 0.0;
+      mattasks.dq[i].busy = 0.0;
+
+#ifdef OPEN_MP
+      omp_init_lock(&mattasks.dq[i].lock);
+#endif
+
+      j = j + cnt[i];
+    }
+
+  /* Put tasks (in decreasing order of cost within each deque) */
+
+  for (i = 0; i < n; i++)
+    {
+      if ((i/nt) % 2 == 0)
+	j = i % nt;
+      else
+	j = nt - 1 - (i % nt);
+
+      mattasks.mat[mattasks.dq[j].tail++] = (long)lst[2*i + 1];
+    }
+
+  /* Free temporary arrays */
+
+  Mem(MEM_FREE, cnt);
+  Mem(MEM_FREE, lst);
+}
+
+/*****************************************************************************/
+
+/***** Compare costs for qsort() *********************************************/
+
+int CompareMatTasks(const void *p1, const void *p2)
+{
+  const double *a, *b;
+
+  a = (const double *)p1;
+  b = (const double *)p2;
+
+  /* Decreasing cost, ties by pointer */
+
+  if (a[0] > b[0])
+    return -1;
+  else if (a[0] < b[0])
+    return 1;
+  else if (a[1] < b[1])
+    return -1;
+  else if (a[1] > b[1])
+    return 1;
+  else
+    return 0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
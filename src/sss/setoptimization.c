@@ -252,6 +252,16 @@ void SetOptimization()
   else
     WDB[DATA_OPTI_UNIONIZE_GRID] = (double)NO;
 
+  /* Use hash tables in energy grid search if grids are not unionized */
+
+  if ((long)RDB[DATA_ERG_HASH_NB] < 0)
+    {
+      if ((long)RDB[DATA_OPTI_UNIONIZE_GRID] == NO)
+	WDB[DATA_ERG_HASH_NB] = 2000.0;
+      else
+	WDB[DATA_ERG_HASH_NB] = 0.0;
+    }
+
   /* Set group constant calculation on if universe is given and off if */
   /* set to null */
 
@@ -0,0 +1,162 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : shareacedata.c                                 */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Puts ACE data in MPI-3 shared memory window, mapped by all   */
+/*              tasks within node                                            */
+/*                                                                           */
+/* Comments: - Called from ShareInputData() if "set shace 1" is given.       */
+/*             Memory is allocated by the first task of each node and data   */
+/*             is broadcast only between these tasks.                        */
+/*                                                                           */
+/*           - ACE data is read-only after this, until freed by FreeACE()    */
+/*             at the end of ProcessXSData(). The processed data in WDB is   */
+/*             shared by same-page merging for the rest of the run (see      */
+/*             MergeMainData()).                                             */
+/*                                                                           */
+/*           - Not called with MPI versions older than 3, ShareInputData()   */
+/*             resets the option and uses private copies.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "ShareACEData:"
+
+/*****************************************************************************/
+
+void ShareACEData(long sz)
+{
+
+#if defined(MPI) && (MPI_VERSION >= 3)
+
+  long tot, sz0, n;
+  int disp;
+  double *ptr;
+  MPI_Aint wsz;
+  MPI_Comm lead;
+  FILE *fp;
+
+  /* Group tasks by node (task 0 becomes first task of its node) */
+
+  if (MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, mpiid,
+			  MPI_INFO_NULL, &mpinode.comm) != MPI_SUCCESS)
+    Die(FUNCTION_NAME, "MPI Error");
+
+  MPI_Comm_rank(mpinode.comm, &mpinode.id);
+  MPI_Comm_size(mpinode.comm, &mpinode.tasks);
+
+  /* Group first tasks of each node */
+
+  if (MPI_Comm_split(MPI_COMM_WORLD, (mpinode.id == 0) ? 0 : MPI_UNDEFINED,
+		     mpiid, &lead) != MPI_SUCCESS)
+    Die(FUNCTION_NAME, "MPI Error");
+
+  /* Allocate window (memory is owned by first task) */
+
+  if (mpinode.id == 0)
+    wsz = (MPI_Aint)(sz*sizeof(double));
+  else
+    wsz = 0;
+
+  if (MPI_Win_allocate_shared(wsz, sizeof(double), MPI_INFO_NULL,
+			      mpinode.comm, &ptr, &mpinode.win)
+      != MPI_SUCCESS)
+    Die(FUNCTION_NAME, "Cannot allocate shared ACE data array for task %d",
+	mpiid);
+
+  /* Get pointer to memory of first task */
+
+  if (MPI_Win_shared_query(mpinode.win, 0, &wsz, &disp, &ptr) != MPI_SUCCESS)
+    Die(FUNCTION_NAME, "MPI Error");
+
+  /* Move data from private array in task 0 */
+
+  if (mpiid == 0)
+    {
+      /* Copy data */
+
+      memcpy(ptr, ACE, sz*sizeof(double));
+
+      /* Free private array */
+
+      Mem(MEM_FREE, ACE);
+    }
+
+  /* Put pointer */
+
+  ACE = ptr;
+
+  /* Broadcast data between nodes */
+
+  if (mpinode.id == 0)
+    {
+      /* Get batch size */
+
+      sz0 = (long)RDB[DATA_OPTI_MPI_BATCH_SIZE];
+      CheckValue(FUNCTION_NAME, "sz0", "", sz0, 1, INFTY);
+
+      /* Loop over batches */
+
+      for (tot = 0; tot < sz; tot = tot + sz0)
+	{
+	  /* Compare to total */
+
+	  if (tot + sz0 > sz)
+	    sz0 = sz - tot;
+
+	  /* Broadcast batch */
+
+	  if (MPI_Bcast(&ACE[tot], sz0, MPI_DOUBLE, 0, lead) != MPI_SUCCESS)
+	    Die(FUNCTION_NAME, "MPI Error");
+	}
+
+      /* Free communicator */
+
+      MPI_Comm_free(&lead);
+    }
+
+  /* Make data visible to all tasks within node */
+
+  MPI_Win_fence(0, mpinode.win);
+
+  /* Set flag */
+
+  mpinode.shared = YES;
+
+  fprintf(out, " - ACE data shared by %d tasks within node\n", mpinode.tasks);
+
+  /* Set merging of processed data */
+
+  mpinode.merge = YES;
+
+  /* Check that same-page merging is enabled in kernel */
+
+  n = 0;
+
+  if ((fp = fopen("/sys/kernel/mm/ksm/run", "r")) != NULL)
+    {
+      if (fscanf(fp, "%ld", &n) != 1)
+	n = 0;
+
+      fclose(fp);
+    }
+
+  if (n != 1)
+    Note(0, "Same-page merging (KSM) not enabled, processed data not shared");
+
+#endif
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
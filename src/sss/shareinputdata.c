@@ -112,16 +112,35 @@ void ShareInputData()
 
   MPI_Barrier(MPI_COMM_WORLD);
 
-  /* Allocate memory for data block in other tasks */
+#if (MPI_VERSION < 3)
 
-  if (mpiid > 0)
-    if ((ACE = Mem(MEM_ALLOC, sz, sizeof(double))) == NULL)
-      Die(FUNCTION_NAME, "Cannot initialize ACE data array for task %ld",
-	  mpiid);
+  /* Shared windows not available, use private copies */
 
-  /* Transfer data */
+  WDB[DATA_OPTI_SHARED_ACE] = (double)NO;
+
+#endif
+
+  /* Check node-shared mode */
+
+  if ((long)RDB[DATA_OPTI_SHARED_ACE] == YES)
+    {
+      /* Map single copy per node */
+
+      ShareACEData(sz);
+    }
+  else
+    {
+      /* Allocate memory for data block in other tasks */
+
+      if (mpiid > 0)
+	if ((ACE = Mem(MEM_ALLOC, sz, sizeof(double))) == NULL)
+	  Die(FUNCTION_NAME, "Cannot initialize ACE data array for task %ld",
+	      mpiid);
 
-  MPITransfer(ACE, NULL, sz, 0, MPI_METH_BC);
+      /* Transfer data */
+
+      MPITransfer(ACE, NULL, sz, 0, MPI_METH_BC);
+    }
 
   /* Synchronise */
 
@@ -0,0 +1,52 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : sparsebufval.c                                 */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Returns pointer to reduced data of bin in sparse scoring     */
+/*              buffer                                                       */
+/*                                                                           */
+/* Comments: - Returns NULL if bin was not scored. Used by BufVal() etc.     */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "SparseBufVal:"
+
+/*****************************************************************************/
+
+double *SparseBufVal(long ptr, long idx)
+{
+  long k;
+
+  /* Check pointer */
+
+  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+  /* Check that buffer is reduced */
+
+  if ((long)RDB[DATA_BUF_REDUCED] == NO)
+    Die(FUNCTION_NAME, "Scoring buffer is not reduced");
+
+  /* Get index to tables */
+
+  k = (long)RDB[ptr + SCORE_SPARSE_IDX];
+  CheckValue(FUNCTION_NAME, "k", "", k, 0, spbuf.n - 1);
+
+  /* Find entry in first table */
+
+  return SparseEntry(&spbuf.tab[k*spbuf.nt], idx, NO);
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,132 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : sparseentry.c                                  */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Finds or adds bin in sparse scoring buffer table             */
+/*                                                                           */
+/* Comments: - Open addressing with linear probing. The table is kept at     */
+/*             most half full and doubled when needed. Returns pointer to    */
+/*             value, weight and number of scores (BUF_BLOCK_SIZE values),   */
+/*             or NULL if bin is not found and add flag is not set.          */
+/*                                                                           */
+/*           - Tables are thread-private, no locks are needed.               */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "SparseEntry:"
+
+/*****************************************************************************/
+
+double *SparseEntry(struct SparseTab *tab, long idx, long add)
+{
+  long n, h, m, sz, *key;
+  double *dat, *ptr;
+
+  /* Check index */
+
+  CheckValue(FUNCTION_NAME, "idx", "", idx, 0, INFTY);
+
+  /* Check table size */
+
+  if (tab->sz == 0)
+    {
+      /* Check add flag */
+
+      if (add == NO)
+	return NULL;
+
+      /* Allocate initial table */
+
+      tab->sz = 64;
+      tab->n = 0;
+
+      tab->key = (long *)Mem(MEM_ALLOC, tab->sz, sizeof(long));
+      tab->dat = (double *)Mem(MEM_ALLOC, tab->sz*BUF_BLOCK_SIZE,
+			       sizeof(double));
+
+      /* Mark entries empty */
+
+      memset(tab->key, -1, tab->sz*sizeof(long));
+    }
+  else if ((add == YES) && (2*(tab->n + 1) > tab->sz))
+    {
+      /* Table is half full, get pointers to old data */
+
+      sz = tab->sz;
+      key = tab->key;
+      dat = tab->dat;
+
+      /* Allocate table of double size */
+
+      tab->sz = 2*sz;
+      tab->n = 0;
+
+      tab->key = (long *)Mem(MEM_ALLOC, tab->sz, sizeof(long));
+      tab->dat = (double *)Mem(MEM_ALLOC, tab->sz*BUF_BLOCK_SIZE,
+			       sizeof(double));
+
+      memset(tab->key, -1, tab->sz*sizeof(long));
+
+      /* Move entries */
+
+      for (n = 0; n < sz; n++)
+	if (key[n] > -1)
+	  {
+	    ptr = SparseEntry(tab, key[n], YES);
+	    memcpy(ptr, &dat[n*BUF_BLOCK_SIZE], BUF_BLOCK_SIZE*sizeof(double));
+	  }
+
+      /* Free old table */
+
+      Mem(MEM_FREE, key);
+      Mem(MEM_FREE, dat);
+    }
+
+  /* Calculate hash (multiplicative, size is power of two) */
+
+  m = tab->sz - 1;
+  h = (long)(((unsigned long)idx*0x9E3779B97F4A7C15UL) >> 32) & m;
+
+  /* Probe */
+
+  while (tab->key[h] > -1)
+    {
+      /* Compare */
+
+      if (tab->key[h] == idx)
+	return &tab->dat[h*BUF_BLOCK_SIZE];
+
+      /* Next */
+
+      h = (h + 1) & m;
+    }
+
+  /* Check add flag */
+
+  if (add == NO)
+    return NULL;
+
+  /* Add new entry (data is zero) */
+
+  tab->key[h] = idx;
+  tab->n++;
+
+  /* Return pointer */
+
+  return &tab->dat[h*BUF_BLOCK_SIZE];
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,191 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : stlbvhdistance.c                               */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Calculates distance to nearest STL facet along direction     */
+/*              using bounding volume hierarchy                              */
+/*                                                                           */
+/* Comments: - Used by NearestSTLSurf() when the universe has a hierarchy    */
+/*             built by BuildSTLBVH(). Returns INFTY if no facet is hit.     */
+/*                                                                           */
+/*           - Unlike in the ray test, intersections near edges are          */
+/*             accepted (with small tolerance), since the distance is used   */
+/*             for surface tracking and must not skip over any facet.        */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "STLBVHDistance:"
+
+/*****************************************************************************/
+
+double STLBVHDistance(long bvh, double x, double y, double z, double u,
+		      double v, double w)
+{
+  long node, tri, n, i, ns, stack[2*STL_BVH_MAX_DEPTH];
+  double iu, iv, iw, t0, t1, tmin, tmax, min, l;
+  double e1x, e1y, e1z, e2x, e2y, e2z, px, py, pz, qx, qy, qz;
+  double sx, sy, sz, det, b1, b2;
+
+  /* Check pointer */
+
+  CheckPointer(FUNCTION_NAME, "(bvh)", DATA_ARRAY, bvh);
+
+  /* Inverse direction cosines for slab test */
+
+  iu = (u != 0.0) ? 1.0/u : INFTY;
+  iv = (v != 0.0) ? 1.0/v : INFTY;
+  iw = (w != 0.0) ? 1.0/w : INFTY;
+
+  /* Reset minimum distance */
+
+  min = INFTY;
+
+  /* Put root node in stack */
+
+  stack[0] = (long)RDB[bvh + STL_BVH_PTR_NODES];
+  ns = 1;
+
+  /* Traverse tree */
+
+  while (ns > 0)
+    {
+      /* Pop node */
+
+      node = stack[--ns];
+      CheckPointer(FUNCTION_NAME, "(node)", DATA_ARRAY, node);
+
+      /* Slab test */
+
+      t0 = (RDB[node + STL_BVH_NODE_XMIN] - x)*iu;
+      t1 = (RDB[node + STL_BVH_NODE_XMAX] - x)*iu;
+
+      tmin = (t0 < t1) ? t0 : t1;
+      tmax = (t0 < t1) ? t1 : t0;
+
+      t0 = (RDB[node + STL_BVH_NODE_YMIN] - y)*iv;
+      t1 = (RDB[node + STL_BVH_NODE_YMAX] - y)*iv;
+
+      if (t0 > t1)
+	{
+	  l = t0;
+	  t0 = t1;
+	  t1 = l;
+	}
+
+      if (t0 > tmin)
+	tmin = t0;
+      if (t1 < tmax)
+	tmax = t1;
+
+      t0 = (RDB[node + STL_BVH_NODE_ZMIN] - z)*iw;
+      t1 = (RDB[node + STL_BVH_NODE_ZMAX] - z)*iw;
+
+      if (t0 > t1)
+	{
+	  l = t0;
+	  t0 = t1;
+	  t1 = l;
+	}
+
+      if (t0 > tmin)
+	tmin = t0;
+      if (t1 < tmax)
+	tmax = t1;
+
+      /* Check miss or node beyond current minimum */
+
+      if ((tmax < 0.0) || (tmin > tmax) || (tmin > min))
+	continue;
+
+      /* Check interior node */
+
+      if ((n = (long)RDB[node + STL_BVH_NODE_N]) == 0)
+	{
+	  /* Check stack size */
+
+	  if (ns > 2*STL_BVH_MAX_DEPTH - 2)
+	    Die(FUNCTION_NAME, "Stack overflow");
+
+	  /* Push children */
+
+	  stack[ns++] = (long)RDB[node + STL_BVH_NODE_PTR];
+	  stack[ns++] = (long)RDB[node + STL_BVH_NODE_PTR] +
+	    STL_BVH_NODE_BLOCK_SIZE;
+
+	  /* Cycle loop */
+
+	  continue;
+	}
+
+      /* Loop over triangles in leaf */
+
+      tri = (long)RDB[node + STL_BVH_NODE_PTR];
+
+      for (i = 0; i < n; i++, tri = tri + STL_BVH_TRI_BLOCK_SIZE)
+	{
+	  /* Get edge vectors */
+
+	  e1x = RDB[tri + STL_BVH_TRI_E1X];
+	  e1y = RDB[tri + STL_BVH_TRI_E1Y];
+	  e1z = RDB[tri + STL_BVH_TRI_E1Z];
+	  e2x = RDB[tri + STL_BVH_TRI_E2X];
+	  e2y = RDB[tri + STL_BVH_TRI_E2Y];
+	  e2z = RDB[tri + STL_BVH_TRI_E2Z];
+
+	  /* Determinant */
+
+	  px = v*e2z - w*e2y;
+	  py = w*e2x - u*e2z;
+	  pz = u*e2y - v*e2x;
+
+	  if ((det = e1x*px + e1y*py + e1z*pz) == 0.0)
+	    continue;
+
+	  /* Barycentric coordinates */
+
+	  sx = x - RDB[tri + STL_BVH_TRI_X0];
+	  sy = y - RDB[tri + STL_BVH_TRI_Y0];
+	  sz = z - RDB[tri + STL_BVH_TRI_Z0];
+
+	  if ((b1 = (sx*px + sy*py + sz*pz)/det) < -1E-9)
+	    continue;
+
+	  qx = sy*e1z - sz*e1y;
+	  qy = sz*e1x - sx*e1z;
+	  qz = sx*e1y - sy*e1x;
+
+	  if ((b2 = (u*qx + v*qy + w*qz)/det) < -1E-9)
+	    continue;
+	  else if (b1 + b2 > 1.0 + 1E-9)
+	    continue;
+
+	  /* Distance */
+
+	  l = (e2x*qx + e2y*qy + e2z*qz)/det;
+
+	  /* Compare to minimum */
+
+	  if ((l > 0.0) && (l < min))
+	    min = l;
+	}
+    }
+
+  /* Return minimum distance */
+
+  return min;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
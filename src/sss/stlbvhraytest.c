@@ -0,0 +1,290 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : stlbvhraytest.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Performs STL ray test using bounding volume hierarchy        */
+/*                                                                           */
+/* Comments: - Replacement for the search mesh walk in STLRayTest(), used    */
+/*             when the solid has a hierarchy built by BuildSTLBVH().        */
+/*             Return values are the same. Since no mesh cell boundaries     */
+/*             are crossed, the ray can't fail because of being parallel to  */
+/*             the mesh or getting stuck in it.                              */
+/*                                                                           */
+/*           - Ray-triangle intersections use the Moller-Trumbore method.    */
+/*             Barycentric coordinates are compared to the same exclusion    */
+/*             distance as in STLFacetDistance().                            */
+/*                                                                           */
+/*           - In fast mode, the nearest intersection decides, in safe mode  */
+/*             the number of crossings along the full ray.                   */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "STLBVHRayTest:"
+
+/*****************************************************************************/
+
+long STLBVHRayTest(long bvh, double x, double y, double z, double u,
+		   double v, double w, long mode)
+{
+  long node, tri, fct, n, i, ns, cross, stack[2*STL_BVH_MAX_DEPTH];
+  double iu, iv, iw, t0, t1, tmin, tmax, ex, d, dir, dir0;
+  double e1x, e1y, e1z, e2x, e2y, e2z, px, py, pz, qx, qy, qz;
+  double sx, sy, sz, det, b0, b1, b2, l;
+
+  /* Check pointer and mode */
+
+  CheckPointer(FUNCTION_NAME, "(bvh)", DATA_ARRAY, bvh);
+
+  if ((mode != STL_SEARCH_MODE_FAST) && (mode != STL_SEARCH_MODE_SAFE))
+    Die(FUNCTION_NAME, "Invalid mode");
+
+  /* Inverse direction cosines for slab test */
+
+  iu = (u != 0.0) ? 1.0/u : INFTY;
+  iv = (v != 0.0) ? 1.0/v : INFTY;
+  iw = (w != 0.0) ? 1.0/w : INFTY;
+
+  /* Exclusion distance */
+
+  ex = RDB[DATA_STL_FACET_EXD];
+
+  /* Reset minimum distance, direction and number of crossings */
+
+  d = INFTY;
+  dir0 = INFTY;
+  cross = 0;
+
+  /* Put root node in stack */
+
+  stack[0] = (long)RDB[bvh + STL_BVH_PTR_NODES];
+  ns = 1;
+
+  /* Traverse tree */
+
+  while (ns > 0)
+    {
+      /* Pop node */
+
+      node = stack[--ns];
+      CheckPointer(FUNCTION_NAME, "(node)", DATA_ARRAY, node);
+
+      /***********************************************************************/
+
+      /***** Slab test *******************************************************/
+
+      t0 = (RDB[node + STL_BVH_NODE_XMIN] - x)*iu;
+      t1 = (RDB[node + STL_BVH_NODE_XMAX] - x)*iu;
+
+      tmin = (t0 < t1) ? t0 : t1;
+      tmax = (t0 < t1) ? t1 : t0;
+
+      t0 = (RDB[node + STL_BVH_NODE_YMIN] - y)*iv;
+      t1 = (RDB[node + STL_BVH_NODE_YMAX] - y)*iv;
+
+      if (t0 > t1)
+	{
+	  l = t0;
+	  t0 = t1;
+	  t1 = l;
+	}
+
+      if (t0 > tmin)
+	tmin = t0;
+      if (t1 < tmax)
+	tmax = t1;
+
+      t0 = (RDB[node + STL_BVH_NODE_ZMIN] - z)*iw;
+      t1 = (RDB[node + STL_BVH_NODE_ZMAX] - z)*iw;
+
+      if (t0 > t1)
+	{
+	  l = t0;
+	  t0 = t1;
+	  t1 = l;
+	}
+
+      if (t0 > tmin)
+	tmin = t0;
+      if (t1 < tmax)
+	tmax = t1;
+
+      /* Check miss (in fast mode also nodes beyond nearest hit) */
+
+      if ((tmax < 0.0) || (tmin > tmax))
+	continue;
+      else if ((mode == STL_SEARCH_MODE_FAST) && (tmin > d))
+	continue;
+
+      /***********************************************************************/
+
+      /***** Interior node ***************************************************/
+
+      if ((n = (long)RDB[node + STL_BVH_NODE_N]) == 0)
+	{
+	  /* Check stack size */
+
+	  if (ns > 2*STL_BVH_MAX_DEPTH - 2)
+	    Die(FUNCTION_NAME, "Stack overflow");
+
+	  /* Push children */
+
+	  stack[ns++] = (long)RDB[node + STL_BVH_NODE_PTR];
+	  stack[ns++] = (long)RDB[node + STL_BVH_NODE_PTR] +
+	    STL_BVH_NODE_BLOCK_SIZE;
+
+	  /* Cycle loop */
+
+	  continue;
+	}
+
+      /***********************************************************************/
+
+      /***** Leaf node *******************************************************/
+
+      /* Pointer to first triangle */
+
+      tri = (long)RDB[node + STL_BVH_NODE_PTR];
+
+      /* Loop over triangles */
+
+      for (i = 0; i < n; i++, tri = tri + STL_BVH_TRI_BLOCK_SIZE)
+	{
+	  /* Get edge vectors */
+
+	  e1x = RDB[tri + STL_BVH_TRI_E1X];
+	  e1y = RDB[tri + STL_BVH_TRI_E1Y];
+	  e1z = RDB[tri + STL_BVH_TRI_E1Z];
+	  e2x = RDB[tri + STL_BVH_TRI_E2X];
+	  e2y = RDB[tri + STL_BVH_TRI_E2Y];
+	  e2z = RDB[tri + STL_BVH_TRI_E2Z];
+
+	  /* Determinant */
+
+	  px = v*e2z - w*e2y;
+	  py = w*e2x - u*e2z;
+	  pz = u*e2y - v*e2x;
+
+	  det = e1x*px + e1y*py + e1z*pz;
+
+	  /* Ray in the plane of the facet can't cross it */
+
+	  if (det == 0.0)
+	    continue;
+
+	  /* Barycentric coordinates */
+
+	  sx = x - RDB[tri + STL_BVH_TRI_X0];
+	  sy = y - RDB[tri + STL_BVH_TRI_Y0];
+	  sz = z - RDB[tri + STL_BVH_TRI_Z0];
+
+	  b1 = (sx*px + sy*py + sz*pz)/det;
+
+	  qx = sy*e1z - sz*e1y;
+	  qy = sz*e1x - sx*e1z;
+	  qz = sx*e1y - sy*e1x;
+
+	  b2 = (u*qx + v*qy + w*qz)/det;
+	  b0 = 1.0 - b1 - b2;
+
+	  /* Distance */
+
+	  l = (e2x*qx + e2y*qy + e2z*qz)/det;
+
+	  /* Check if safely outside, behind or beyond nearest hit */
+
+	  if ((b0 < -ex) || (b1 < -ex) || (b2 < -ex) || (l <= 0.0) ||
+	      ((mode == STL_SEARCH_MODE_FAST) && (l > d)))
+	    continue;
+
+	  /* Pointer to facet */
+
+	  fct = (long)RDB[tri + STL_BVH_TRI_PTR_FACET];
+	  CheckPointer(FUNCTION_NAME, "(fct)", DATA_ARRAY, fct);
+
+	  /* Calculate cosine between direction and normal */
+
+	  dir = u*RDB[fct + STL_FACET_NORM_U] + v*RDB[fct + STL_FACET_NORM_V]
+	    + w*RDB[fct + STL_FACET_NORM_W];
+
+	  /* Check failure */
+
+	  if (fabs(dir) < 0.001)
+	    {
+	      /* Ray is too parallel to facet */
+
+	      return STL_RAY_TEST_FAIL_PARA;
+	    }
+	  else if ((b0 <= ex) || (b1 <= ex) || (b2 <= ex))
+	    {
+	      /* Intersection point is too close to edge */
+
+	      return STL_RAY_TEST_FAIL_EDGE;
+	    }
+	  else if (mode == STL_SEARCH_MODE_SAFE)
+	    {
+	      /* Add to number of crossings */
+
+	      cross++;
+	    }
+	  else if ((d != INFTY) && (l == d))
+	    {
+	      /* Two facets overlap */
+
+	      return STL_FACET_OVERLAP;
+	    }
+	  else
+	    {
+	      /* Remember distance and direction */
+
+	      d = l;
+	      dir0 = dir;
+	    }
+	}
+    }
+
+  /***************************************************************************/
+
+  /***** Result **************************************************************/
+
+  /* Check mode */
+
+  if (mode == STL_SEARCH_MODE_SAFE)
+    {
+      /* Check number of crossings */
+
+      if (cross % 2)
+	return YES;
+      else
+	return NO;
+    }
+  else if (d == INFTY)
+    {
+      /* No facets in direction, must be outside */
+
+      return NO;
+    }
+
+  /* Check direction */
+
+  CheckValue(FUNCTION_NAME, "dir0", "", dir0, -1.0, 1.0);
+
+  if (dir0 < 0.0)
+    return NO;
+  else
+    return YES;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -43,6 +43,11 @@ long STLRayTest(long sld, long msh, double x, double y, double z,
   CheckValue(FUNCTION_NAME, "v", "", v, -1.0, 1.0);
   CheckValue(FUNCTION_NAME, "w", "", w, -1.0, 1.0);
 
+  /* Use bounding volume hierarchy if available */
+
+  if ((ptr = (long)RDB[sld + STL_SOLID_PTR_BVH]) > VALID_PTR)
+    return STLBVHRayTest(ptr, x, y, z, u, v, w, mode);
+
   /* Check if ray is too parallel to search mesh cell boundaries */
 
   if ((fabs(u) < 0.001) || (fabs(v) < 0.001) || (fabs(w) < 0.001))
@@ -24,6 +24,8 @@ extern "C" {
 
 void ToQue(long ptr, long id)
 {
+  long prev;
+
   /* Check id */
 
   if ((id < 0) || (id > (long)RDB[DATA_OMP_MAX_THREADS] - 1))
@@ -37,14 +39,15 @@ void ToQue(long ptr, long id)
 
   AddItem(OMPPtr(DATA_PART_PTR_QUE, id), ptr);
 
-  /* Sort list to transport neutrons before photons */
+  /* Keep list sorted to transport neutrons before photons. The que */
+  /* is already sorted, so the new item is only moved left past the  */
+  /* items of higher type (same order as with SortList()). */
 
   if (((long)RDB[DATA_PHOTON_TRANSPORT_MODE] == YES) &&
       ((long)RDB[DATA_NEUTRON_TRANSPORT_MODE] == YES))
-    {
-      ptr = (long)RDB[OMPPtr(DATA_PART_PTR_QUE, id)];
-      SortList(ptr, PARTICLE_TYPE, SORT_MODE_ASCEND);
-    }
+    while (((prev = PrevItem(ptr)) > VALID_PTR) &&
+	   (RDB[prev + PARTICLE_TYPE] > RDB[ptr + PARTICLE_TYPE]))
+      MoveItemRight(prev);
 }
 
 /*****************************************************************************/
@@ -0,0 +1,1033 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : trackingevent.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Event-based tracking loop for criticality source simulation  */
+/*                                                                           */
+/* Comments: - Alternative to Tracking(). A bank of particles is taken from  */
+/*             the que / source and each event (cross section lookup,        */
+/*             move, collision, surface crossing) is processed for all       */
+/*             particles in the bank before moving to the next one. The      */
+/*             physics is the same as in Tracking().                         */
+/*                                                                           */
+/*           - Particle data is stored in a pre-allocated private work       */
+/*             array as structure of arrays (EVB_* in locations.h).          */
+/*                                                                           */
+/*           - Each slot has its own random number sequence and secondary  */
+/*             que that are swapped in before processing it, so that         */
+/*             secondaries continue the history that produced them (same as  */
+/*             in Tracking()) and results do not depend on bank size.        */
+/*                                                                           */
+/*           - Geometry routines leave the location of the particle in       */
+/*             thread-private data that is read in scoring and collision     */
+/*             routines. WhereAmI() is called again before processing a      */
+/*             collision or a boundary event, and the collision counter      */
+/*             (key of stored values) and the forced delta-tracking flag are */
+/*             stored for each slot.                                         */
+/*                                                                           */
+/*           - Used only in criticality source mode without event            */
+/*             recording (checked in InitHistories()).                       */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "TrackingEvent:"
+
+/*****************************************************************************/
+
+void TrackingEvent(long id)
+{
+  long part, cell, mat, type, ptr, trk, mode, bc, n, nb, k, m, ncol, nsurf;
+  long loop, lmax, active, que0, evq, pcol, pdtf;
+  double *dat, *bpart, *btype, *bcell, *bmat, *btrk, *bloop, *blmax, *bgmax;
+  double *bseed, *x, *y, *z, *u, *v, *w, *E, *wgt, *t, *x0, *y0, *z0, *spd;
+  double *minxs, *totxs, *majorant, *xs, *colq, *surfq, *bncol, *bdtf;
+  double l, dt, g, nctot;
+
+  /* Seeds are stored in the double array */
+
+  if (sizeof(unsigned long) > sizeof(double))
+    Die(FUNCTION_NAME, "Seed does not fit in work array");
+
+  /* Get bank size */
+
+  nb = (long)RDB[DATA_OPTI_EVENT_BANK_SIZE];
+  CheckValue(FUNCTION_NAME, "nb", "", nb, 1, 1000000);
+
+  /* Get pointer to work array */
+
+  dat = WorkArray(DATA_PTR_WORK_PRIVA_EVENT, PRIVA_ARRAY, nb*EVB_VARIABLES,
+		  id);
+
+  /* Set pointers to variables */
+
+  bpart = &dat[EVB_PART*nb];
+  btype = &dat[EVB_TYPE*nb];
+  bcell = &dat[EVB_CELL*nb];
+  bmat = &dat[EVB_MAT*nb];
+  btrk = &dat[EVB_TRK*nb];
+  bloop = &dat[EVB_LOOP*nb];
+  blmax = &dat[EVB_LMAX*nb];
+  bgmax = &dat[EVB_GMAX*nb];
+  bseed = &dat[EVB_SEED*nb];
+  x = &dat[EVB_X*nb];
+  y = &dat[EVB_Y*nb];
+  z = &dat[EVB_Z*nb];
+  u = &dat[EVB_U*nb];
+  v = &dat[EVB_V*nb];
+  w = &dat[EVB_W*nb];
+  E = &dat[EVB_E*nb];
+  wgt = &dat[EVB_WGT*nb];
+  t = &dat[EVB_T*nb];
+  x0 = &dat[EVB_X0*nb];
+  y0 = &dat[EVB_Y0*nb];
+  z0 = &dat[EVB_Z0*nb];
+  spd = &dat[EVB_SPD*nb];
+  minxs = &dat[EVB_MINXS*nb];
+  totxs = &dat[EVB_TOTXS*nb];
+  majorant = &dat[EVB_MAJ*nb];
+  xs = &dat[EVB_XS*nb];
+  colq = &dat[EVB_COL_QUE*nb];
+  surfq = &dat[EVB_SURF_QUE*nb];
+  bncol = &dat[EVB_NCOL*nb];
+  bdtf = &dat[EVB_DT_FORCE*nb];
+
+  /* Pointers to collision counter and forced delta-tracking flag */
+
+  pcol = (long)RDB[DATA_PTR_COLLISION_COUNT];
+  CheckPointer(FUNCTION_NAME, "(pcol)", PRIVA_ARRAY, pcol);
+
+  pdtf = (long)RDB[DATA_DT_ENFORCE_NEXT_TRACK];
+  CheckPointer(FUNCTION_NAME, "(pdtf)", PRIVA_ARRAY, pdtf);
+
+  /* Reset bank (work array is zeroed, seeds are set when slot is filled) */
+
+  for (k = 0; k < nb; k++)
+    {
+      bpart[k] = -1.0;
+      bgmax[k] = -1.0;
+      memcpy(&bseed[k], &SEED[id*RNG_SZ], sizeof(unsigned long));
+    }
+
+  /* Remember que of thread and get pointer to slot ques */
+
+  que0 = (long)RDB[OMPPtr(DATA_PART_PTR_QUE, id)];
+  CheckPointer(FUNCTION_NAME, "(que0)", DATA_ARRAY, que0);
+
+  evq = (long)RDB[DATA_PART_PTR_EVB_QUE];
+  CheckPointer(FUNCTION_NAME, "(evq)", DATA_ARRAY, evq);
+
+  evq = evq + id*nb;
+
+  /* Avoid compiler warning */
+
+  trk = -1;
+  lmax = -1;
+
+  /* Loop until bank, que and source are empty */
+
+  while (1 == 1)
+    {
+      /***********************************************************************/
+
+      /***** Fill bank *******************************************************/
+
+      /* Reset number of active particles */
+
+      active = 0;
+
+      /* Loop over bank */
+
+      for (k = 0; k < nb; k++)
+	{
+	  /* Check if slot is in use */
+
+	  if ((long)bpart[k] > VALID_PTR)
+	    {
+	      /* Add to count */
+
+	      active++;
+
+	      /* Cycle loop */
+
+	      continue;
+	    }
+
+	  /* Loop until slot is filled or no particles are left */
+
+	  while (1 == 1)
+	    {
+	      /* Swap in random number sequence and que of slot */
+
+	      memcpy(&SEED[id*RNG_SZ], &bseed[k], sizeof(unsigned long));
+	      WDB[OMPPtr(DATA_PART_PTR_QUE, id)] = RDB[evq + k];
+
+	      /* Get next particle from que */
+
+	      if ((part = FromQue(id)) < VALID_PTR)
+		{
+		  /* Que is empty, close the previous source chain of */
+		  /* this slot (same as end of Tracking()) */
+
+		  if ((n = (long)bgmax[k]) > -1)
+		    {
+		      /* Add to mean prompt chain length */
+
+		      if (n > 0)
+			{
+			  ptr = (long)RDB[RES_PROMPT_CHAIN_LENGTH];
+			  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY,
+				       ptr);
+			  AddBuf1D(n, 1.0, ptr, id, 0);
+			}
+
+		      /* Check maximum generation */
+
+		      if (n > (long)RDB[DATA_MAX_PROMPT_CHAIN_LENGTH])
+			n = (long)RDB[DATA_MAX_PROMPT_CHAIN_LENGTH];
+
+		      /* Add to prompt generation fractions and time */
+
+		      if ((ptr = (long)RDB[RES_PROMPT_GEN_CUMU]) > VALID_PTR)
+			for (m = 0; m < n + 1; m++)
+			  AddBuf1D(1.0, 1.0, ptr, id, m);
+
+		      if ((ptr = (long)RDB[RES_PROMPT_GEN_TIMES]) > VALID_PTR)
+			AddBuf1D(t[k], 1.0, ptr, id, n);
+
+		      /* Reset */
+
+		      bgmax[k] = -1.0;
+		    }
+
+		  /* Get next particle from source (sets random number */
+		  /* sequence and puts particle in que) */
+
+		  if (FromSrc(id) < VALID_PTR)
+		    break;
+
+		  /* Get particle from que (may be banked by time cut-off) */
+
+		  if ((part = FromQue(id)) < VALID_PTR)
+		    continue;
+
+		  /* Start new source chain */
+
+		  ptr = (long)RDB[DATA_PTR_OMP_HISTORY_COUNT];
+		  AddPrivateData(ptr, 1.0, id);
+
+		  bgmax[k] = 0.0;
+
+		  /* Score source rate for weight window current */
+
+		  ScoreWWDCurr(RDB[part + PARTICLE_X], RDB[part + PARTICLE_Y],
+			       RDB[part + PARTICLE_Z], RDB[part + PARTICLE_U],
+			       RDB[part + PARTICLE_V], RDB[part + PARTICLE_W],
+			       YES, id);
+		}
+
+	      /* Check multiplicity */
+
+	      if ((long)RDB[part + PARTICLE_MULTIPLICITY] > 0)
+		Die(FUNCTION_NAME, "Multiplicity");
+
+	      /* Check MPI index */
+
+	      if ((long)RDB[part + PARTICLE_MPI_ID] != mpiid)
+		{
+		  /* Check reproducibility */
+
+		  if ((long)RDB[DATA_OPTI_MPI_REPRODUCIBILITY] == NO)
+		    Die(FUNCTION_NAME, "Error in mpi mode");
+
+		  /* Put particle back in stack */
+
+		  ToStack(part, id);
+
+		  /* Cycle loop */
+
+		  continue;
+		}
+
+	      /* Get particle type */
+
+	      type = (long)RDB[part + PARTICLE_TYPE];
+
+	      /* Check generation cut-off */
+
+	      if ((long)RDB[part + PARTICLE_GEN_IDX] >=
+		  (long)RDB[DATA_GEN_CUT])
+		{
+		  /* Score cut-off */
+
+		  ptr = (long)RDB[RES_TOT_NEUTRON_CUTRATE];
+		  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+		  AddBuf1D(1.0, RDB[part + PARTICLE_WGT], ptr, id, 0);
+
+		  /* Put particle back in stack */
+
+		  ToStack(part, id);
+
+		  /* Cycle loop */
+
+		  continue;
+		}
+
+	      /* Check generation index */
+
+	      if (RDB[part + PARTICLE_GEN_IDX] > bgmax[k])
+		bgmax[k] = RDB[part + PARTICLE_GEN_IDX];
+
+	      /* Add to population */
+
+	      if ((ptr = (long)RDB[RES_PROMPT_GEN_POP]) > VALID_PTR)
+		AddBuf1D(1.0, 1.0, ptr, id,
+			 (long)RDB[part + PARTICLE_GEN_IDX]);
+
+	      /* Get coordinates, direction cosines, energy, weight */
+	      /* and time */
+
+	      x[k] = RDB[part + PARTICLE_X];
+	      y[k] = RDB[part + PARTICLE_Y];
+	      z[k] = RDB[part + PARTICLE_Z];
+
+	      x0[k] = x[k];
+	      y0[k] = y[k];
+	      z0[k] = z[k];
+
+	      u[k] = RDB[part + PARTICLE_U];
+	      v[k] = RDB[part + PARTICLE_V];
+	      w[k] = RDB[part + PARTICLE_W];
+
+	      E[k] = RDB[part + PARTICLE_E];
+	      wgt[k] = RDB[part + PARTICLE_WGT];
+	      t[k] = RDB[part + PARTICLE_T];
+
+	      /* Check with cut-off */
+
+	      if ((t[k] < RDB[DATA_TIME_CUT_TMIN]) ||
+		  (t[k] >= RDB[DATA_TIME_CUT_TMAX]))
+		Die(FUNCTION_NAME, "Error in time (%1.2E : %1.2E %1.2E)",
+		    t[k], RDB[DATA_TIME_CUT_TMIN], RDB[DATA_TIME_CUT_TMAX]);
+
+	      /* Apply weight window */
+
+	      if (WeightWindow(-1, part, x[k], y[k], z[k], u[k], v[k], w[k],
+			       E[k], &wgt[k], t[k], NO, id) == TRACK_END_WCUT)
+		continue;
+
+	      /* Find initial location */
+
+	      cell = WhereAmI(x[k], y[k], z[k], u[k], v[k], w[k], id);
+	      CheckPointer(FUNCTION_NAME, "(cell)", DATA_ARRAY, cell);
+
+	      /* Get material pointer */
+
+	      mat = (long)RDB[cell + CELL_PTR_MAT];
+	      mat = MatPtr(mat, id);
+
+	      /* Store starting point in history array */
+
+	      StoreHistoryPoint(part, mat, -1, x[k], y[k], z[k], u[k], v[k],
+				w[k], E[k], t[k], wgt[k], -1.0,
+				TRACK_END_STRT);
+
+	      /* Get maximum number of loops */
+
+	      if (type == PARTICLE_TYPE_NEUTRON)
+		lmax = (long)RDB[DATA_NEUTRON_MAX_TRACK_LOOP];
+	      else if (type == PARTICLE_TYPE_GAMMA)
+		lmax = (long)RDB[DATA_PHOTON_MAX_TRACK_LOOP];
+	      else
+		Die(FUNCTION_NAME, "Invalid particle type");
+
+	      CheckValue(FUNCTION_NAME, "lmax", "", lmax, 1, 100000000000);
+
+	      /* Put particle in slot */
+
+	      bpart[k] = (double)part;
+	      btype[k] = (double)type;
+	      bcell[k] = (double)cell;
+	      bmat[k] = (double)mat;
+	      btrk[k] = -1.0;
+	      bloop[k] = 0.0;
+	      blmax[k] = (double)lmax;
+	      bdtf[k] = (double)NO;
+
+	      /* Add to count */
+
+	      active++;
+
+	      /* Break loop */
+
+	      break;
+	    }
+
+	  /* Store random number sequence of slot */
+
+	  memcpy(&bseed[k], &SEED[id*RNG_SZ], sizeof(unsigned long));
+	}
+
+      /* Check if bank is empty */
+
+      if (active == 0)
+	break;
+
+      /***********************************************************************/
+
+      /***** Cross section lookup event **************************************/
+
+      for (k = 0; k < nb; k++)
+	{
+	  /* Check slot */
+
+	  if ((part = (long)bpart[k]) < VALID_PTR)
+	    continue;
+
+	  /* Swap in random number sequence (used in ures sampling) */
+
+	  memcpy(&SEED[id*RNG_SZ], &bseed[k], sizeof(unsigned long));
+
+	  /* Get type and material */
+
+	  type = (long)btype[k];
+	  mat = (long)bmat[k];
+
+	  /* Check photon energy */
+
+	  if (type == PARTICLE_TYPE_GAMMA)
+	    if (E[k] < RDB[DATA_PHOTON_EMIN])
+	      Die(FUNCTION_NAME, "Photon energy below minimum");
+
+	  /* Calculate speed */
+
+	  spd[k] = Speed(type, E[k]);
+	  CheckValue(FUNCTION_NAME, "spd", "", spd[k], ZERO, INFTY);
+
+	  /* Get minimum cross section */
+
+	  minxs[k] = MinXS(type, spd[k], id);
+
+	  /* Add to track counter */
+
+	  AddPrivateData(pcol, 1.0, id);
+
+	  /* Remember collision number of slot */
+
+	  bncol[k] = GetPrivateData(pcol, id);
+
+	  /* Get total cross section and majorant */
+
+	  totxs[k] = TotXS(mat, type, E[k], id);
+	  majorant[k] = DTMajorant(type, E[k], id);
+
+	  /* Compare majorant to minimum */
+
+	  if (majorant[k] < minxs[k])
+	    majorant[k] = minxs[k];
+
+	  /* Check cross sections */
+
+	  CheckValue(FUNCTION_NAME, "majorant", "", majorant[k], ZERO, INFTY);
+	  CheckValue(FUNCTION_NAME, "minxs", "", minxs[k], ZERO, INFTY);
+	  CheckValue(FUNCTION_NAME, "totxs", "", totxs[k], 0.0, INFTY);
+
+	  /* Store random number sequence */
+
+	  memcpy(&bseed[k], &SEED[id*RNG_SZ], sizeof(unsigned long));
+	}
+
+      /* Remember collision counter of thread */
+
+      nctot = GetPrivateData(pcol, id);
+
+      /***********************************************************************/
+
+      /***** Move event ******************************************************/
+
+      /* Reset event ques */
+
+      ncol = 0;
+      nsurf = 0;
+
+      for (k = 0; k < nb; k++)
+	{
+	  /* Check slot */
+
+	  if ((part = (long)bpart[k]) < VALID_PTR)
+	    continue;
+
+	  /* Swap in random number sequence and que of slot */
+
+	  memcpy(&SEED[id*RNG_SZ], &bseed[k], sizeof(unsigned long));
+	  WDB[OMPPtr(DATA_PART_PTR_QUE, id)] = RDB[evq + k];
+
+	  /* Swap in collision number and forced delta-tracking flag */
+
+	  PutPrivateData(pcol, bncol[k], id);
+	  PutPrivateData(pdtf, bdtf[k], id);
+
+	  /* Get type and material */
+
+	  type = (long)btype[k];
+	  mat = (long)bmat[k];
+
+	  /* Avoid compiler warning */
+
+	  trk = -1;
+	  cell = -1;
+
+	  /* Get tracking mode */
+
+	  mode = TrackMode(part, mat, E[k], totxs[k], majorant[k], type, id);
+
+	  /* Move particle forward */
+
+	  if (mode == TRACK_MODE_DT)
+	    {
+	      /* Use delta-tracking */
+
+	      trk = MoveDT(part, majorant[k], minxs[k], &cell, &xs[k], &x[k],
+			   &y[k], &z[k], &l, &u[k], &v[k], &w[k], E[k], id);
+	    }
+	  else if (mode == TRACK_MODE_ST)
+	    {
+	      /* Use surface-tracking */
+
+	      trk = MoveST(part, totxs[k], minxs[k], &cell, &xs[k], &x[k],
+			   &y[k], &z[k], &l, u[k], v[k], w[k], id);
+	    }
+	  else
+	    Die(FUNCTION_NAME, "Invalid tracking mode");
+
+	  /* Check distance */
+
+	  CheckValue(FUNCTION_NAME, "l", "", l, ZERO, INFTY);
+
+	  /* Weight window boundary */
+
+	  trk = StopAtWWBound(trk, &x[k], &y[k], &z[k], u[k], v[k], w[k],
+			      spd[k], &dt, &l, &cell, id);
+
+	  /* Calculate change in time */
+
+	  dt = l/spd[k];
+
+	  /* Do time cut-off */
+
+	  trk = TimeCutoff(trk, part, &cell, &dt, &x[k], &y[k], &z[k], u[k],
+			   v[k], w[k], E[k], t[k], wgt[k], spd[k], mode, id);
+
+	  /* Update time */
+
+	  t[k] = t[k] + dt;
+
+	  /* Check cell pointer */
+
+	  if (cell < VALID_PTR)
+	    Die(FUNCTION_NAME, "Particle lost");
+
+	  /* Get material pointer */
+
+	  mat = (long)RDB[cell + CELL_PTR_MAT];
+	  mat = MatPtr(mat, id);
+
+	  /* Put values */
+
+	  bcell[k] = (double)cell;
+	  bmat[k] = (double)mat;
+	  btrk[k] = (double)trk;
+
+	  /* Bank particle by next event */
+
+	  if ((trk == TRACK_END_VIRT) || (trk == TRACK_END_COLL))
+	    colq[ncol++] = (double)k;
+	  else if ((trk == TRACK_END_SURF) || (trk == TRACK_END_TCUT) ||
+		   (trk == TRACK_END_WWIN))
+	    surfq[nsurf++] = (double)k;
+	  else
+	    Die(FUNCTION_NAME, "Invalid track type %ld", trk);
+
+	  /* Store forced delta-tracking flag (set in MoveST()) */
+
+	  bdtf[k] = GetPrivateData(pdtf, id);
+
+	  /* Store random number sequence */
+
+	  memcpy(&bseed[k], &SEED[id*RNG_SZ], sizeof(unsigned long));
+	}
+
+      /* Restore collision counter */
+
+      PutPrivateData(pcol, nctot, id);
+
+      /***********************************************************************/
+
+      /***** Collision event *************************************************/
+
+      for (m = 0; m < ncol; m++)
+	{
+	  /* Get slot */
+
+	  k = (long)colq[m];
+
+	  /* Swap in random number sequence and que of slot */
+
+	  memcpy(&SEED[id*RNG_SZ], &bseed[k], sizeof(unsigned long));
+	  WDB[OMPPtr(DATA_PART_PTR_QUE, id)] = RDB[evq + k];
+
+	  /* Get particle data */
+
+	  part = (long)bpart[k];
+	  type = (long)btype[k];
+	  mat = (long)bmat[k];
+	  trk = (long)btrk[k];
+
+	  /* Swap in collision number and restore location of particle */
+	  /* in geometry (used in scoring and interface routines) */
+
+	  PutPrivateData(pcol, bncol[k], id);
+
+	  cell = WhereAmI(x[k], y[k], z[k], u[k], v[k], w[k], id);
+	  CheckPointer(FUNCTION_NAME, "(cell)", DATA_ARRAY, cell);
+
+	  /* Check track type */
+
+	  if (trk == TRACK_END_VIRT)
+	    {
+	      /***** Virtual collision ***************************************/
+
+	      /* Score collision */
+
+	      ptr = (long)RDB[RES_AVG_VIRT_COL];
+	      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+	      AddBuf1D(1.0, 1.0, ptr, id, 2 - type);
+
+	      /* Weight adjustment in alpha-eigenvalue mode */
+
+	      Alpha(E[k], majorant[k], &wgt[k]);
+
+	      /* Score collision (NOTE: Cross section is set to -1 if the */
+	      /* collision is not to be scored) */
+
+	      if (xs[k] > 0.0)
+		{
+		  /* Get density factor */
+
+		  g = DensityFactor(mat, x[k], y[k], z[k], t[k], id);
+		  CheckValue(FUNCTION_NAME, "g", "", g, 0.0, 1.0);
+
+		  /* Store point in history array */
+
+		  StoreHistoryPoint(part, mat, -1, x[k], y[k], z[k], u[k],
+				    v[k], w[k], E[k], t[k], wgt[k],
+				    1.0/xs[k], trk);
+
+		  /* Score collision */
+
+		  Score(mat, part, 1.0/xs[k], x[k], y[k], z[k], u[k], v[k],
+			w[k], E[k], wgt[k], t[k], spd[k], g, id);
+		}
+
+	      /***************************************************************/
+	    }
+	  else
+	    {
+	      /***** Physical collision **************************************/
+
+	      /* Score surface tallies */
+
+	      ScoreSurf(part, &x0[k], &y0[k], &z0[k], x[k], y[k], z[k], u[k],
+			v[k], w[k], E[k], wgt[k], t[k], id);
+
+	      /* Score track and collision */
+
+	      ptr = (long)RDB[RES_AVG_TRACKS];
+	      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+	      AddBuf1D(1.0, 1.0, ptr, id, 2 - type);
+
+	      ptr = (long)RDB[RES_AVG_REAL_COL];
+	      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+	      AddBuf1D(1.0, 1.0, ptr, id, 2 - type);
+
+	      /* Weight adjustment in alpha-eigenvalue mode */
+
+	      Alpha(E[k], majorant[k], &wgt[k]);
+
+	      /* Check material pointer */
+
+	      if (mat < VALID_PTR)
+		TrackingError(TRACK_ERR_NO_MATERIAL, -1, -1, -1, id);
+
+	      CheckPointer(FUNCTION_NAME, "(mat)", DATA_ARRAY, mat);
+
+	      /* Get density factor */
+
+	      g = DensityFactor(mat, x[k], y[k], z[k], t[k], id);
+	      CheckValue(FUNCTION_NAME, "g", "", g, 0.0, 1.0);
+
+	      /* Score collision */
+
+	      Score(mat, part, 1.0/xs[k], x[k], y[k], z[k], u[k], v[k], w[k],
+		    E[k], wgt[k], t[k], spd[k], g, id);
+
+	      /* Additional rejection by density factor */
+
+	      if (RandF(id) < g)
+		{
+		  /* Store point in history array */
+
+		  StoreHistoryPoint(part, mat, -1, x[k], y[k], z[k], u[k],
+				    v[k], w[k], E[k], t[k], wgt[k],
+				    1.0/xs[k], trk);
+
+		  /* Sample collision */
+
+		  trk = Collision(mat, part, x[k], y[k], z[k], &u[k], &v[k],
+				  &w[k], &E[k], &wgt[k], t[k], id);
+		}
+	      else
+		{
+		  /* Virtual collision, change track type */
+
+		  trk = TRACK_END_VIRT;
+		}
+
+	      /* Store point in history array */
+
+	      StoreHistoryPoint(part, mat, -1, x[k], y[k], z[k], u[k], v[k],
+				w[k], E[k], t[k], wgt[k], 1.0/xs[k], trk);
+
+	      /* Score efficiency of ifc collision rejection */
+
+	      if ((long)RDB[mat + MATERIAL_USE_IFC] == YES)
+		{
+		  ptr = (long)RDB[RES_IFC_COL_EFF];
+		  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+		  AddBuf1D(g, 1.0, ptr, id, 2 - type);
+		}
+
+	      /* Score total collision effiency */
+
+	      if (trk != TRACK_END_VIRT)
+		{
+		  ptr = (long)RDB[RES_TOT_COL_EFF];
+		  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+		  AddBuf1D(g, 1.0, ptr, id, 2 - type);
+		}
+
+	      /* Put track type */
+
+	      btrk[k] = (double)trk;
+
+	      /***************************************************************/
+	    }
+
+	  /* Store random number sequence */
+
+	  memcpy(&bseed[k], &SEED[id*RNG_SZ], sizeof(unsigned long));
+	}
+
+      /* Restore collision counter */
+
+      PutPrivateData(pcol, nctot, id);
+
+      /***********************************************************************/
+
+      /***** Surface crossing and other boundary events **********************/
+
+      for (m = 0; m < nsurf; m++)
+	{
+	  /* Get slot */
+
+	  k = (long)surfq[m];
+
+	  /* Swap in random number sequence and que of slot */
+
+	  memcpy(&SEED[id*RNG_SZ], &bseed[k], sizeof(unsigned long));
+	  WDB[OMPPtr(DATA_PART_PTR_QUE, id)] = RDB[evq + k];
+
+	  /* Get particle data */
+
+	  part = (long)bpart[k];
+	  type = (long)btype[k];
+	  mat = (long)bmat[k];
+	  trk = (long)btrk[k];
+
+	  /* Swap in collision number and restore location of particle */
+	  /* in geometry (same cell as found at the end of the move) */
+
+	  PutPrivateData(pcol, bncol[k], id);
+
+	  cell = WhereAmI(x[k], y[k], z[k], u[k], v[k], w[k], id);
+	  CheckPointer(FUNCTION_NAME, "(cell)", DATA_ARRAY, cell);
+
+	  /* Check track type */
+
+	  if (trk == TRACK_END_SURF)
+	    {
+	      /***** Surface crossing ****************************************/
+
+	      /* Check if outer boundary was crossed and score */
+	      /* surface tallies */
+
+	      if ((long)RDB[cell + CELL_TYPE] == CELL_TYPE_OUTSIDE)
+		ScoreSurf(part, &x0[k], &y0[k], &z0[k], x[k], y[k], z[k],
+			  u[k], v[k], w[k], E[k], wgt[k], t[k], id);
+
+	      /* Score surface crossing */
+
+	      ptr = (long)RDB[RES_AVG_SURF_CROSS];
+	      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+	      AddBuf1D(1.0, 1.0, ptr, id, 2 - type);
+
+	      /* Store first point in history array */
+
+	      StoreHistoryPoint(part, mat, -1, x[k], y[k], z[k], u[k], v[k],
+				w[k], E[k], t[k], wgt[k], -1.0, trk);
+
+	      /* Apply boundary conditions */
+
+	      bc = BoundaryConditions(&cell, &x[k], &y[k], &z[k], &u[k],
+				      &v[k], &w[k], &wgt[k], id);
+
+	      /* Check cell pointer */
+
+	      if (cell < VALID_PTR)
+		Die(FUNCTION_NAME, "Particle lost");
+
+	      /* Check leakage and repeated */
+
+	      if (bc < 0)
+		{
+		  /* Score track */
+
+		  ptr = (long)RDB[RES_AVG_TRACKS];
+		  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+		  AddBuf1D(1.0, 1.0, ptr, id, 2 - type);
+
+		  /* Score leakage */
+
+		  Leak(part, x[k], y[k], z[k], u[k], v[k], w[k], E[k], wgt[k],
+		       id);
+
+		  /* Set track type to leak */
+
+		  trk = TRACK_END_LEAK;
+		}
+	      else if (bc == YES)
+		{
+		  /* Adjust previous position */
+
+		  x0[k] = x[k] - 2.0*EXTRAP_L*u[k];
+		  y0[k] = y[k] - 2.0*EXTRAP_L*v[k];
+		  z0[k] = z[k] - 2.0*EXTRAP_L*w[k];
+
+		  /* Score surface tallies */
+
+		  ScoreSurf(part, &x0[k], &y0[k], &z0[k], x[k], y[k], z[k],
+			    u[k], v[k], w[k], E[k], wgt[k], t[k], id);
+
+		  /* Get material pointer */
+
+		  mat = (long)RDB[cell + CELL_PTR_MAT];
+		  mat = MatPtr(mat, id);
+
+		  /* Store second point in history array */
+
+		  StoreHistoryPoint(part, mat, -1, x[k], y[k], z[k], u[k],
+				    v[k], w[k], E[k], t[k], wgt[k], -1.0,
+				    TRACK_END_BC);
+		}
+
+	      /***************************************************************/
+	    }
+	  else if (trk == TRACK_END_TCUT)
+	    {
+	      /***** Time cut-off ********************************************/
+
+	      /* Score surface tallies */
+
+	      ScoreSurf(part, &x0[k], &y0[k], &z0[k], x[k], y[k], z[k], u[k],
+			v[k], w[k], E[k], wgt[k], t[k], id);
+
+	      /* Score track */
+
+	      ptr = (long)RDB[RES_AVG_TRACKS];
+	      CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+	      AddBuf1D(1.0, 1.0, ptr, id, 2 - type);
+
+	      /***************************************************************/
+	    }
+	  else
+	    {
+	      /***** Weight window boundary **********************************/
+
+	      /* Store history point */
+
+	      StoreHistoryPoint(part, mat, -1, x[k], y[k], z[k], u[k], v[k],
+				w[k], E[k], t[k], wgt[k], -1.0, trk);
+
+	      /* Apply weight window */
+
+	      trk = WeightWindow(trk, part, x[k], y[k], z[k], u[k], v[k],
+				 w[k], E[k], &wgt[k], t[k], YES, id);
+
+	      /***************************************************************/
+	    }
+
+	  /* Put values */
+
+	  bcell[k] = (double)cell;
+	  bmat[k] = (double)mat;
+	  btrk[k] = (double)trk;
+
+	  /* Store random number sequence */
+
+	  memcpy(&bseed[k], &SEED[id*RNG_SZ], sizeof(unsigned long));
+	}
+
+      /* Restore collision counter */
+
+      PutPrivateData(pcol, nctot, id);
+
+      /***********************************************************************/
+
+      /***** Check termination ***********************************************/
+
+      for (k = 0; k < nb; k++)
+	{
+	  /* Check slot */
+
+	  if ((part = (long)bpart[k]) < VALID_PTR)
+	    continue;
+
+	  /* Get particle data */
+
+	  type = (long)btype[k];
+	  mat = (long)bmat[k];
+	  trk = (long)btrk[k];
+	  loop = (long)bloop[k];
+	  lmax = (long)blmax[k];
+
+	  /* Check if history continues */
+
+	  if ((trk == TRACK_END_SCAT) || (trk == TRACK_END_SURF) ||
+	      (trk == TRACK_END_VIRT) || (trk == TRACK_END_WWIN))
+	    {
+	      /* Score total collision efficency */
+
+	      if (trk == TRACK_END_VIRT)
+		{
+		  ptr = (long)RDB[RES_TOT_COL_EFF];
+		  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+		  AddBuf1D(1.0, 1.0, ptr, id, 4 - type);
+		}
+
+	      /* Reset infinite loop counter after scattering and */
+	      /* update */
+
+	      if (trk == TRACK_END_SCAT)
+		loop = 0;
+
+	      bloop[k] = (double)(++loop);
+
+	      /* Check infinite loop */
+
+	      if (loop < lmax)
+		continue;
+	    }
+	  else if ((trk != TRACK_END_CAPT) && (trk != TRACK_END_FISS) &&
+		   (trk != TRACK_END_ECUT) && (trk != TRACK_END_WCUT) &&
+		   (trk != TRACK_END_LEAK) && (trk != TRACK_END_TCUT))
+	    Die(FUNCTION_NAME, "Loop not terminated by track type %ld", trk);
+
+	  /***** History terminated ******************************************/
+
+	  /* Swap in random number sequence and que of slot */
+
+	  memcpy(&SEED[id*RNG_SZ], &bseed[k], sizeof(unsigned long));
+	  WDB[OMPPtr(DATA_PART_PTR_QUE, id)] = RDB[evq + k];
+
+	  /* Free slot */
+
+	  bpart[k] = -1.0;
+
+	  /* Get mean number of collisions */
+
+	  n = (long)RDB[part + PARTICLE_COL_IDX];
+
+	  /* Score total and collisions to fission */
+
+	  ptr = (long)RDB[RES_ANA_MEAN_NCOL];
+	  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+	  AddBuf1D(n, 1.0, ptr, id, 0);
+
+	  if (trk == TRACK_END_FISS)
+	    AddBuf1D(n, 1.0, ptr, id, 1);
+
+	  /* Score number of loops */
+
+	  ptr = (long)RDB[RES_AVG_TRACK_LOOPS];
+	  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+	  AddBuf1D((double)(loop + 1), 1.0, ptr, id, 2 - type);
+
+	  /* Check for infinite loop */
+
+	  if (loop == lmax)
+	    {
+	      /* Check type and fail flag */
+
+	      if (((type == PARTICLE_TYPE_NEUTRON) &&
+		   ((long)RDB[DATA_NEUTRON_MAX_TRACK_LOOP_ERR] == YES)) ||
+		  ((type == PARTICLE_TYPE_GAMMA) &&
+		   ((long)RDB[DATA_PHOTON_MAX_TRACK_LOOP_ERR] == YES)))
+		TrackingError(TRACK_ERR_INF_LOOP, E[k], mat, type, id);
+
+	      /* Score error */
+
+	      AddBuf1D(1.0, 1.0, ptr, id, 4 - type);
+
+	      /* Put particle back in stack */
+
+	      ToStack(part, id);
+	    }
+	  else
+	    {
+	      /* Score time constants */
+
+	      ScoreTimeConstants(t[k], wgt[k], part, trk, id);
+
+	      /* Store point in history array */
+
+	      StoreHistoryPoint(part, mat, -1, x[k], y[k], z[k], u[k], v[k],
+				w[k], E[k], t[k], wgt[k], -1.0, trk);
+	    }
+
+	  /* Store random number sequence */
+
+	  memcpy(&bseed[k], &SEED[id*RNG_SZ], sizeof(unsigned long));
+	}
+
+      /***********************************************************************/
+    }
+
+  /* Restore que of thread (slot ques are empty) */
+
+  WDB[OMPPtr(DATA_PART_PTR_QUE, id)] = (double)que0;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -341,6 +341,7 @@ void TransportCycle()
 	    {
 	      MatlabOutput();
 	      DetectorOutput();
+	      BinaryOutput();
 	      MeshPlotter();
 	      PrintCoreDistr();
 	      PrintHistoryOutput();
@@ -805,6 +806,7 @@ void TransportCycle()
 	    {
 	      MatlabOutput();
 	      DetectorOutput();
+	      BinaryOutput();
 	      MeshPlotter();
 	      PrintCoreDistr();
 	      PrintHistoryOutput();
@@ -1366,6 +1368,7 @@ void TransportCycle()
 		{
 		  MatlabOutput();
 		  DetectorOutput();
+		  BinaryOutput();
 		  MeshPlotter();
 		  PrintCoreDistr();
 		  PrintHistoryOutput();
@@ -1543,8 +1546,11 @@ void TransportCycle()
 
 	    /* Loop over source */
 
-	    while(FromSrc(id) > VALID_PTR)
-	      Tracking(id);      
+	    if ((long)RDB[DATA_OPTI_EVENT_TRANSPORT] == YES)
+	      TrackingEvent(id);
+	    else
+	      while(FromSrc(id) > VALID_PTR)
+		Tracking(id);      
 	  }
 
 	  /* Stop parallel timer */
@@ -1630,6 +1636,7 @@ void TransportCycle()
 	    {
 	      MatlabOutput();
 	      DetectorOutput();
+	      BinaryOutput();
 	      MeshPlotter();
 	      PrintCoreDistr();
 	      PrintHistoryOutput();
@@ -1722,6 +1729,7 @@ void TransportCycle()
 
   MatlabOutput();
   DetectorOutput();
+  BinaryOutput();
   MeshPlotter();
   PrintCoreDistr();
   PrintHistoryOutput();
@@ -1744,6 +1752,10 @@ void TransportCycle()
 
   StatTests();
 
+  /* Complete binary output file */
+
+  FinishBinaryOutput();
+
   /***************************************************************************/
 }
 
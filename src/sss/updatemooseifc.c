@@ -0,0 +1,256 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : updatemooseifc.c                               */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Updates temperatures and densities of in-memory MOOSE        */
+/*              interfaces between coupled iterations                        */
+/*                                                                           */
+/* Comments: - Replaces ReadInterface() + ProcessInterface() with update     */
+/*             flag for IFC_TYPE_MOOSE. Mesh and search mesh are kept and    */
+/*             only the cells in the change list are processed.              */
+/*                                                                           */
+/*           - Density factors are calculated relative to the maximum        */
+/*             density of the initial distribution, which is also the        */
+/*             material majorant. Values above the majorant are not allowed. */
+/*             TMS limits are widened and the majorants updated by           */
+/*             UpdateTmpMajorants().                                         */
+/*                                                                           */
+/*           - Child cell index is created on first call.                    */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "UpdateMooseIFC:"
+
+/*****************************************************************************/
+
+void UpdateMooseIFC()
+{
+  long loc0, loc1, prnt, mat, nc, n, i, j;
+  double d, dmax, df, T;
+
+  /* Loop over interfaces */
+
+  loc0 = (long)RDB[DATA_PTR_IFC0];
+  while (loc0 > VALID_PTR)
+    {
+      /* Check type */
+
+      if ((long)RDB[loc0 + IFC_IN_MEMORY] != YES)
+	{
+	  /* Next interface */
+
+	  loc0 = NextItem(loc0);
+
+	  /* Cycle loop */
+
+	  continue;
+	}
+
+      /* Get pointer to material */
+
+      mat = (long)RDB[loc0 + IFC_PTR_MAT];
+      CheckPointer(FUNCTION_NAME, "(mat)", DATA_ARRAY, mat);
+
+      /* Get maximum density */
+
+      if ((dmax = RDB[loc0 + IFC_MAX_DENSITY]) == 0.0)
+	Die(FUNCTION_NAME, "Zero maximum density");
+
+      /* Get pointer to original cells */
+
+      if ((prnt = (long)RDB[loc0 + IFC_PTR_TET_MSH_PRNTS]) < VALID_PTR)
+	prnt = (long)RDB[loc0 + IFC_PTR_TET_MSH];
+
+      CheckPointer(FUNCTION_NAME, "(prnt)", DATA_ARRAY, prnt);
+
+      /* Get number of cells */
+
+      nc = ListSize(prnt);
+
+      if (nc != mooseifc.nc)
+	Die(FUNCTION_NAME, "Mismatch in number of cells (%ld %ld)", nc,
+	    mooseifc.nc);
+
+      /***********************************************************************/
+
+      /***** Create child cell index *****************************************/
+
+      if (((long)RDB[loc0 + IFC_PTR_TET_MSH_PRNTS] > VALID_PTR) &&
+	  (mooseifc.cptr == NULL))
+	{
+	  /* Allocate memory for index (same as other mooseifc arrays) */
+
+	  loc1 = (long)RDB[loc0 + IFC_PTR_TET_MSH];
+	  CheckPointer(FUNCTION_NAME, "(loc1)", DATA_ARRAY, loc1);
+
+	  mooseifc.cptr = (long *)calloc(nc + 1, sizeof(long));
+	  mooseifc.cidx = (long *)calloc(ListSize(loc1), sizeof(long));
+
+	  if ((mooseifc.cptr == NULL) || (mooseifc.cidx == NULL))
+	    Die(FUNCTION_NAME, "Memory allocation failed");
+
+	  /* Count children */
+
+	  loc1 = (long)RDB[loc0 + IFC_PTR_TET_MSH];
+	  while (loc1 > VALID_PTR)
+	    {
+	      /* Get parent index */
+
+	      i = (long)RDB[(long)RDB[loc1 + IFC_TET_MSH_PTR_PARENT] +
+			    IFC_TET_MSH_IDX];
+	      CheckValue(FUNCTION_NAME, "i", "", i, 0, nc - 1);
+
+	      /* Add to count */
+
+	      mooseifc.cptr[i + 1]++;
+
+	      /* Next */
+
+	      loc1 = NextItem(loc1);
+	    }
+
+	  /* Convert counts to offsets */
+
+	  for (i = 0; i < nc; i++)
+	    mooseifc.cptr[i + 1] = mooseifc.cptr[i + 1] + mooseifc.cptr[i];
+
+	  /* Store children, use flag array as a fill counter */
+
+	  loc1 = (long)RDB[loc0 + IFC_PTR_TET_MSH];
+	  while (loc1 > VALID_PTR)
+	    {
+	      /* Get parent index */
+
+	      i = (long)RDB[(long)RDB[loc1 + IFC_TET_MSH_PTR_PARENT] +
+			    IFC_TET_MSH_IDX];
+
+	      /* Put pointer */
+
+	      mooseifc.cidx[mooseifc.cptr[i] + mooseifc.flag[i]++] = loc1;
+
+	      /* Next */
+
+	      loc1 = NextItem(loc1);
+	    }
+
+	  /* Reset flags (change list may not be empty) */
+
+	  for (i = 0; i < nc; i++)
+	    mooseifc.flag[i] = NO;
+
+	  for (n = 0; n < mooseifc.nchg; n++)
+	    mooseifc.flag[mooseifc.chg[n]] = YES;
+	}
+
+      /***********************************************************************/
+
+      /***** Update changed cells ********************************************/
+
+      for (n = 0; n < mooseifc.nchg; n++)
+	{
+	  /* Get cell index */
+
+	  i = mooseifc.chg[n];
+	  CheckValue(FUNCTION_NAME, "i", "", i, 0, nc - 1);
+
+	  /* Get values */
+
+	  d = mooseifc.rho[i];
+	  T = mooseifc.T[i];
+
+	  /* Calculate density factor */
+
+	  if (d*dmax < 0.0)
+	    Error(loc0, "Inconsistent densities given in distribution %E %E",
+		  d, dmax);
+
+	  df = d/dmax;
+
+	  /* Check that the density factor is below unity */
+
+	  if (df > 1.0)
+	    Die(FUNCTION_NAME,
+		"Larger than unity density factor for interface %s: %E",
+		GetText(loc0 + IFC_PTR_INPUT_FNAME), df);
+
+	  /* Widen temperature limits */
+
+	  if (T > RDB[mat + MATERIAL_TMS_TMAX])
+	    WDB[mat + MATERIAL_TMS_TMAX] = T;
+
+	  if (T < RDB[mat + MATERIAL_TMS_TMIN])
+	    WDB[mat + MATERIAL_TMS_TMIN] = T;
+
+	  /* Get pointer to cell */
+
+	  loc1 = ListPtr(prnt, i);
+	  CheckPointer(FUNCTION_NAME, "(loc1)", DATA_ARRAY, loc1);
+
+	  /* Put temperature */
+
+	  WDB[loc1 + IFC_TET_MSH_TMP] = T;
+
+	  /* Check if cell was divided */
+
+	  if (mooseifc.cptr == NULL)
+	    {
+	      /* Put density factor */
+
+	      WDB[loc1 + IFC_TET_MSH_DF] = df;
+	    }
+	  else
+	    {
+	      /* Parents store densities, see ReadIFCOFMesh() */
+
+	      WDB[loc1 + IFC_TET_MSH_DF] = d;
+
+	      /* Loop over children */
+
+	      for (j = mooseifc.cptr[i]; j < mooseifc.cptr[i + 1]; j++)
+		{
+		  /* Get pointer */
+
+		  loc1 = mooseifc.cidx[j];
+		  CheckPointer(FUNCTION_NAME, "(loc1)", DATA_ARRAY, loc1);
+
+		  /* Put density factor and temperature */
+
+		  WDB[loc1 + IFC_TET_MSH_DF] = df;
+		  WDB[loc1 + IFC_TET_MSH_TMP] = T;
+		}
+	    }
+	}
+
+      /***********************************************************************/
+
+      /* Next interface */
+
+      loc0 = NextItem(loc0);
+    }
+
+  /* Reset change list */
+
+  for (n = 0; n < mooseifc.nchg; n++)
+    mooseifc.flag[mooseifc.chg[n]] = NO;
+
+  mooseifc.nchg = 0;
+
+  /* Update majorants if temperature limits were widened */
+
+  UpdateTmpMajorants();
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,318 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : updatetmpmajorants.c                           */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Updates TMS and DBRC majorants after multi-physics interface */
+/*              temperatures have changed                                    */
+/*                                                                           */
+/* Comments: - Called from ProcessInterface() and UpdateMooseIFC().          */
+/*             Material TMS limits have been widened by the interface        */
+/*             routines and are compared here to nuclide limits. Only        */
+/*             nuclides whose maximum temperature increased get new          */
+/*             majorants: TmpMajorants() skips nuclides already at           */
+/*             NUCLIDE_MAJORANT_TEMP. Macroscopic cross sections are         */
+/*             recalculated only for materials that contain these nuclides,  */
+/*             after which the DT majorants are updated.                     */
+/*                                                                           */
+/*           - Nothing is done if the limits have not widened, which is the  */
+/*             usual case in coupled iterations.                             */
+/*                                                                           */
+/*           - The majorants are calculated from data at the cross section   */
+/*             temperature, so the minimum can't go below it.                */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "UpdateTmpMajorants:"
+
+/*****************************************************************************/
+
+void UpdateTmpMajorants()
+{
+  long mat, ptr, iso, nuc, nuc0, nn, nm;
+  double maxT;
+
+  /* Check DBRC and TMS modes */
+
+  if (((long)RDB[DATA_USE_DBRC] == NO) &&
+      ((long)RDB[DATA_TMS_MODE] == TMS_MODE_NONE))
+    return;
+
+  /***************************************************************************/
+
+  /***** Widen nuclide limits ************************************************/
+
+  mat = (long)RDB[DATA_PTR_M0];
+  while (mat > VALID_PTR)
+    {
+      /* Reset update flag */
+
+      WDB[mat + MATERIAL_TMS_UPDATE] = (double)NO;
+
+      /* Copy limits from parent (divided materials) */
+
+      if ((ptr = (long)RDB[mat + MATERIAL_DIV_PTR_PARENT]) > VALID_PTR)
+	{
+	  if (RDB[ptr + MATERIAL_TMS_TMIN] < RDB[mat + MATERIAL_TMS_TMIN])
+	    WDB[mat + MATERIAL_TMS_TMIN] = RDB[ptr + MATERIAL_TMS_TMIN];
+
+	  if (RDB[ptr + MATERIAL_TMS_TMAX] > RDB[mat + MATERIAL_TMS_TMAX])
+	    WDB[mat + MATERIAL_TMS_TMAX] = RDB[ptr + MATERIAL_TMS_TMAX];
+	}
+
+      /* Check TMS mode */
+
+      if ((long)RDB[mat + MATERIAL_TMS_MODE] == NO)
+	{
+	  /* Interface temperature must be single valued */
+
+	  if (((long)RDB[mat + MATERIAL_USE_IFC] == YES) &&
+	      (RDB[mat + MATERIAL_TMS_TMIN] < RDB[mat + MATERIAL_TMS_TMAX]))
+	    Die(FUNCTION_NAME,
+		"Temperature range of material %s widened but TMS not in use",
+		GetText(mat + MATERIAL_PTR_NAME));
+
+	  /* Next material */
+
+	  mat = NextItem(mat);
+
+	  /* Cycle loop */
+
+	  continue;
+	}
+
+      /* Loop over composition */
+
+      iso = (long)RDB[mat + MATERIAL_PTR_COMP];
+      while (iso > VALID_PTR)
+	{
+	  /* Pointer to nuclide */
+
+	  nuc = (long)RDB[iso + COMPOSITION_PTR_NUCLIDE];
+	  CheckPointer(FUNCTION_NAME, "(nuc)", DATA_ARRAY, nuc);
+
+	  /* Check TMS flag and type (same as in TmpMajorants()) */
+
+	  if (((long)RDB[nuc + NUCLIDE_TYPE_FLAGS] & NUCLIDE_FLAG_TMS) &&
+	      ((long)RDB[nuc + NUCLIDE_TYPE] != NUCLIDE_TYPE_DECAY))
+	    {
+	      /* Check minimum */
+
+	      if (RDB[mat + MATERIAL_TMS_TMIN] <
+		  RDB[nuc + NUCLIDE_TMS_MIN_TEMP])
+		Die(FUNCTION_NAME,
+		    "Material %s temperature %1.1fK below nuclide %s data",
+		    GetText(mat + MATERIAL_PTR_NAME),
+		    RDB[mat + MATERIAL_TMS_TMIN],
+		    GetText(nuc + NUCLIDE_PTR_NAME));
+
+	      /* Widen maximum */
+
+	      if (RDB[mat + MATERIAL_TMS_TMAX] >
+		  RDB[nuc + NUCLIDE_TMS_MAX_TEMP])
+		WDB[nuc + NUCLIDE_TMS_MAX_TEMP] = RDB[mat + MATERIAL_TMS_TMAX];
+	    }
+
+	  /* Next */
+
+	  iso = NextItem(iso);
+	}
+
+      /* Next material */
+
+      mat = NextItem(mat);
+    }
+
+  /* Update DBRC maximum temperatures from nuclides with same ZAI */
+
+  nuc0 = (long)RDB[DATA_PTR_NUC0];
+  while (nuc0 > VALID_PTR)
+    {
+      /* Check DBRC flag */
+
+      if ((long)RDB[nuc0 + NUCLIDE_TYPE_FLAGS] & NUCLIDE_FLAG_DBRC)
+	{
+	  /* Get maximum temperature */
+
+	  maxT = RDB[nuc0 + NUCLIDE_DBRC_MAX_TEMP];
+
+	  /* Loop over nuclides */
+
+	  nuc = (long)RDB[DATA_PTR_NUC0];
+	  while (nuc > VALID_PTR)
+	    {
+	      /* Compare ZAI and maximum temperature */
+
+	      if ((RDB[nuc0 + NUCLIDE_ZAI] == RDB[nuc + NUCLIDE_ZAI]) &&
+		  (!((long)RDB[nuc + NUCLIDE_TYPE_FLAGS] & NUCLIDE_FLAG_DBRC)))
+		if (RDB[nuc + NUCLIDE_TMS_MAX_TEMP] > maxT)
+		  maxT = RDB[nuc + NUCLIDE_TMS_MAX_TEMP];
+
+	      /* Next nuclide */
+
+	      nuc = NextItem(nuc);
+	    }
+
+	  /* Put temperature */
+
+	  WDB[nuc0 + NUCLIDE_DBRC_MAX_TEMP] = maxT;
+	}
+
+      /* Next nuclide */
+
+      nuc0 = NextItem(nuc0);
+    }
+
+  /***************************************************************************/
+
+  /***** Find nuclides and materials to update *******************************/
+
+  /* Count nuclides */
+
+  nn = 0;
+
+  nuc = (long)RDB[DATA_PTR_NUC0];
+  while (nuc > VALID_PTR)
+    {
+      /* Compare maximum temperature to majorant temperature */
+
+      if ((long)RDB[nuc + NUCLIDE_TYPE_FLAGS] & NUCLIDE_FLAG_DBRC)
+	{
+	  if (RDB[nuc + NUCLIDE_DBRC_MAX_TEMP] !=
+	      RDB[nuc + NUCLIDE_MAJORANT_TEMP])
+	    nn++;
+	}
+      else if (((long)RDB[nuc + NUCLIDE_TYPE_FLAGS] & NUCLIDE_FLAG_TMS) &&
+	       ((long)RDB[nuc + NUCLIDE_TYPE] != NUCLIDE_TYPE_DECAY))
+	{
+	  if (RDB[nuc + NUCLIDE_TMS_MAX_TEMP] !=
+	      RDB[nuc + NUCLIDE_MAJORANT_TEMP])
+	    nn++;
+	}
+
+      /* Next nuclide */
+
+      nuc = NextItem(nuc);
+    }
+
+  /* Check if anything changed */
+
+  if (nn == 0)
+    return;
+
+  /* Multi-group majorants are collapsed only once */
+
+  if ((long)RDB[DATA_OPTI_MG_MODE] == YES)
+    Die(FUNCTION_NAME,
+	"TMS majorants can't be updated in multi-group mode");
+
+  /* Flag materials containing TMS nuclides with new majorants */
+
+  nm = 0;
+
+  mat = (long)RDB[DATA_PTR_M0];
+  while (mat > VALID_PTR)
+    {
+      /* Loop over composition */
+
+      iso = (long)RDB[mat + MATERIAL_PTR_COMP];
+      while (iso > VALID_PTR)
+	{
+	  /* Pointer to nuclide */
+
+	  nuc = (long)RDB[iso + COMPOSITION_PTR_NUCLIDE];
+	  CheckPointer(FUNCTION_NAME, "(nuc)", DATA_ARRAY, nuc);
+
+	  /* Check */
+
+	  if (((long)RDB[nuc + NUCLIDE_TYPE_FLAGS] & NUCLIDE_FLAG_TMS) &&
+	      ((long)RDB[nuc + NUCLIDE_TYPE] != NUCLIDE_TYPE_DECAY) &&
+	      (RDB[nuc + NUCLIDE_TMS_MAX_TEMP] !=
+	       RDB[nuc + NUCLIDE_MAJORANT_TEMP]))
+	    {
+	      /* Set flag */
+
+	      WDB[mat + MATERIAL_TMS_UPDATE] = (double)YES;
+	      nm++;
+
+	      /* Break loop */
+
+	      break;
+	    }
+
+	  /* Next */
+
+	  iso = NextItem(iso);
+	}
+
+      /* Next material */
+
+      mat = NextItem(mat);
+    }
+
+  fprintf(out, "Temperature limits widened for %ld nuclides ", nn);
+  fprintf(out, "and %ld materials, updating majorants...\n", nm);
+
+  /***************************************************************************/
+
+  /***** Update majorants ****************************************************/
+
+  /* Nuclide majorants (unchanged nuclides are skipped) */
+
+  TmpMajorants();
+
+  /* Macroscopic cross sections of flagged materials */
+
+  if (((long)RDB[DATA_OPTI_RECONSTRUCT_MACROXS] == YES) && (nm > 0))
+    {
+      /* Distribute materials to threads */
+
+      ScheduleMatTasks(MAT_TASK_TMS_UPDATE);
+
+      /* Start parallel timer */
+
+      StartTimer(TIMER_OMP_PARA);
+
+#ifdef OPEN_MP
+#pragma omp parallel private (mat)
+#endif
+      {
+	/* Loop over tasks */
+
+	while ((mat = NextMatTask(OMP_THREAD_NUM)) > VALID_PTR)
+	  MaterialTotals0(mat);
+      }
+
+      /* Stop parallel timer */
+
+      StopTimer(TIMER_OMP_PARA);
+
+      /* Free task list */
+
+      FinishMatTasks();
+
+      /* Distribute to MPI tasks */
+
+      DistributeMaterialData();
+    }
+
+  /* Majorants for delta-tracking */
+
+  CalculateDTMajorants();
+
+  fprintf(out, "OK.\n\n");
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
@@ -0,0 +1,197 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : walktetcell.c                                  */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Finds tetrahedral or polyhedral mesh cell by walking from    */
+/*              a starting cell through cell faces                           */
+/*                                                                           */
+/* Comments: - Faces are tested as in InTetCell(). If the point is outside   */
+/*             a face, the walk moves to the cell on the other side of it    */
+/*             using the owner and neighbour lists. Returns pointer to tet   */
+/*             cell or -1 if the walk leaves the mesh (point outside or      */
+/*             concave boundary) or does not terminate.                      */
+/*                                                                           */
+/*           - The first face tested is rotated between steps and the face   */
+/*             leading back to the previous cell is taken only if no other   */
+/*             choice exists. This prevents the walk from cycling in meshes  */
+/*             that are not Delaunay.                                        */
+/*                                                                           */
+/*           - Caller must fall back to list search on failure.              */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "WalkTetCell:"
+
+/*****************************************************************************/
+
+long WalkTetCell(long ifc, long cgns, double x, double y, double z, long id)
+{
+  long surflist, ownrlist, nbrlist, facelist, sidelist, surf, ptr;
+  long pt0, pt1, pt2, prev, next, back, out, nf, n, i, j, side, step;
+  double x0, y0, z0, x1, y1, z1, x2, y2, z2, d;
+
+  /* Check pointers */
+
+  CheckPointer(FUNCTION_NAME, "(ifc)", DATA_ARRAY, ifc);
+  CheckPointer(FUNCTION_NAME, "(cgns)", DATA_ARRAY, cgns);
+
+  /* Get pointer to interface surfaces */
+
+  surflist = (long)RDB[ifc + IFC_PTR_SURF_LIST];
+  CheckPointer(FUNCTION_NAME, "(surflist)", DATA_ARRAY, surflist);
+
+  /* Get pointers to owner and neighbour lists */
+
+  ownrlist = (long)RDB[ifc + IFC_PTR_OWNR_LIST];
+  nbrlist = (long)RDB[ifc + IFC_PTR_NBR_LIST];
+
+  /* Check that topology is available, otherwise test starting cell only */
+
+  if ((ownrlist < VALID_PTR) || (nbrlist < VALID_PTR))
+    {
+      if (InTetCell(ifc, cgns, x, y, z, YES, id) == YES)
+	return cgns;
+      else
+	return -1;
+    }
+
+  /* Reset previous cell */
+
+  prev = -1;
+
+  /* Walk */
+
+  for (step = 0; step < MAX_TET_WALK_STEPS; step++)
+    {
+      /* Get pointers to cell's face and side lists */
+
+      facelist = (long)RDB[cgns + IFC_TET_MSH_PTR_FACES];
+      CheckPointer(FUNCTION_NAME, "(facelist)", DATA_ARRAY, facelist);
+
+      sidelist = (long)RDB[cgns + IFC_TET_MSH_PTR_SIDES];
+      CheckPointer(FUNCTION_NAME, "(sidelist)", DATA_ARRAY, sidelist);
+
+      /* Number of faces */
+
+      nf = (long)RDB[cgns + IFC_TET_MSH_NF];
+      CheckValue(FUNCTION_NAME, "nf", "", nf, 4, INFTY);
+
+      /* Reset next cell, way back and boundary flag */
+
+      next = -1;
+      back = -1;
+      out = NO;
+
+      /* Loop over faces starting from rotated position */
+
+      for (j = 0; j < nf; j++)
+	{
+	  i = (j + step) % nf;
+
+	  /* Get index of face and side */
+
+	  n = (long)RDB[facelist + i];
+	  side = (long)RDB[sidelist + i];
+
+	  /* Get pointer to face surface and its parameters */
+
+	  surf = ListPtr(surflist, n);
+
+	  ptr = (long)RDB[surf + SURFACE_PTR_PARAMS];
+	  CheckPointer(FUNCTION_NAME, "(ptr)", DATA_ARRAY, ptr);
+
+	  /* Get pointers to points */
+
+	  pt0 = (long)RDB[ptr + 0];
+	  pt1 = (long)RDB[ptr + 1];
+	  pt2 = (long)RDB[ptr + 2];
+
+	  /* Calculate vectors */
+
+	  x0 = -RDB[pt1 + 0] + x;
+	  y0 = -RDB[pt1 + 1] + y;
+	  z0 = -RDB[pt1 + 2] + z;
+
+	  x1 = -RDB[pt0 + 0] + RDB[pt1 + 0];
+	  y1 = -RDB[pt0 + 1] + RDB[pt1 + 1];
+	  z1 = -RDB[pt0 + 2] + RDB[pt1 + 2];
+
+	  x2 = -RDB[pt1 + 0] + RDB[pt2 + 0];
+	  y2 = -RDB[pt1 + 1] + RDB[pt2 + 1];
+	  z2 = -RDB[pt1 + 2] + RDB[pt2 + 2];
+
+	  /* Scalar triple product */
+
+	  d = x0*(y1*z2 - y2*z1) - y0*(x1*z2 - x2*z1) + z0*(x1*y2 - x2*y1);
+
+	  /* Check if inside (same rule as InTetCell() with surface */
+	  /* included, shared faces belong to the owner) */
+
+	  if (((d <= 0.0) && (side < 0)) || ((d > 0.0) && (side > 0)))
+	    continue;
+
+	  /* Point is outside this face, get cell on the other side */
+
+	  if (side < 0)
+	    ptr = (long)RDB[nbrlist + n];
+	  else
+	    ptr = (long)RDB[ownrlist + n];
+
+	  /* Check boundary face */
+
+	  if (ptr < VALID_PTR)
+	    {
+	      out = YES;
+	      continue;
+	    }
+
+	  /* Avoid going straight back */
+
+	  if (ptr == prev)
+	    back = ptr;
+	  else
+	    {
+	      next = ptr;
+	      break;
+	    }
+	}
+
+      /* Check if all faces were tested */
+
+      if (j == nf)
+	{
+	  /* Check if there was a way out */
+
+	  if (back > VALID_PTR)
+	    next = back;
+	  else if (out == YES)
+	    return -1;
+	  else
+	    return cgns;
+	}
+
+      /* Move to next cell */
+
+      prev = cgns;
+      cgns = next;
+    }
+
+  /* Walk did not terminate */
+
+  return -1;
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
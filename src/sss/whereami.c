@@ -417,15 +417,14 @@ long WhereAmI(double x, double y, double z, double u, double v, double w,
 	    if ((cgns = TestValuePair(uni + UNIVERSE_PTR_NEXT_CELL, ncol, id))
 		> VALID_PTR)
 	      {
-		/* For some reason this does not work with 100% certainty, */
-		/* maybe because the neutron is actually moved forward by  */
-		/* extrapolation distance, and may end up in a different   */
-		/* cell. */
+		/* The neutron is moved forward by extrapolation distance */
+		/* and may end up in a different cell, so walk from the   */
+		/* neighbour to the cell containing the point. */
 
 		/* Get pointer to interface */
 		ptr = (long)RDB[umsh + UMSH_PTR_IFC];
 
-		if (InTetCell(ptr, cgns, x, y, z, YES, id) == YES)
+		if ((cgns = WalkTetCell(ptr, cgns, x, y, z, id)) > VALID_PTR)
 		  {
 		    /* Get cell from tet */
 
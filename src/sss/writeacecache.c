@@ -0,0 +1,142 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : writeacecache.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Writes ACE data read by ReadACEFile() from given file into   */
+/*              binary cache file                                            */
+/*                                                                           */
+/* Comments: - Format: identifier, size and modification time of ACE file,   */
+/*             ACE file path, awr, NXS and JXS arrays and the XSS array as   */
+/*             binary data (native byte order, the cache is meant to be on   */
+/*             the machine that uses it).                                    */
+/*                                                                           */
+/*           - Written only by MPI task 0. The data is first written in a    */
+/*             temporary file that is then renamed, so other tasks and runs  */
+/*             never see incomplete files.                                   */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "WriteACECache:"
+
+/*****************************************************************************/
+
+void WriteACECache(long nuc, char *file, double awr)
+{
+  long ace, ptr, n, sz, fsz, ftime, NXS[16], JXS[32];
+  char src[MAX_STR], name[MAX_STR], path[MAX_STR], tmp[MAX_STR];
+  struct stat sb;
+  FILE *fp;
+
+  /* Check if cache is used */
+
+  if ((long)RDB[DATA_PTR_ACE_CACHE_PATH] < VALID_PTR)
+    return;
+
+  /* Check MPI id */
+
+  if (mpiid > 0)
+    return;
+
+  /* Get pointer to ACE data */
+
+  ace = (long)RDB[nuc + NUCLIDE_PTR_ACE];
+  CheckPointer(FUNCTION_NAME, "ace", ACE_ARRAY, ace);
+
+  /* Get name */
+
+  WDB[DATA_DUMMY] = ACE[ace + ACE_PTR_NAME];
+  strcpy(name, GetText(DATA_DUMMY));
+
+  /* Copy file name (reset trailing part for writing) */
+
+  memset(src, '\0', MAX_STR);
+  strncpy(src, file, MAX_STR - 1);
+
+  /* Get size and modification time of ACE file */
+
+  if (stat(src, &sb) != 0)
+    return;
+
+  fsz = (long)sb.st_size;
+  ftime = (long)sb.st_mtime;
+
+  /* Get NXS and JXS arrays */
+
+  ptr = (long)ACE[ace + ACE_PTR_NXS];
+  CheckPointer(FUNCTION_NAME, "(ptr)", ACE_ARRAY, ptr);
+
+  for (n = 0; n < 16; n++)
+    NXS[n] = (long)ACE[ptr + n];
+
+  ptr = (long)ACE[ace + ACE_PTR_JXS];
+  CheckPointer(FUNCTION_NAME, "(ptr)", ACE_ARRAY, ptr);
+
+  for (n = 0; n < 32; n++)
+    JXS[n] = (long)ACE[ptr + n];
+
+  /* Pointer to XSS array and data size */
+
+  ptr = (long)ACE[ace + ACE_PTR_XSS];
+  CheckPointer(FUNCTION_NAME, "(ptr)", ACE_ARRAY, ptr);
+
+  sz = NXS[0];
+
+  /* File names (never open truncated path) */
+
+  if (snprintf(path, MAX_STR, "%s/%s.acebin",
+	       GetText(DATA_PTR_ACE_CACHE_PATH), name) >= MAX_STR)
+    Die(FUNCTION_NAME, "ACE cache file name too long");
+
+  if (snprintf(tmp, MAX_STR, "%s.%ld", path, (long)getpid()) >= MAX_STR)
+    Die(FUNCTION_NAME, "ACE cache file name too long");
+
+  /* Open temporary file */
+
+  if ((fp = fopen(tmp, "w")) == NULL)
+    {
+      Note(0, "Unable to write ACE cache file %s", path);
+      return;
+    }
+
+  /* Write header and data */
+
+  if ((fwrite(ACE_CACHE_MAGIC, sizeof(char), 8, fp) != 8) ||
+      (fwrite(&fsz, sizeof(long), 1, fp) != 1) ||
+      (fwrite(&ftime, sizeof(long), 1, fp) != 1) ||
+      (fwrite(src, sizeof(char), MAX_STR, fp) != MAX_STR) ||
+      (fwrite(&awr, sizeof(double), 1, fp) != 1) ||
+      (fwrite(NXS, sizeof(long), 16, fp) != 16) ||
+      (fwrite(JXS, sizeof(long), 32, fp) != 32) ||
+      ((long)fwrite(&ACE[ptr], sizeof(double), sz, fp) != sz))
+    {
+      /* Remove incomplete file */
+
+      fclose(fp);
+      remove(tmp);
+
+      Note(0, "Unable to write ACE cache file %s", path);
+      return;
+    }
+
+  /* Close file and replace previous */
+
+  fclose(fp);
+
+  if (rename(tmp, path) != 0)
+    remove(tmp);
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
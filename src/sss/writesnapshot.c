@@ -0,0 +1,193 @@
+#ifdef __cplusplus 
+extern "C" { 
+#endif 
+/*****************************************************************************/
+/*                                                                           */
+/* serpent 2 (beta-version) : writesnapshot.c                                */
+/*                                                                           */
+/* Created:       2026/10/18 (LMK)                                           */
+/* Last modified: 2026/10/18 (LMK)                                           */
+/* Version:       2.1.26                                                     */
+/*                                                                           */
+/* Description: Writes processed data arrays in snapshot file                */
+/*                                                                           */
+/* Comments: - Called at the end of initialization, before memory            */
+/*             allocation is denied. Format: identifier, code version, key,  */
+/*             number of OpenMP threads, array sizes, main, ACE, ASCII,      */
+/*             private, buffer, RES1 and RES2 arrays and checksum.           */
+/*                                                                           */
+/*           - Key is calculated in ReadSnapshot(), file name is reset there */
+/*             if snapshot cannot be used.                                   */
+/*                                                                           */
+/*****************************************************************************/
+
+#include "header.h"
+#include "locations.h"
+
+#define FUNCTION_NAME "WriteSnapshot:"
+
+/*****************************************************************************/
+
+void WriteSnapshot()
+{
+  long n, nt, ok, sz[SNAPSHOT_ARRAYS], esz[SNAPSHOT_ARRAYS];
+  unsigned long key, h;
+  char ver[16], fname[MAX_STR], tmp[MAX_STR];
+  const void *dat[SNAPSHOT_ARRAYS];
+  FILE *fp;
+
+  /* Check file name and MPI id */
+
+  if ((long)RDB[DATA_PTR_SNAPSHOT_FNAME] < VALID_PTR)
+    return;
+  else if (mpiid > 0)
+    return;
+
+  /* Get file names */
+
+  strcpy(fname, GetText(DATA_PTR_SNAPSHOT_FNAME));
+
+  if (snprintf(tmp, MAX_STR, "%s.%ld", fname, (long)getpid()) >= MAX_STR)
+    {
+      Note(0, "Snapshot file name \"%s\" too long", fname);
+      return;
+    }
+
+  /* Get key, version and number of threads */
+
+  key = (unsigned long)RDB[DATA_SNAPSHOT_KEY];
+
+  memset(ver, '\0', 16);
+  strncpy(ver, CODE_VERSION, 15);
+
+  nt = (long)RDB[DATA_OMP_MAX_THREADS];
+
+  /***************************************************************************/
+
+  /***** Array pointers and sizes ********************************************/
+
+  /* Main data */
+
+  dat[0] = WDB;
+  sz[0] = (long)RDB[DATA_REAL_MAIN_SIZE];
+
+  /* ACE data (freed in ProcessXSData()) */
+
+  dat[1] = ACE;
+  sz[1] = (long)RDB[DATA_REAL_ACE_SIZE];
+
+  /* Text data */
+
+  dat[2] = ASCII;
+  sz[2] = (long)RDB[DATA_ASCII_DATA_SIZE];
+
+  /* Private data, one segment per thread */
+
+  dat[3] = PRIVA;
+  sz[3] = (long)RDB[DATA_REAL_PRIVA_SIZE]*nt;
+
+  /* Scoring buffer */
+
+  dat[4] = BUF;
+
+  if ((long)RDB[DATA_OPTI_SHARED_BUF] == YES)
+    sz[4] = (long)RDB[DATA_REAL_BUF_SIZE];
+  else
+    sz[4] = (long)RDB[DATA_REAL_BUF_SIZE]*nt;
+
+  /* Results arrays */
+
+  dat[5] = RES1;
+  sz[5] = (long)RDB[DATA_REAL_RES1_SIZE];
+
+  dat[6] = RES2;
+
+  if ((long)RDB[DATA_OPTI_SHARED_RES2] == YES)
+    sz[6] = (long)RDB[DATA_REAL_RES2_SIZE];
+  else
+    sz[6] = (long)RDB[DATA_REAL_RES2_SIZE]*nt;
+
+  /* Element sizes and unallocated arrays */
+
+  for (n = 0; n < SNAPSHOT_ARRAYS; n++)
+    {
+      esz[n] = sizeof(double);
+
+      if (dat[n] == NULL)
+	sz[n] = 0;
+    }
+
+  esz[2] = sizeof(char);
+
+  /***************************************************************************/
+
+  /***** Write file **********************************************************/
+
+  /* Open temporary file */
+
+  if ((fp = fopen(tmp, "w")) == NULL)
+    {
+      Note(0, "Unable to write snapshot file \"%s\"", fname);
+      return;
+    }
+
+  /* Write header */
+
+  if ((fwrite(SNAPSHOT_MAGIC, sizeof(char), 8, fp) != 8) ||
+      (fwrite(ver, sizeof(char), 16, fp) != 16) ||
+      (fwrite(&key, sizeof(unsigned long), 1, fp) != 1) ||
+      (fwrite(&nt, sizeof(long), 1, fp) != 1) ||
+      (fwrite(sz, sizeof(long), SNAPSHOT_ARRAYS, fp) != SNAPSHOT_ARRAYS))
+    ok = NO;
+  else
+    ok = YES;
+
+  /* Reset checksum */
+
+  h = 0;
+
+  /* Write arrays */
+
+  for (n = 0; (ok == YES) && (n < SNAPSHOT_ARRAYS); n++)
+    if (sz[n] > 0)
+      {
+	if ((long)fwrite(dat[n], esz[n], sz[n], fp) != sz[n])
+	  ok = NO;
+	else
+	  h = DataHash(dat[n], sz[n]*esz[n], h);
+      }
+
+  /* Write checksum and close file */
+
+  if ((ok == NO) || (fwrite(&h, sizeof(unsigned long), 1, fp) != 1))
+    {
+      /* Remove incomplete file */
+
+      fclose(fp);
+      remove(tmp);
+
+      Note(0, "Unable to write snapshot file \"%s\"", fname);
+      return;
+    }
+
+  fclose(fp);
+
+  /* Replace previous */
+
+  if (rename(tmp, fname) != 0)
+    {
+      remove(tmp);
+
+      Note(0, "Unable to write snapshot file \"%s\"", fname);
+      return;
+    }
+
+  /* Print */
+
+  fprintf(out, "Processed data written in snapshot file \"%s\".\n\n", fname);
+}
+
+/*****************************************************************************/
+#ifdef __cplusplus 
+} 
+#endif 
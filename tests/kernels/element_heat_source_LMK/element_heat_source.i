@@ -72,10 +72,14 @@
 []
 
 [UserObjects]
+  [./elemidx]
+    type = ElementIndex
+  [../]
   [./elemtrans]
     type = ElementTransfer
     variable = u
     block = 0
+    index_user_object = elemidx
   [../]
   [./runserpent]
     type = RunSerpent
@@ -85,6 +89,7 @@
   [./heatin]
     type = HeatToMoose
     execute_on = timestep_begin
+    index_user_object = elemidx
   [../]
 []
 
@@ -0,0 +1,197 @@
+# Same problem solved twice, with the power read from the ASCII interface
+# output (u) and from the binary output file (v). The difference is only
+# due to the precision of the ASCII file (6 significant digits). Serpent
+# is also run at initial, so that both files are written by the same
+# transport cycle before they are first read at timestep_begin.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+  xmin = -5
+  xmax = 5
+  ymin = -5
+  ymax = 5
+  zmin = -5
+  zmax = 5
+  uniform_refine = 3
+  elem_type = PRISM6
+[]
+
+[Variables]
+  [./u]
+    initial_condition = 600
+  [../]
+  [./v]
+    initial_condition = 600
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./elemsrc]
+    type = ElementHeatSource
+    to_moose_object = heatin
+    variable = u
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+  [./elemsrc_v]
+    type = ElementHeatSource
+    to_moose_object = heatbin
+    variable = v
+  [../]
+[]
+
+[BCs]
+  [./top]
+    type = DirichletBC
+    variable = u
+    boundary = top
+    value = 600
+  [../]
+  [./bot]
+    type = DirichletBC
+    variable = u
+    boundary = bottom
+    value = 600
+  [../]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 600
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 600
+  [../]
+  [./front]
+    type = DirichletBC
+    variable = u
+    boundary = front
+    value = 600
+  [../]
+  [./back]
+    type = DirichletBC
+    variable = u
+    boundary = back
+    value = 600
+  [../]
+  [./top_v]
+    type = DirichletBC
+    variable = v
+    boundary = top
+    value = 600
+  [../]
+  [./bot_v]
+    type = DirichletBC
+    variable = v
+    boundary = bottom
+    value = 600
+  [../]
+  [./left_v]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 600
+  [../]
+  [./right_v]
+    type = DirichletBC
+    variable = v
+    boundary = right
+    value = 600
+  [../]
+  [./front_v]
+    type = DirichletBC
+    variable = v
+    boundary = front
+    value = 600
+  [../]
+  [./back_v]
+    type = DirichletBC
+    variable = v
+    boundary = back
+    value = 600
+  [../]
+[]
+
+[UserObjects]
+  [./elemidx]
+    type = ElementIndex
+  [../]
+  [./elemtrans]
+    type = ElementTransfer
+    variable = u
+    execute_on = 'initial timestep_end'
+    block = 0
+    index_user_object = elemidx
+  [../]
+  [./runserpent]
+    type = RunSerpent
+    execute_on = 'initial timestep_end'
+    transfer_user_object = elemtrans
+  [../]
+  [./heatin]
+    type = HeatToMoose
+    execute_on = timestep_begin
+    index_user_object = elemidx
+  [../]
+  [./heatbin]
+    type = HeatToMoose
+    execute_on = timestep_begin
+    index_user_object = elemidx
+    binary_file = input_res.bin
+  [../]
+[]
+
+[Functions]
+  [./rel_diff_fn]
+    type = ParsedFunction
+    value = 'd/n'
+    vars = 'd n'
+    vals = 'l2_diff l2_u'
+  [../]
+[]
+
+[Postprocessors]
+  [./l2_diff]
+    type = ElementL2Difference
+    variable = v
+    other_variable = u
+    outputs = none
+  [../]
+  [./l2_u]
+    type = ElementL2Norm
+    variable = u
+    outputs = none
+  [../]
+  [./rel_diff]
+    # Difference relative to the solution, bounded by the relative
+    # rounding of the ASCII values (5E-6)
+    type = FunctionValuePostprocessor
+    function = rel_diff_fn
+  [../]
+[]
+
+[Executioner]
+  # Preconditioned JFNK (default)
+  type = Transient
+  num_steps = 5
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]